@@ -73,6 +73,10 @@ TT_EAGER_COMMON_TEST_ENTRIES = (
         "tensors/test_host_device_loopback",
     ),
     TestEntry("tt_eager/tests/tensors/test_copy_and_move", "tensors/test_copy_and_move"),
+    TestEntry("tt_eager/tests/tensors/test_host_pad_unpad", "tensors/test_host_pad_unpad"),
+    TestEntry("tt_eager/tests/tensors/test_conv_weight_bfp8", "tensors/test_conv_weight_bfp8"),
+    TestEntry("tt_eager/tests/tensors/test_async_command_queue", "tensors/test_async_command_queue"),
+    TestEntry("tt_eager/tests/tensors/test_tilized_upload", "tensors/test_tilized_upload"),
     # DTX Tests
     TestEntry("tt_eager/tests/dtx/tensor", "dtx/tensor"),
     TestEntry("tt_eager/tests/dtx/unit_tests/", "dtx/unit_tests"),
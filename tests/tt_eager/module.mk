@@ -27,6 +27,10 @@ TT_EAGER_TESTS += \
 		 tests/tt_eager/ops/test_sfpu \
 		 tests/tt_eager/tensors/test_copy_and_move \
 		 tests/tt_eager/tensors/test_host_device_loopback \
+		 tests/tt_eager/tensors/test_host_pad_unpad \
+		 tests/tt_eager/tensors/test_conv_weight_bfp8 \
+		 tests/tt_eager/tensors/test_async_command_queue \
+		 tests/tt_eager/tensors/test_tilized_upload \
 		 tests/tt_eager/tensors/test_sharded_loopback \
 		 tests/tt_eager/integration_tests/test_bert \
 
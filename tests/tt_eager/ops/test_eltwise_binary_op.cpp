@@ -7,6 +7,7 @@
 #include "tensor/owned_buffer_functions.hpp"
 #include "tensor/tensor.hpp"
 #include "tt_dnn/op_library/eltwise_binary/eltwise_binary_op.hpp"
+#include "tt_dnn/op_library/op_metrics.hpp"
 #include "tt_dnn/op_library/program_cache.hpp"
 #include "tt_numpy/functions.hpp"
 
@@ -102,6 +103,14 @@ int main() {
         }
     };
 
+    // Runs without the program cache are recorded under program hash 0, and all of them compile
+    for (const auto& metrics : tt::tt_metal::op_metrics::snapshot()) {
+        TT_FATAL(metrics.program_hash == 0 and metrics.num_cache_hits == 0);
+        TT_FATAL(metrics.compile_time.count == metrics.num_runs and metrics.dispatch_time.count == metrics.num_runs);
+    }
+    tt::tt_metal::op_metrics::reset();
+    TT_FATAL(tt::tt_metal::op_metrics::snapshot().empty());
+
     tt::tt_metal::program_cache::enable();
 
     run_binary_ops();
@@ -117,6 +126,46 @@ int main() {
         "There are {} entries",
         tt::tt_metal::program_cache::num_entries());
 
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    for (const auto& [op_type, stats] : tt::tt_metal::program_cache::stats()) {
+        hits += stats.hits;
+        misses += stats.misses;
+    }
+    TT_FATAL(misses == 4 and hits == 11, "There are {} hits and {} misses", hits, misses);
+
+    auto op_metrics = tt::tt_metal::op_metrics::snapshot();
+    TT_FATAL(op_metrics.size() == 4, "There are metrics of {} programs", op_metrics.size());
+    std::size_t num_runs = 0;
+    std::size_t num_cache_hits = 0;
+    for (const auto& metrics : op_metrics) {
+        num_runs += metrics.num_runs;
+        num_cache_hits += metrics.num_cache_hits;
+        TT_FATAL(metrics.compile_time.count == 1 and metrics.dispatch_time.count == metrics.num_runs);
+        TT_FATAL(metrics.dispatch_time.quantile_ns(0.5) <= metrics.dispatch_time.quantile_ns(1.0));
+    }
+    TT_FATAL(num_runs == hits + misses and num_cache_hits == hits, "There are {} runs and {} cache hits", num_runs, num_cache_hits);
+
+    // Bounded cache keeps the pinned program and evicts the rest in LRU order
+    tt::tt_metal::program_cache::set_capacity(2, 0);
+    TT_FATAL(tt::tt_metal::program_cache::num_entries() == 2);
+    auto pinned_hash = tt::tt_metal::program_cache::entries().back().hash;
+    TT_FATAL(tt::tt_metal::program_cache::pin(pinned_hash));
+
+    run_binary_ops();
+
+    auto entries = tt::tt_metal::program_cache::entries();
+    TT_FATAL(entries.size() == 2, "There are {} entries", entries.size());
+    TT_FATAL(std::any_of(entries.begin(), entries.end(), [pinned_hash](const auto& entry) { return entry.hash == pinned_hash; }));
+    TT_FATAL(tt::tt_metal::program_cache::binary_size_bytes() > 0);
+
+    std::size_t evictions = 0;
+    for (const auto& [op_type, stats] : tt::tt_metal::program_cache::stats()) {
+        evictions += stats.evictions;
+    }
+    TT_FATAL(evictions > 2, "There are {} evictions", evictions);
+    tt::tt_metal::program_cache::set_capacity(0, 0);
+
     tt::tt_metal::program_cache::disable_and_clear();
 
     TT_FATAL(tt::tt_metal::program_cache::num_entries() == 0);
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// With the async command queue, enqueue calls return before the worker thread has read their sources. Runs uncached
+// ops on inputs uploaded from temporary host tensors and tilizes tensors on their way to the device, both of which
+// free or reuse what they enqueued right after the call returns.
+
+#include "common/constants.hpp"
+#include "tt_metal/llrt/rtoptions.hpp"
+#include "tensor/owned_buffer.hpp"
+#include "tensor/owned_buffer_functions.hpp"
+#include "tensor/tensor.hpp"
+#include "tt_dnn/op_library/eltwise_binary/eltwise_binary_op.hpp"
+#include "tt_dnn/op_library/program_cache.hpp"
+#include "tt_numpy/functions.hpp"
+
+using namespace tt;
+using namespace tt_metal;
+using namespace constants;
+
+namespace {
+
+Tensor host_add(const Tensor& input_tensor_a, const Tensor& input_tensor_b) {
+    auto input_a_buffer = owned_buffer::get_as<bfloat16>(input_tensor_a);
+    auto input_b_buffer = owned_buffer::get_as<bfloat16>(input_tensor_b);
+    auto output_buffer = owned_buffer::create<bfloat16>(input_tensor_a.volume());
+    for (auto index = 0; index < output_buffer.size(); index++) {
+        output_buffer[index] = bfloat16(input_a_buffer[index].to_float() + input_b_buffer[index].to_float());
+    }
+    return Tensor(OwnedStorage{output_buffer}, input_tensor_a.shape(), input_tensor_a.dtype(), input_tensor_a.layout());
+}
+
+// The program of every run is created and dropped within the op, and the inputs are written from temporaries
+void test_uncached_ops(Device* device) {
+    TT_FATAL(not program_cache::is_enabled());
+    for (uint32_t i = 0; i < 8; i++) {
+        Shape shape = {1, 1, TILE_HEIGHT * (i % 3 + 1), TILE_WIDTH * 2};
+        auto input_tensor_a = tt::numpy::random::random(shape, DataType::BFLOAT16);
+        auto input_tensor_b = tt::numpy::random::random(shape, DataType::BFLOAT16);
+        auto device_output = add(input_tensor_a.to(Layout::TILE).to(device), input_tensor_b.to(Layout::TILE).to(device));
+        auto host_output = host_add(input_tensor_a, input_tensor_b);
+        TT_FATAL(tt::numpy::allclose<bfloat16>(host_output, device_output.cpu().to(Layout::ROW_MAJOR)));
+    }
+}
+
+// Large enough for the tilized upload to reuse its staging chunks
+void test_tilized_upload(Device* device) {
+    Shape shape = {1, 1, TILE_HEIGHT * 40, TILE_WIDTH * 32};
+    auto host_tensor = tt::numpy::random::random(shape, DataType::BFLOAT16);
+    auto device_tensor = host_tensor.to(device, Layout::TILE);
+    auto host_tiles = owned_buffer::get_as<bfloat16>(host_tensor.to(Layout::TILE));
+    auto device_tiles = owned_buffer::get_as<bfloat16>(device_tensor.cpu());
+    TT_FATAL(host_tiles == device_tiles, "Tilized upload differs from tilizing on host");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (std::getenv("TT_METAL_SLOW_DISPATCH_MODE") != nullptr) {
+        log_info(LogTest, "Async command queue needs fast dispatch, skipping");
+        return 0;
+    }
+
+    int device_id = 0;
+    auto device = CreateDevice(device_id);
+
+    llrt::OptionsG.set_async_command_queue_enabled(true);
+    test_uncached_ops(device);
+    test_tilized_upload(device);
+    llrt::OptionsG.set_async_command_queue_enabled(false);
+
+    TT_FATAL(CloseDevice(device));
+    log_info(LogTest, "Test Passed");
+    return 0;
+}
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Pins the bfloat8_b values of tilized convolution weights: they are the fp32 weights quantized once, with an exponent
+// shared by each face row of the tilized weight matrix. Does not need a device.
+
+#include <cmath>
+
+#include "common/assert.hpp"
+#include "common/bfloat8.hpp"
+#include "tensor/owned_buffer.hpp"
+#include "tensor/owned_buffer_functions.hpp"
+#include "tensor/tensor.hpp"
+#include "tensor/tensor_utils.hpp"
+
+using namespace tt;
+using namespace tt_metal;
+
+namespace {
+
+// Weights with magnitudes spread over several exponents within every face row, and values just below a power of two
+// whose mantissa rounds up into the next exponent
+Tensor make_conv_weights(const Shape& shape) {
+    std::vector<float> data(compute_volume(shape));
+    for (size_t i = 0; i < data.size(); i++) {
+        float magnitude = std::ldexp(1.0f, int(i % 7) - 3);
+        float value = i % 11 == 0 ? 1.9999f * magnitude : magnitude * (1.0f + float((i * 37) % 64) / 64.0f);
+        data[i] = i % 3 == 0 ? -value : value;
+    }
+    return Tensor(OwnedStorage{owned_buffer::create<float>(std::move(data))}, shape, DataType::FLOAT32, Layout::ROW_MAJOR);
+}
+
+template <typename ConvertFunction>
+void check_bfp8_weights(ConvertFunction convert, const Shape& weight_shape, uint32_t in1_block_h, uint32_t in1_block_w) {
+    auto weights = make_conv_weights(weight_shape);
+    auto bfp8_weights = convert(weights, in1_block_h, in1_block_w, DataType::BFLOAT8_B);
+    auto fp32_weights = convert(weights, in1_block_h, in1_block_w, DataType::FLOAT32);
+    TT_FATAL(bfp8_weights.layout() == Layout::TILE and fp32_weights.layout() == Layout::TILE);
+    TT_FATAL(bfp8_weights.shape()[2] == fp32_weights.shape()[2] and bfp8_weights.shape()[3] == fp32_weights.shape()[3]);
+
+    // The fp32 weights are tilized without rounding, packing them once gives the expected bfloat8_b tiles
+    auto fp32_data = owned_buffer::get_as<float>(fp32_weights);
+    auto expected = pack_fp32_vec_as_bfp8_tiles(fp32_data.begin(), fp32_data.size(), /*row_major_input=*/false, /*is_exp_a=*/false);
+    auto packed = owned_buffer::get_as<uint32_t>(bfp8_weights);
+    TT_FATAL(packed.size() == expected.size(), "There are {} packed words instead of {}", packed.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        TT_FATAL(packed[i] == expected[i], "Packed word {} is {:#x} instead of {:#x}", i, packed[i], expected[i]);
+    }
+
+    // Each value is within one mantissa step of the exponent shared by its face row, rounding can saturate the mantissa
+    auto unpacked = unpack_bfp8_tiles_into_float_vec(expected, /*row_major_output=*/false, /*is_exp_a=*/false);
+    for (size_t row = 0; row < unpacked.size() / 16; row++) {
+        float row_max = 0.0f;
+        for (size_t i = row * 16; i < row * 16 + 16; i++) {
+            row_max = std::max(row_max, std::abs(fp32_data[i]));
+        }
+        int row_exponent;
+        std::frexp(row_max, &row_exponent);
+        float step = std::ldexp(1.0f, row_exponent - 7);
+        for (size_t i = row * 16; i < row * 16 + 16; i++) {
+            TT_FATAL(std::abs(unpacked[i] - fp32_data[i]) <= step, "Value {} is {} instead of {}", i, unpacked[i], fp32_data[i]);
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    // K x C x R x S weights, padded to blocks of the weight matrix
+    check_bfp8_weights(convert_conv_weight_tensor_to_tiled_layout, {64, 3, 3, 3}, 1, 2);
+    check_bfp8_weights(convert_conv_weight_tensor_to_tiled_layout, {40, 16, 3, 3}, 3, 1);
+    check_bfp8_weights(convert_conv_weight_tensor_to_special_padding_tiled_layout, {64, 3, 3, 3}, 1, 2);
+    check_bfp8_weights(convert_conv_weight_tensor_to_special_padding_tiled_layout, {32, 8, 3, 3}, 1, 1);
+
+    log_info(LogTest, "Test Passed");
+    return 0;
+}
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Checks the parallel host pad/unpad against the serial element by element implementation they replaced, for odd
+// and empty shapes and for tensors large enough to be split across executor tasks. Does not need a device.
+
+#include <algorithm>
+#include <numeric>
+
+#include "common/assert.hpp"
+#include "tensor/owned_buffer.hpp"
+#include "tensor/owned_buffer_functions.hpp"
+#include "tensor/tensor.hpp"
+
+using namespace tt;
+using namespace tt_metal;
+
+namespace {
+
+Tensor make_tensor(const Shape& shape) {
+    std::vector<float> data(compute_volume(shape));
+    std::iota(data.begin(), data.end(), 1.0f);
+    return Tensor(OwnedStorage{owned_buffer::create<float>(std::move(data))}, shape, DataType::FLOAT32, Layout::ROW_MAJOR);
+}
+
+std::vector<float> reference_pad(const Tensor& tensor, const Shape& output_shape, const Shape& input_start, float pad_value) {
+    const auto input_shape = tensor.shape();
+    const auto input_strides = tensor.strides();
+    const auto input = owned_buffer::get_as<float>(tensor);
+    std::vector<float> output;
+    output.reserve(compute_volume(output_shape));
+    for (uint32_t dim0 = 0; dim0 < output_shape[0]; dim0++) {
+        for (uint32_t dim1 = 0; dim1 < output_shape[1]; dim1++) {
+            for (uint32_t dim2 = 0; dim2 < output_shape[2]; dim2++) {
+                for (uint32_t dim3 = 0; dim3 < output_shape[3]; dim3++) {
+                    bool is_input = dim0 >= input_start[0] and dim0 < input_start[0] + input_shape[0] and
+                                    dim1 >= input_start[1] and dim1 < input_start[1] + input_shape[1] and
+                                    dim2 >= input_start[2] and dim2 < input_start[2] + input_shape[2] and
+                                    dim3 >= input_start[3] and dim3 < input_start[3] + input_shape[3];
+                    if (not is_input) {
+                        output.push_back(pad_value);
+                        continue;
+                    }
+                    auto input_index = (dim3 - input_start[3]) + input_strides[2] * (dim2 - input_start[2]) +
+                                       input_strides[1] * (dim1 - input_start[1]) + input_strides[0] * (dim0 - input_start[0]);
+                    output.push_back(input[input_index]);
+                }
+            }
+        }
+    }
+    return output;
+}
+
+std::vector<float> reference_unpad(const Tensor& tensor, const Shape& output_start, const Shape& output_end) {
+    const auto input_strides = tensor.strides();
+    const auto input = owned_buffer::get_as<float>(tensor);
+    std::vector<float> output;
+    for (auto dim0 = output_start[0]; dim0 <= output_end[0]; dim0++) {
+        for (auto dim1 = output_start[1]; dim1 <= output_end[1]; dim1++) {
+            for (auto dim2 = output_start[2]; dim2 <= output_end[2]; dim2++) {
+                for (auto dim3 = output_start[3]; dim3 <= output_end[3]; dim3++) {
+                    output.push_back(input[dim3 + input_strides[2] * dim2 + input_strides[1] * dim1 + input_strides[0] * dim0]);
+                }
+            }
+        }
+    }
+    return output;
+}
+
+void check_pad(const Shape& input_shape, const Shape& output_shape, const Shape& input_start) {
+    auto tensor = make_tensor(input_shape);
+    auto padded = tensor.pad(output_shape, input_start, -1.0f);
+    auto padded_data = owned_buffer::get_as<float>(padded);
+    auto expected = reference_pad(tensor, output_shape, input_start, -1.0f);
+    TT_FATAL(padded_data.size() == expected.size(), "Padding gives {} values instead of {}", padded_data.size(), expected.size());
+    TT_FATAL(std::equal(expected.begin(), expected.end(), padded_data.begin()), "Padding differs from the serial result");
+}
+
+void check_unpad(const Shape& input_shape, const Shape& output_start, const Shape& output_end) {
+    auto tensor = make_tensor(input_shape);
+    auto unpadded_data = owned_buffer::get_as<float>(tensor.unpad(output_start, output_end));
+    auto expected = reference_unpad(tensor, output_start, output_end);
+    TT_FATAL(unpadded_data.size() == expected.size(), "Unpadding gives {} values instead of {}", unpadded_data.size(), expected.size());
+    TT_FATAL(std::equal(expected.begin(), expected.end(), unpadded_data.begin()), "Unpadding differs from the serial result");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    // Odd shapes and offsets
+    check_pad({1, 1, 1, 1}, {1, 1, 32, 32}, {0, 0, 0, 0});
+    check_pad({2, 3, 5, 7}, {3, 4, 9, 13}, {1, 0, 2, 3});
+    check_pad({1, 1, 31, 33}, {2, 2, 32, 64}, {1, 1, 1, 31});
+    // Split across several executor tasks
+    check_pad({3, 5, 255, 127}, {4, 5, 257, 129}, {0, 0, 1, 1});
+
+    // Empty input, all padding
+    check_pad({1, 1, 0, 5}, {1, 2, 3, 8}, {0, 0, 0, 0});
+    check_pad({1, 1, 4, 0}, {1, 1, 4, 3}, {0, 0, 0, 1});
+    // Empty output
+    check_pad({1, 1, 4, 0}, {1, 1, 4, 0}, {0, 0, 0, 0});
+    check_pad({0, 3, 4, 5}, {0, 3, 4, 7}, {0, 0, 0, 0});
+
+    check_unpad({1, 1, 1, 1}, {0, 0, 0, 0}, {0, 0, 0, 0});
+    check_unpad({2, 3, 5, 7}, {1, 1, 2, 3}, {1, 2, 4, 5});
+    check_unpad({3, 5, 257, 129}, {0, 0, 1, 1}, {2, 4, 255, 127});
+
+    log_info(LogTest, "Test Passed");
+    return 0;
+}
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Checks that tilizing a ROW_MAJOR tensor on its way to the device gives the same device tensor as tilizing it on host
+// first. The staging chunks are made small so that most uploads are split into several chunks, with a partial last one.
+
+#include <cstdlib>
+
+#include "common/constants.hpp"
+#include "tt_metal/llrt/rtoptions.hpp"
+#include "tensor/owned_buffer.hpp"
+#include "tensor/owned_buffer_functions.hpp"
+#include "tensor/tensor.hpp"
+#include "tt_numpy/functions.hpp"
+
+using namespace tt;
+using namespace tt_metal;
+using namespace constants;
+
+namespace {
+
+// Three rows of tiles of a 64 wide BFLOAT16 tensor
+constexpr uint32_t CHUNK_SIZE_BYTES = 3 * TILE_HEIGHT * 64 * sizeof(bfloat16);
+
+void check_tilized_upload(Device* device, const Shape& shape) {
+    auto host_tensor = tt::numpy::random::random(shape, DataType::BFLOAT16);
+    auto tilized_on_upload = host_tensor.to(device, Layout::TILE);
+    auto tilized_on_host = host_tensor.to(Layout::TILE).to(device);
+    TT_FATAL(tilized_on_upload.layout() == Layout::TILE and tilized_on_upload.shape() == shape);
+
+    auto expected = owned_buffer::get_as<bfloat16>(host_tensor.to(Layout::TILE));
+    TT_FATAL(owned_buffer::get_as<bfloat16>(tilized_on_host.cpu()) == expected);
+    TT_FATAL(owned_buffer::get_as<bfloat16>(tilized_on_upload.cpu()) == expected, "Tilized upload differs from tilizing on host");
+}
+
+void check_tilized_uploads(Device* device) {
+    // Four chunks, the last one with a single row of tiles
+    check_tilized_upload(device, {2, 1, TILE_HEIGHT * 5, 64});
+    // Two rows of tiles per chunk
+    check_tilized_upload(device, {1, 3, TILE_HEIGHT * 2, 96});
+    // A row of tiles larger than a chunk still goes in one chunk
+    check_tilized_upload(device, {1, 1, TILE_HEIGHT * 2, TILE_WIDTH * 64});
+    // Fits in one chunk
+    check_tilized_upload(device, {1, 1, TILE_HEIGHT * 3, TILE_WIDTH});
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    // Read by the first upload
+    setenv("TT_METAL_TILIZED_UPLOAD_CHUNK_SIZE", std::to_string(CHUNK_SIZE_BYTES).c_str(), 1);
+
+    int device_id = 0;
+    auto device = CreateDevice(device_id);
+
+    check_tilized_uploads(device);
+    if (std::getenv("TT_METAL_SLOW_DISPATCH_MODE") == nullptr) {
+        llrt::OptionsG.set_async_command_queue_enabled(true);
+        check_tilized_uploads(device);
+        llrt::OptionsG.set_async_command_queue_enabled(false);
+    }
+
+    TT_FATAL(CloseDevice(device));
+    log_info(LogTest, "Test Passed");
+    return 0;
+}
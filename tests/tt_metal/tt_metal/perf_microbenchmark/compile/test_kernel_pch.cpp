@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <optional>
+
+#include "common/test_common.hpp"
+#include "tt_metal/host_api.hpp"
+#include "tt_metal/detail/kernel_cache.hpp"
+#include "tt_metal/detail/tt_metal.hpp"
+#include "tt_metal/llrt/rtoptions.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Compares kernel compile times with and without the precompiled firmware header
+//
+// Compiles every kernel under <root>/*/kernels (by default the tt_dnn op library) on its own, once with the PCH
+// disabled and once enabled, and reports the time taken by CompileProgram for each. Kernels are given
+// MAX_COMPILE_ARGS compile time args of 1, kernels that need defines or other args fail to compile and are skipped.
+// The binary cache must be off or every compile after the first is a cache hit.
+//////////////////////////////////////////////////////////////////////////////////////////
+using namespace tt;
+using namespace tt::tt_metal;
+using std::chrono::duration;
+using std::chrono::steady_clock;
+
+constexpr uint32_t MAX_COMPILE_ARGS = 32;
+
+namespace fs = std::filesystem;
+
+struct KernelSource {
+    std::string path;  // Relative to TT_METAL_HOME
+    bool is_compute;
+};
+
+std::vector<KernelSource> find_kernels(const std::string &root, const std::string &kernel_root, uint32_t max_kernels) {
+    std::vector<KernelSource> kernels;
+    for (const auto &op_dir : fs::directory_iterator(root + kernel_root)) {
+        fs::path kernel_dir = op_dir.path() / "kernels";
+        if (not fs::is_directory(kernel_dir)) {
+            continue;
+        }
+        for (const auto &entry : fs::recursive_directory_iterator(kernel_dir)) {
+            if (entry.path().extension() != ".cpp") {
+                continue;
+            }
+            std::ifstream file(entry.path());
+            std::string source((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+            // Compute kernels are wrapped in the NAMESPACE the trisc builds define
+            bool is_compute = source.find("namespace NAMESPACE") != std::string::npos;
+            kernels.push_back({fs::relative(entry.path(), root).string(), is_compute});
+        }
+    }
+    std::sort(kernels.begin(), kernels.end(), [](const auto &a, const auto &b) { return a.path < b.path; });
+    if (kernels.size() > max_kernels) {
+        kernels.resize(max_kernels);
+    }
+    return kernels;
+}
+
+void clear_kernel_cache(Device *device) {
+    fs::remove_all(jit_build_get_kernel_compile_outpath(device->id()));
+    detail::HashLookup::inst().clear();
+}
+
+// Returns the time CompileProgram took in ms, or nothing if the kernel doesn't compile on its own
+std::optional<double> compile_kernel(Device *device, const KernelSource &kernel) {
+    CoreCoord core = {0, 0};
+    std::vector<uint32_t> compile_args(MAX_COMPILE_ARGS, 1);
+    Program program = CreateProgram();
+    if (kernel.is_compute) {
+        CreateKernel(program, kernel.path, core, ComputeConfig{.compile_args = compile_args});
+    } else {
+        CreateKernel(program, kernel.path, core, DataMovementConfig{.processor = DataMovementProcessor::RISCV_0, .noc = NOC::RISCV_0_default, .compile_args = compile_args});
+    }
+
+    auto begin = steady_clock::now();
+    try {
+        detail::CompileProgram(device, program);
+    } catch (const std::exception &e) {
+        return std::nullopt;
+    }
+    return duration<double, std::milli>(steady_clock::now() - begin).count();
+}
+
+int main(int argc, char **argv) {
+    std::vector<std::string> input_args(argv, argv + argc);
+    if (test_args::has_command_option(input_args, "-h") || test_args::has_command_option(input_args, "--help")) {
+        log_info(LogTest, "Usage:");
+        log_info(LogTest, "  --kernel-root: directory of ops with kernels/ subdirectories (default tt_eager/tt_dnn/op_library)");
+        log_info(LogTest, "  -n: most kernels to compile (default all)");
+        exit(0);
+    }
+    std::string kernel_root = test_args::get_command_option(input_args, "--kernel-root", "tt_eager/tt_dnn/op_library");
+    uint32_t max_kernels = test_args::get_command_option_uint32(input_args, "-n", std::numeric_limits<uint32_t>::max());
+
+    TT_FATAL(llrt::OptionsG.get_kernel_binary_cache_dir().empty(), "Unset TT_METAL_KERNEL_BINARY_CACHE_DIR, cache hits would be timed");
+
+    bool pass = true;
+    try {
+        Device *device = CreateDevice(0);
+        std::vector<KernelSource> kernels = find_kernels(llrt::OptionsG.get_root_dir(), kernel_root, max_kernels);
+        log_info(LogTest, "Compiling {} kernels under {}", kernels.size(), kernel_root);
+
+        // Warm the file system cache so the first mode isn't penalized
+        llrt::OptionsG.set_kernel_pch_enabled(false);
+        for (const auto &kernel : kernels) {
+            clear_kernel_cache(device);
+            compile_kernel(device, kernel);
+        }
+
+        std::vector<std::optional<double>> no_pch_ms;
+        for (const auto &kernel : kernels) {
+            clear_kernel_cache(device);
+            no_pch_ms.push_back(compile_kernel(device, kernel));
+        }
+
+        // The first compile with the PCH enabled also builds it, time that apart from the kernels
+        llrt::OptionsG.set_kernel_pch_enabled(true);
+        double pch_build_ms = 0;
+        for (bool is_compute : {false, true}) {
+            auto kernel = std::find_if(kernels.begin(), kernels.end(), [&](const auto &k) {
+                return k.is_compute == is_compute and no_pch_ms[&k - kernels.data()].has_value();
+            });
+            if (kernel != kernels.end()) {
+                clear_kernel_cache(device);
+                pch_build_ms += compile_kernel(device, *kernel).value_or(0);
+            }
+        }
+
+        std::vector<std::optional<double>> pch_ms;
+        for (const auto &kernel : kernels) {
+            clear_kernel_cache(device);
+            pch_ms.push_back(compile_kernel(device, kernel));
+        }
+
+        double total_no_pch_ms = 0;
+        double total_pch_ms = 0;
+        uint32_t num_compiled = 0;
+        log_info(LogTest, "{:>10} {:>10} {:>8}  kernel", "no pch ms", "pch ms", "speedup");
+        for (size_t i = 0; i < kernels.size(); i++) {
+            if (not no_pch_ms[i].has_value() or not pch_ms[i].has_value()) {
+                log_info(LogTest, "{:>10} {:>10} {:>8}  {}", "-", "-", "-", kernels[i].path);
+                continue;
+            }
+            log_info(LogTest, "{:>10.1f} {:>10.1f} {:>7.2f}x  {}", no_pch_ms[i].value(), pch_ms[i].value(), no_pch_ms[i].value() / pch_ms[i].value(), kernels[i].path);
+            total_no_pch_ms += no_pch_ms[i].value();
+            total_pch_ms += pch_ms[i].value();
+            num_compiled++;
+        }
+        log_info(LogTest, "Compiled {} of {} kernels, skipped the rest which need defines or other compile time args", num_compiled, kernels.size());
+        log_info(LogTest, "Total: {:.1f} ms without the PCH, {:.1f} ms with it ({:.2f}x), plus {:.1f} ms for the first compile that builds it",
+                 total_no_pch_ms, total_pch_ms, total_pch_ms > 0 ? total_no_pch_ms / total_pch_ms : 0.0, pch_build_ms);
+
+        pass &= CloseDevice(device);
+    } catch (const std::exception &e) {
+        pass = false;
+        log_error(LogTest, "{}", e.what());
+    }
+
+    if (pass) {
+        log_info(LogTest, "Test Passed");
+    } else {
+        log_fatal(LogTest, "Test Failed");
+    }
+    return pass ? 0 : 1;
+}
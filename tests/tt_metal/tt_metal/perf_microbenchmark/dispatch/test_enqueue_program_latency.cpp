@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <chrono>
+
+#include "tt_metal/host_api.hpp"
+#include "tt_metal/detail/tt_metal.hpp"
+#include "tt_metal/llrt/rtoptions.hpp"
+
+constexpr uint32_t DEFAULT_ITERATIONS = 1000;
+constexpr uint32_t DEFAULT_ARGS = 16;
+constexpr uint32_t MAX_ARGS = 255;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Test host enqueue latency of programs with 1, 10 and 100 kernels
+//
+// Kernels are data movement kernels placed two per core, on brisc and ncrisc. For each program this times the
+// first EnqueueProgram, which builds the program's dispatch map, then the cached enqueues with the same runtime
+// args and with new runtime arg values on every enqueue. Only the host side of EnqueueProgram is timed, the
+// device runs null kernels and is drained with Finish outside the timer.
+//////////////////////////////////////////////////////////////////////////////////////////
+using namespace tt;
+using std::chrono::duration;
+using std::chrono::steady_clock;
+
+uint32_t iterations_g = DEFAULT_ITERATIONS;
+uint32_t n_args_g = DEFAULT_ARGS;
+
+void init(int argc, char **argv) {
+    std::vector<std::string> input_args(argv, argv + argc);
+
+    if (test_args::has_command_option(input_args, "-h") ||
+        test_args::has_command_option(input_args, "--help")) {
+        log_info(LogTest, "Usage:");
+        log_info(LogTest, "  -i: iterations (default {})", DEFAULT_ITERATIONS);
+        log_info(LogTest, "  -a: number of runtime args per kernel (default {}, max {})", DEFAULT_ARGS, MAX_ARGS);
+        exit(0);
+    }
+
+    iterations_g = test_args::get_command_option_uint32(input_args, "-i", DEFAULT_ITERATIONS);
+    n_args_g = test_args::get_command_option_uint32(input_args, "-a", DEFAULT_ARGS);
+    if (n_args_g > MAX_ARGS) {
+        log_fatal("Runtime arg count must be 0..{}", MAX_ARGS);
+        exit(0);
+    }
+}
+
+// Returns each kernel with the core it is placed on
+std::vector<std::pair<tt_metal::KernelHandle, CoreCoord>> create_kernels(tt_metal::Device *device, tt_metal::Program &program, uint32_t num_kernels) {
+    CoreCoord grid_size = device->compute_with_storage_grid_size();
+    TT_FATAL(num_kernels <= 2 * grid_size.x * grid_size.y, "{} kernels don't fit on the {} grid", num_kernels, grid_size.str());
+
+    std::vector<std::pair<tt_metal::KernelHandle, CoreCoord>> kernels;
+    std::map<string, string> defines = {{"KERNEL_BYTES", "32"}};
+    for (uint32_t i = 0; i < num_kernels; i++) {
+        uint32_t core_idx = i / 2;
+        CoreCoord core = {core_idx % grid_size.x, core_idx / grid_size.x};
+        bool riscv_0 = i % 2 == 0;
+        auto kernel = tt_metal::CreateKernel(
+            program,
+            "tests/tt_metal/tt_metal/perf_microbenchmark/dispatch/kernels/pgm_dispatch_perf.cpp",
+            core,
+            tt_metal::DataMovementConfig{
+                .processor = riscv_0 ? tt_metal::DataMovementProcessor::RISCV_0 : tt_metal::DataMovementProcessor::RISCV_1,
+                .noc = riscv_0 ? tt_metal::NOC::RISCV_0_default : tt_metal::NOC::RISCV_1_default,
+                .defines = defines});
+        tt_metal::SetRuntimeArgs(program, kernel, core, std::vector<uint32_t>(n_args_g, 0));
+        kernels.push_back({kernel, core});
+    }
+    return kernels;
+}
+
+// Host time of one EnqueueProgram in us
+double time_enqueue(CommandQueue &cq, tt_metal::Program &program) {
+    auto start = steady_clock::now();
+    EnqueueProgram(cq, program, false);
+    return duration<double, std::micro>(steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv) {
+    init(argc, argv);
+
+    tt::llrt::OptionsG.set_kernels_nullified(true);
+
+    bool pass = true;
+    try {
+        int device_id = 0;
+        tt_metal::Device *device = tt_metal::CreateDevice(device_id);
+
+        CommandQueue& cq = tt::tt_metal::detail::GetCommandQueue(device);
+
+        log_info(LogTest, "Args per kernel: {}", n_args_g);
+        log_info(LogTest, "{:>8} {:>14} {:>14} {:>14}", "kernels", "first us", "cached us", "new args us");
+        for (uint32_t num_kernels : {1, 10, 100}) {
+            tt_metal::Program program = tt_metal::CreateProgram();
+            auto kernels = create_kernels(device, program, num_kernels);
+            tt_metal::detail::CompileProgram(device, program);
+
+            double first_us = time_enqueue(cq, program);
+            Finish(cq);
+
+            double cached_us = 0;
+            for (uint32_t i = 0; i < iterations_g; i++) {
+                cached_us += time_enqueue(cq, program);
+            }
+            Finish(cq);
+
+            // Setting the args is outside the timer, only the enqueue of the updated program is measured
+            double new_args_us = 0;
+            std::vector<uint32_t> args(n_args_g);
+            for (uint32_t i = 0; i < iterations_g; i++) {
+                std::fill(args.begin(), args.end(), i);
+                for (const auto &[kernel, core] : kernels) {
+                    tt_metal::SetRuntimeArgs(program, kernel, core, args);
+                }
+                new_args_us += time_enqueue(cq, program);
+            }
+            Finish(cq);
+
+            log_info(LogTest, "{:>8} {:>14.2f} {:>14.2f} {:>14.2f}", num_kernels, first_us, cached_us / iterations_g, new_args_us / iterations_g);
+        }
+
+        pass &= tt_metal::CloseDevice(device);
+    } catch (const std::exception& e) {
+        pass = false;
+        log_fatal(e.what());
+    }
+
+    tt::llrt::OptionsG.set_kernels_nullified(false);
+
+    if (pass) {
+        log_info(LogTest, "Test Passed");
+    } else {
+        TT_THROW("Test Failed");
+    }
+
+    return 0;
+}
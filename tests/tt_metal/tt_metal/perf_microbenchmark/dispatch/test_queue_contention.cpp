@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "common/test_common.hpp"
+#include "tt_metal/impl/dispatch/lock_free_queue.hpp"
+#include "tt_metal/impl/dispatch/thread_safe_queue.hpp"
+
+constexpr uint32_t DEFAULT_ELEMENTS = 1 << 22;
+constexpr uint32_t DEFAULT_CAPACITY = 1024;
+constexpr uint32_t DEFAULT_BATCH = 16;
+constexpr uint32_t DEFAULT_MAX_PRODUCERS = 4;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Compares producer to consumer throughput of TSQueue and the lock-free dispatch queues
+//
+// For 1, 2, 4 ... producer threads, each queue moves the same total number of elements to one consumer thread,
+// one element at a time and then in batches for the lock-free queues. The SPSC ring only runs with one producer.
+// Host only, no device is opened.
+//////////////////////////////////////////////////////////////////////////////////////////
+using namespace tt;
+using namespace tt::tt_metal;
+using std::chrono::duration;
+using std::chrono::steady_clock;
+
+uint32_t num_elements_g = DEFAULT_ELEMENTS;
+uint32_t capacity_g = DEFAULT_CAPACITY;
+uint32_t batch_g = DEFAULT_BATCH;
+uint32_t max_producers_g = DEFAULT_MAX_PRODUCERS;
+bool spin_g = false;
+
+void init(int argc, char **argv) {
+    std::vector<std::string> input_args(argv, argv + argc);
+
+    if (test_args::has_command_option(input_args, "-h") ||
+        test_args::has_command_option(input_args, "--help")) {
+        log_info(LogTest, "Usage:");
+        log_info(LogTest, "  -n: total elements moved per run (default {})", DEFAULT_ELEMENTS);
+        log_info(LogTest, "  -c: queue capacity (default {})", DEFAULT_CAPACITY);
+        log_info(LogTest, "  -b: batch size (default {})", DEFAULT_BATCH);
+        log_info(LogTest, "  -p: most producer threads (default {})", DEFAULT_MAX_PRODUCERS);
+        log_info(LogTest, "  -s: lock-free queues only spin, never park");
+        exit(0);
+    }
+
+    num_elements_g = test_args::get_command_option_uint32(input_args, "-n", DEFAULT_ELEMENTS);
+    capacity_g = test_args::get_command_option_uint32(input_args, "-c", DEFAULT_CAPACITY);
+    batch_g = test_args::get_command_option_uint32(input_args, "-b", DEFAULT_BATCH);
+    max_producers_g = test_args::get_command_option_uint32(input_args, "-p", DEFAULT_MAX_PRODUCERS);
+    spin_g = test_args::has_command_option(input_args, "-s");
+}
+
+// Runs the producers and the consumer, each producer pushes num_elements / num_producers of them. Returns millions
+// of elements per second, or 0 if the consumer didn't get every element exactly once.
+double run(uint32_t num_producers, const std::function<void(uint32_t, uint64_t, uint64_t)> &produce, const std::function<uint64_t(uint64_t)> &consume) {
+    uint64_t num_per_producer = num_elements_g / num_producers;
+    uint64_t num_elements = num_per_producer * num_producers;
+
+    auto start = steady_clock::now();
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < num_producers; p++) {
+        producers.emplace_back(produce, p, p * num_per_producer, num_per_producer);
+    }
+    uint64_t sum = consume(num_elements);
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    double seconds = duration<double>(steady_clock::now() - start).count();
+
+    if (sum != num_elements * (num_elements - 1) / 2) {
+        log_error(LogTest, "Consumer got the wrong elements");
+        return 0;
+    }
+    return num_elements / seconds / 1e6;
+}
+
+double run_ts_queue(uint32_t num_producers) {
+    TSQueue<uint64_t> queue(capacity_g);
+    return run(
+        num_producers,
+        [&](uint32_t, uint64_t first, uint64_t n) {
+            for (uint64_t e = first; e < first + n; e++) {
+                queue.push(e);
+            }
+        },
+        [&](uint64_t n) {
+            uint64_t sum = 0;
+            for (uint64_t i = 0; i < n; i++) {
+                sum += queue.peek();
+                queue.pop();
+            }
+            return sum;
+        });
+}
+
+template <class Queue>
+double run_lock_free_queue(uint32_t num_producers, uint32_t batch_size) {
+    Queue queue(capacity_g, spin_g ? LockFreeQueueWaitMode::SPIN : LockFreeQueueWaitMode::SPIN_THEN_PARK);
+    return run(
+        num_producers,
+        [&](uint32_t, uint64_t first, uint64_t n) {
+            std::vector<uint64_t> batch(batch_size);
+            for (uint64_t e = first; e < first + n;) {
+                uint64_t batch_end = std::min<uint64_t>(e + batch_size, first + n);
+                uint64_t num_in_batch = batch_end - e;
+                for (uint64_t i = 0; i < num_in_batch; i++) {
+                    batch[i] = e + i;
+                }
+                if (num_in_batch == 1) {
+                    queue.push(batch[0]);
+                } else {
+                    queue.push_batch(batch.data(), num_in_batch);
+                }
+                e = batch_end;
+            }
+        },
+        [&](uint64_t n) {
+            uint64_t sum = 0;
+            std::vector<uint64_t> batch(batch_size);
+            for (uint64_t num_popped = 0; num_popped < n;) {
+                size_t num_in_batch = queue.pop_batch(batch.data(), batch_size);
+                for (size_t i = 0; i < num_in_batch; i++) {
+                    sum += batch[i];
+                }
+                num_popped += num_in_batch;
+            }
+            return sum;
+        });
+}
+
+int main(int argc, char **argv) {
+    init(argc, argv);
+
+    bool pass = true;
+    log_info(LogTest, "Elements: {}, capacity: {}, batch: {}, wait: {}", num_elements_g, capacity_g, batch_g, spin_g ? "spin" : "spin then park");
+    log_info(LogTest, "{:>9} {:>10} {:>10} {:>16} {:>10} {:>16}", "producers", "TSQueue", "SPSC", "SPSC batched", "MPSC", "MPSC batched");
+    for (uint32_t num_producers = 1; num_producers <= max_producers_g; num_producers *= 2) {
+        double ts_queue = run_ts_queue(num_producers);
+        double spsc = num_producers == 1 ? run_lock_free_queue<LockFreeSPSCQueue<uint64_t>>(1, 1) : -1;
+        double spsc_batched = num_producers == 1 ? run_lock_free_queue<LockFreeSPSCQueue<uint64_t>>(1, batch_g) : -1;
+        double mpsc = run_lock_free_queue<LockFreeMPSCQueue<uint64_t>>(num_producers, 1);
+        double mpsc_batched = run_lock_free_queue<LockFreeMPSCQueue<uint64_t>>(num_producers, batch_g);
+        pass &= ts_queue != 0 and spsc != 0 and spsc_batched != 0 and mpsc != 0 and mpsc_batched != 0;
+
+        auto format = [](double mops) { return mops < 0 ? std::string("-") : fmt::format("{:.2f}", mops); };
+        log_info(LogTest, "{:>9} {:>10} {:>10} {:>16} {:>10} {:>16}   M elements/s",
+                 num_producers, format(ts_queue), format(spsc), format(spsc_batched), format(mpsc), format(mpsc_batched));
+    }
+
+    if (pass) {
+        log_info(LogTest, "Test Passed");
+    } else {
+        TT_THROW("Test Failed");
+    }
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Host-only microbenchmark for bank allocator churn.
+// Keeps a working set of live buffers in one bank and replaces random buffers with new ones of random size,
+// the way many small intermediate tensors come and go during model execution. Compares FreeList against
+// IndexedFreeList and checks that both place every buffer at the same address.
+
+#include <chrono>
+#include <memory>
+#include <random>
+
+#include "common/test_common.hpp"
+#include "tt_metal/host_api.hpp"
+#include "tt_metal/impl/allocator/algorithms/free_list.hpp"
+#include "tt_metal/impl/allocator/algorithms/indexed_free_list.hpp"
+
+using namespace tt;
+using namespace tt::tt_metal;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+namespace {
+
+struct ChurnResult {
+    double ns_per_operation;
+    std::vector<std::optional<uint64_t>> addresses;
+};
+
+ChurnResult run_churn(
+    allocator::Algorithm& algorithm, uint32_t num_live_buffers, uint32_t num_operations, uint64_t max_buffer_size_bytes, uint64_t alignment) {
+    std::mt19937 rng(0);
+    auto random_size = [&] { return alignment * (1 + rng() % (max_buffer_size_bytes / alignment)); };
+
+    ChurnResult result;
+    result.addresses.reserve(num_live_buffers + num_operations);
+    std::vector<uint64_t> live_buffers;
+    live_buffers.reserve(num_live_buffers);
+
+    auto begin = steady_clock::now();
+    // Fill the bank from both ends like DRAM (bottom up) and L1 (top down) buffers do
+    for (uint32_t i = 0; i < num_live_buffers; i++) {
+        auto address = algorithm.allocate(random_size(), /*bottom_up=*/i % 2 == 0);
+        result.addresses.push_back(address);
+        if (address.has_value()) {
+            live_buffers.push_back(address.value());
+        }
+    }
+    for (uint32_t i = 0; i < num_operations and not live_buffers.empty(); i++) {
+        uint32_t index = rng() % live_buffers.size();
+        algorithm.deallocate(live_buffers[index]);
+        live_buffers[index] = live_buffers.back();
+        live_buffers.pop_back();
+
+        auto address = algorithm.allocate(random_size(), /*bottom_up=*/rng() % 2 == 0);
+        result.addresses.push_back(address);
+        if (address.has_value()) {
+            live_buffers.push_back(address.value());
+        }
+    }
+    auto elapsed_ns = duration_cast<nanoseconds>(steady_clock::now() - begin).count();
+    result.ns_per_operation = static_cast<double>(elapsed_ns) / (num_live_buffers + 2 * num_operations);
+    return result;
+}
+
+bool run_benchmark(
+    allocator::FreeList::SearchPolicy search_policy, const std::string& policy_name, uint64_t bank_size_bytes,
+    uint32_t num_live_buffers, uint32_t num_operations, uint64_t max_buffer_size_bytes) {
+    constexpr uint64_t min_allocation_size_bytes = 32;
+    constexpr uint64_t alignment = 32;
+    allocator::FreeList free_list(bank_size_bytes, 0, min_allocation_size_bytes, alignment, search_policy);
+    allocator::IndexedFreeList indexed_free_list(bank_size_bytes, 0, min_allocation_size_bytes, alignment, search_policy);
+
+    auto reference = run_churn(free_list, num_live_buffers, num_operations, max_buffer_size_bytes, alignment);
+    auto indexed = run_churn(indexed_free_list, num_live_buffers, num_operations, max_buffer_size_bytes, alignment);
+
+    log_info(LogTest, "{:>5} fit, {} live buffers: FreeList {:.1f}ns/op, IndexedFreeList {:.1f}ns/op ({:.1f}x)",
+             policy_name, num_live_buffers, reference.ns_per_operation, indexed.ns_per_operation,
+             reference.ns_per_operation / indexed.ns_per_operation);
+
+    bool pass = reference.addresses == indexed.addresses;
+    if (not pass) {
+        log_error(LogTest, "{} fit: IndexedFreeList placed buffers at different addresses than FreeList", policy_name);
+    }
+    return pass;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    bool pass = true;
+
+    try {
+        std::vector<std::string> input_args(argv, argv + argc);
+        uint32_t num_operations;
+        uint32_t max_buffer_size_kb;
+        uint32_t bank_size_mb;
+        std::tie(num_operations, input_args) = test_args::get_command_option_uint32_and_remaining_args(input_args, "--num-ops", 20000);
+        std::tie(max_buffer_size_kb, input_args) = test_args::get_command_option_uint32_and_remaining_args(input_args, "--max-buffer-size-kb", 64);
+        std::tie(bank_size_mb, input_args) = test_args::get_command_option_uint32_and_remaining_args(input_args, "--bank-size-mb", 1024);
+        const uint64_t bank_size_bytes = static_cast<uint64_t>(bank_size_mb) * 1024 * 1024;
+        const uint64_t max_buffer_size_bytes = static_cast<uint64_t>(max_buffer_size_kb) * 1024;
+        TT_FATAL(max_buffer_size_bytes >= 32, "--max-buffer-size-kb must be at least 1");
+
+        for (uint32_t num_live_buffers : {100, 1000, 10000}) {
+            pass &= run_benchmark(allocator::FreeList::SearchPolicy::FIRST, "first", bank_size_bytes, num_live_buffers, num_operations, max_buffer_size_bytes);
+            pass &= run_benchmark(allocator::FreeList::SearchPolicy::BEST, "best", bank_size_bytes, num_live_buffers, num_operations, max_buffer_size_bytes);
+        }
+    } catch (const std::exception& e) {
+        pass = false;
+        log_error(LogTest, "{}", e.what());
+    }
+
+    if (pass) {
+        log_info(LogTest, "Test Passed");
+    } else {
+        TT_THROW("Test Failed");
+    }
+
+    TT_FATAL(pass);
+    return 0;
+}
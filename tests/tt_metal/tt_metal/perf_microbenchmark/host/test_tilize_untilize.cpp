@@ -0,0 +1,163 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Host-only microbenchmark for row-major <-> tile layout conversion.
+// Compares the vectorized engine in tile_transpose.hpp against the element-by-element reference
+// it replaced, for every element type the engine supports.
+
+#include <chrono>
+#include <functional>
+#include <random>
+
+#include "common/bfloat16.hpp"
+#include "common/test_common.hpp"
+#include "common/tile_transpose.hpp"
+#include "tt_metal/host_api.hpp"
+
+using namespace tt;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+namespace {
+
+// Previous implementation of convert_layout(LIN_ROW_MAJOR -> TILED32_4FACES), kept as the baseline
+template <typename T>
+std::vector<T> reference_tilize(const std::vector<T>& data, uint32_t height, uint32_t width) {
+    std::vector<T> swizzled;
+    for (uint32_t hs32 = 0; hs32 < height; hs32 += 32)
+    for (uint32_t ws32 = 0; ws32 < width; ws32 += 32)
+    for (uint32_t h32 = 0; h32 < 32; h32++)
+    for (uint32_t w32 = 0; w32 < 32; w32++) {
+        swizzled.push_back(data[(hs32 + h32) * width + ws32 + w32]);
+    }
+
+    std::vector<T> result;
+    for (uint32_t tile_idx = 0; tile_idx < swizzled.size() / (32 * 32); tile_idx++) {
+        std::vector<T> faces[4];
+        uint32_t index = tile_idx * (32 * 32);
+        for (uint32_t row = 0; row < 32; row++) {
+            for (uint32_t col = 0; col < 32; col++) {
+                faces[(row / 16) * 2 + (col / 16)].push_back(swizzled[index++]);
+            }
+        }
+        for (const auto& face : faces) {
+            result.insert(result.end(), face.begin(), face.end());
+        }
+    }
+    return result;
+}
+
+// Previous implementation of convert_layout(TILED32_4FACES -> LIN_ROW_MAJOR), kept as the baseline
+template <typename T>
+std::vector<T> reference_untilize(const std::vector<T>& data, uint32_t height, uint32_t width) {
+    std::vector<T> swizzled;
+    for (uint32_t tile_idx = 0; tile_idx < data.size() / (32 * 32); tile_idx++) {
+        uint32_t tile_start = tile_idx * (32 * 32);
+        for (uint32_t face_y = 0; face_y < 2; face_y++) {
+            for (uint32_t row = 0; row < 16; row++) {
+                uint32_t start = tile_start + face_y * (16 * 32) + row * 16;
+                for (uint32_t face_x = 0; face_x < 2; face_x++) {
+                    for (uint32_t col = face_x * 256; col < face_x * 256 + 16; col++) {
+                        swizzled.push_back(data[start + col]);
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<T> result(data.size());
+    uint32_t linear = 0;
+    for (uint32_t hs32 = 0; hs32 < height; hs32 += 32)
+    for (uint32_t ws32 = 0; ws32 < width; ws32 += 32)
+    for (uint32_t h32 = 0; h32 < 32; h32++)
+    for (uint32_t w32 = 0; w32 < 32; w32++) {
+        result[(hs32 + h32) * width + ws32 + w32] = swizzled[linear++];
+    }
+    return result;
+}
+
+double measure_gbps(const std::function<void()>& func, uint64_t num_bytes, uint32_t iter) {
+    func();  // warm-up
+    auto begin = steady_clock::now();
+    for (uint32_t i = 0; i < iter; i++) {
+        func();
+    }
+    auto elapsed_ns = duration_cast<nanoseconds>(steady_clock::now() - begin).count() / iter;
+    // Every byte is read once and written once
+    return (2.0 * num_bytes) / elapsed_ns;
+}
+
+template <typename T>
+bool run_benchmark(const std::string& type_name, uint32_t height, uint32_t width, uint32_t iter) {
+    std::mt19937 rng(0);
+    std::vector<T> input(static_cast<size_t>(height) * width);
+    for (auto& datum : input) {
+        datum = static_cast<T>(static_cast<uint32_t>(rng()));
+    }
+    const uint64_t num_bytes = input.size() * sizeof(T);
+
+    std::vector<T> tiled(input.size());
+    std::vector<T> row_major(input.size());
+    std::vector<T> reference_tiled;
+    std::vector<T> reference_row_major;
+
+    double reference_tilize_gbps =
+        measure_gbps([&] { reference_tiled = reference_tilize(input, height, width); }, num_bytes, iter);
+    double tilize_gbps = measure_gbps(
+        [&] { tile_transpose::tilize(input.data(), tiled.data(), height, width); }, num_bytes, iter);
+    double reference_untilize_gbps =
+        measure_gbps([&] { reference_row_major = reference_untilize(tiled, height, width); }, num_bytes, iter);
+    double untilize_gbps = measure_gbps(
+        [&] { tile_transpose::untilize(tiled.data(), row_major.data(), height, width); }, num_bytes, iter);
+
+    log_info(LogTest, "{:>9} {}x{} tilize:   reference {:.3f}GB/s, engine {:.3f}GB/s ({:.1f}x)",
+             type_name, height, width, reference_tilize_gbps, tilize_gbps, tilize_gbps / reference_tilize_gbps);
+    log_info(LogTest, "{:>9} {}x{} untilize: reference {:.3f}GB/s, engine {:.3f}GB/s ({:.1f}x)",
+             type_name, height, width, reference_untilize_gbps, untilize_gbps, untilize_gbps / reference_untilize_gbps);
+
+    auto bitwise_equal = [](const std::vector<T>& a, const std::vector<T>& b) {
+        return a.size() == b.size() and std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+    };
+    bool pass = bitwise_equal(tiled, reference_tiled);
+    pass &= bitwise_equal(row_major, reference_row_major);
+    pass &= bitwise_equal(row_major, input);
+    if (not pass) {
+        log_error(LogTest, "{} {}x{} output does not match the reference", type_name, height, width);
+    }
+    return pass;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    bool pass = true;
+
+    try {
+        std::vector<std::string> input_args(argv, argv + argc);
+        uint32_t iter;
+        uint32_t height;
+        uint32_t width;
+        std::tie(iter, input_args) = test_args::get_command_option_uint32_and_remaining_args(input_args, "--iter", 10);
+        std::tie(height, input_args) = test_args::get_command_option_uint32_and_remaining_args(input_args, "--height", 2048);
+        std::tie(width, input_args) = test_args::get_command_option_uint32_and_remaining_args(input_args, "--width", 4096);
+        TT_FATAL(height % 32 == 0 and width % 32 == 0, "--height and --width must be multiples of 32");
+
+        pass &= run_benchmark<bfloat16>("bfloat16", height, width, iter);
+        pass &= run_benchmark<float>("float32", height, width, iter);
+        pass &= run_benchmark<uint32_t>("uint32", height, width, iter);
+    } catch (const std::exception& e) {
+        pass = false;
+        log_error(LogTest, "{}", e.what());
+    }
+
+    if (pass) {
+        log_info(LogTest, "Test Passed");
+    } else {
+        TT_THROW("Test Failed");
+    }
+
+    TT_FATAL(pass);
+    return 0;
+}
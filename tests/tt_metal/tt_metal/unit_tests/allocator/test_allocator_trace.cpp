@@ -0,0 +1,214 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <random>
+
+#include "basic_fixture.hpp"
+#include "tt_metal/host_api.hpp"
+#include "tt_metal/impl/allocator/algorithms/free_list.hpp"
+#include "tt_metal/impl/allocator/algorithms/indexed_free_list.hpp"
+#include "tt_metal/impl/allocator/allocator_trace.hpp"
+#include "tt_metal/detail/util.hpp"
+
+namespace unit_tests::allocator_trace {
+
+using namespace tt::tt_metal::allocator;
+
+const TraceBankConfig l1_bank = {
+    .buffer_type = "L1", .num_banks = 8, .bank_size_bytes = 512 * 1024, .offset_bytes = 1024, .interleaved_address_limit = 0};
+constexpr uint64_t page_size_bytes = 2048;
+
+std::string trace_file_name() {
+    return (std::filesystem::temp_directory_path() / "test_allocator_trace.txt").string();
+}
+
+std::unique_ptr<Algorithm> make_indexed_free_list(const TraceBankConfig &bank) {
+    return std::make_unique<IndexedFreeList>(bank.bank_size_bytes, bank.offset_bytes, 32, 32, FreeList::SearchPolicy::FIRST);
+}
+
+constexpr uint32_t max_live_buffers = 32;
+
+// Allocates and frees random buffers on a FreeList the way BankManager does and records them
+uint32_t record_random_trace(const std::string &file_name) {
+    FreeList bank(l1_bank.bank_size_bytes, l1_bank.offset_bytes, 32, 32, FreeList::SearchPolicy::FIRST);
+    TraceRecorder recorder(file_name);
+    recorder.record_bank(l1_bank);
+
+    std::mt19937 rng(0);
+    std::vector<uint64_t> live_buffers;
+    uint32_t num_events = 0;
+    for (uint32_t i = 0; i < 2000; i++) {
+        if (live_buffers.size() == max_live_buffers or (not live_buffers.empty() and rng() % 3 == 0)) {
+            uint32_t index = rng() % live_buffers.size();
+            bank.deallocate(live_buffers[index]);
+            recorder.record_deallocate("L1", live_buffers[index]);
+            live_buffers[index] = live_buffers.back();
+            live_buffers.pop_back();
+        } else {
+            uint64_t size_bytes = page_size_bytes * (1 + rng() % 32);
+            auto address = bank.allocate(tt::tt_metal::detail::SizeBytesPerBank(size_bytes, page_size_bytes, l1_bank.num_banks), /*bottom_up=*/false);
+            ScopedTraceTag tag(i % 2 ? "odd op" : "even_op");
+            recorder.record_allocate("L1", size_bytes, page_size_bytes, /*bottom_up=*/false, std::nullopt, address);
+            if (address.has_value()) {
+                live_buffers.push_back(address.value());
+            }
+        }
+        num_events++;
+    }
+    recorder.record_deallocate_all();
+    return num_events + 1;
+}
+
+}  // namespace unit_tests::allocator_trace
+
+TEST_F(BasicFixture, TestAllocatorTraceTagsNest) {
+    using namespace unit_tests::allocator_trace;
+    EXPECT_EQ(current_trace_tag(), "");
+    {
+        ScopedTraceTag outer("outer");
+        {
+            ScopedTraceTag inner("inner");
+            EXPECT_EQ(current_trace_tag(), "inner");
+        }
+        EXPECT_EQ(current_trace_tag(), "outer");
+    }
+    EXPECT_EQ(current_trace_tag(), "");
+}
+
+TEST_F(BasicFixture, TestAllocatorTraceReplaysRecordedAddresses) {
+    using namespace unit_tests::allocator_trace;
+    auto file_name = trace_file_name();
+    uint32_t num_events = record_random_trace(file_name);
+
+    auto trace = read_trace(file_name);
+    ASSERT_EQ(trace.banks.size(), 1u);
+    EXPECT_EQ(trace.banks[0].bank_size_bytes, l1_bank.bank_size_bytes);
+    EXPECT_EQ(trace.events.size(), num_events);
+    EXPECT_EQ(trace.events.back().type, TraceEvent::Type::DEALLOCATE_ALL);
+    for (const auto &event : trace.events) {
+        if (event.type == TraceEvent::Type::ALLOCATE) {
+            EXPECT_TRUE(event.tag == "odd_op" or event.tag == "even_op");
+        }
+    }
+
+    // IndexedFreeList places every buffer where the recording FreeList did
+    auto stats = replay_trace(trace, make_indexed_free_list);
+    ASSERT_EQ(stats.size(), 1u);
+    EXPECT_EQ(stats[0].buffer_type, "L1");
+    EXPECT_GT(stats[0].num_allocations, 0u);
+    EXPECT_EQ(stats[0].num_address_mismatches, 0u);
+    EXPECT_EQ(stats[0].num_failed_allocations, stats[0].num_recorded_failed_allocations);
+    EXPECT_GT(stats[0].peak_allocated_bytes, 0u);
+    EXPECT_LE(stats[0].peak_allocated_bytes, l1_bank.bank_size_bytes);
+    std::filesystem::remove(file_name);
+}
+
+TEST_F(BasicFixture, TestAllocatorTraceReplaysWithOverriddenBanks) {
+    using namespace unit_tests::allocator_trace;
+    auto file_name = trace_file_name();
+    record_random_trace(file_name);
+    auto trace = read_trace(file_name);
+    auto recorded_stats = replay_trace(trace, make_indexed_free_list);
+
+    // Twice as many banks halves the size of every buffer per bank
+    TraceBankConfig more_banks = l1_bank;
+    more_banks.num_banks = 2 * l1_bank.num_banks;
+    auto more_banks_stats = replay_trace(trace, make_indexed_free_list, {more_banks});
+    EXPECT_LT(more_banks_stats[0].peak_allocated_bytes, recorded_stats[0].peak_allocated_bytes);
+
+    // Banks smaller than the recorded peak run out of memory
+    TraceBankConfig small_banks = l1_bank;
+    small_banks.bank_size_bytes = recorded_stats[0].peak_allocated_bytes / 2;
+    auto small_banks_stats = replay_trace(trace, make_indexed_free_list, {small_banks});
+    EXPECT_GT(small_banks_stats[0].num_failed_allocations, recorded_stats[0].num_failed_allocations);
+    EXPECT_LE(small_banks_stats[0].peak_allocated_bytes, small_banks.bank_size_bytes);
+    uint32_t num_failed_allocations_by_tag = 0;
+    for (const auto &[tag, num_failed_allocations] : small_banks_stats[0].failed_allocations_by_tag) {
+        num_failed_allocations_by_tag += num_failed_allocations;
+    }
+    EXPECT_EQ(num_failed_allocations_by_tag, small_banks_stats[0].num_failed_allocations);
+    std::filesystem::remove(file_name);
+}
+
+TEST_F(BasicFixture, TestAllocatorTraceReplaysArenas) {
+    using namespace unit_tests::allocator_trace;
+    auto file_name = trace_file_name();
+    // Recorded the way allocator::push_arena and allocator::pop_arena record a top down arena of four pages per bank
+    const uint64_t arena_size_bytes = 4 * page_size_bytes;
+    const uint64_t arena_address = l1_bank.offset_bytes + l1_bank.bank_size_bytes - arena_size_bytes;
+    const uint64_t buffer_size_bytes = l1_bank.num_banks * page_size_bytes;
+    {
+        TraceRecorder recorder(file_name);
+        recorder.record_bank(l1_bank);
+        recorder.record_allocate("L1", l1_bank.num_banks * arena_size_bytes, arena_size_bytes, /*bottom_up=*/false, std::nullopt, arena_address);
+        recorder.record_push_arena("L1", arena_address, arena_size_bytes, /*bottom_up=*/false);
+        // The first buffer of the arena is at its top, the bottom up buffer goes to the general allocator
+        recorder.record_allocate("L1", buffer_size_bytes, page_size_bytes, /*bottom_up=*/false, std::nullopt, arena_address + arena_size_bytes - page_size_bytes);
+        recorder.record_allocate("L1", buffer_size_bytes, page_size_bytes, /*bottom_up=*/true, std::nullopt, l1_bank.offset_bytes);
+        recorder.record_deallocate("L1", arena_address + arena_size_bytes - page_size_bytes);
+        recorder.record_pop_arena("L1");
+        recorder.record_deallocate("L1", arena_address);
+        // Buffers left in an arena are released with it
+        recorder.record_allocate("L1", l1_bank.num_banks * arena_size_bytes, arena_size_bytes, /*bottom_up=*/false, std::nullopt, arena_address);
+        recorder.record_push_arena("L1", arena_address, arena_size_bytes, /*bottom_up=*/false);
+        recorder.record_allocate("L1", buffer_size_bytes, page_size_bytes, /*bottom_up=*/false, std::nullopt, arena_address + arena_size_bytes - page_size_bytes);
+        recorder.record_deallocate_all();
+    }
+
+    auto trace = read_trace(file_name);
+    ASSERT_EQ(trace.events.size(), 11u);
+    EXPECT_EQ(trace.events[1].type, TraceEvent::Type::PUSH_ARENA);
+    EXPECT_EQ(trace.events[1].address.value(), arena_address);
+    EXPECT_EQ(trace.events[1].size_bytes, arena_size_bytes);
+    EXPECT_FALSE(trace.events[1].bottom_up);
+    EXPECT_EQ(trace.events[5].type, TraceEvent::Type::POP_ARENA);
+
+    auto stats = replay_trace(trace, make_indexed_free_list);
+    ASSERT_EQ(stats.size(), 1u);
+    EXPECT_EQ(stats[0].num_allocations, 5u);
+    EXPECT_EQ(stats[0].num_failed_allocations, 0u);
+    EXPECT_EQ(stats[0].num_address_mismatches, 0u);
+    // Buffers in the arena do not take space from the general allocator
+    EXPECT_EQ(stats[0].peak_allocated_bytes, arena_size_bytes + page_size_bytes);
+    std::filesystem::remove(file_name);
+}
+
+TEST_F(BasicFixture, TestAllocatorTraceReplaysRetiredArenas) {
+    using namespace unit_tests::allocator_trace;
+    auto file_name = trace_file_name();
+    // Recorded the way allocator::release_arena records a top down arena of four pages per bank that is released while its
+    // buffer is alive, and is freed along with that buffer
+    const uint64_t arena_size_bytes = 4 * page_size_bytes;
+    const uint64_t arena_address = l1_bank.offset_bytes + l1_bank.bank_size_bytes - arena_size_bytes;
+    const uint64_t buffer_address = arena_address + arena_size_bytes - page_size_bytes;
+    const uint64_t buffer_size_bytes = l1_bank.num_banks * page_size_bytes;
+    {
+        TraceRecorder recorder(file_name);
+        recorder.record_bank(l1_bank);
+        recorder.record_allocate("L1", l1_bank.num_banks * arena_size_bytes, arena_size_bytes, /*bottom_up=*/false, std::nullopt, arena_address);
+        recorder.record_push_arena("L1", arena_address, arena_size_bytes, /*bottom_up=*/false);
+        recorder.record_allocate("L1", buffer_size_bytes, page_size_bytes, /*bottom_up=*/false, std::nullopt, buffer_address);
+        recorder.record_retire_arena("L1");
+        // The retired arena takes no more buffers
+        recorder.record_allocate("L1", buffer_size_bytes, page_size_bytes, /*bottom_up=*/false, std::nullopt, arena_address - page_size_bytes);
+        recorder.record_deallocate("L1", buffer_address);
+        // Freeing its buffer released the arena, its space is free again
+        recorder.record_allocate("L1", l1_bank.num_banks * arena_size_bytes, arena_size_bytes, /*bottom_up=*/false, std::nullopt, arena_address);
+        recorder.record_deallocate_all();
+    }
+
+    auto trace = read_trace(file_name);
+    ASSERT_EQ(trace.events.size(), 8u);
+    EXPECT_EQ(trace.events[3].type, TraceEvent::Type::RETIRE_ARENA);
+
+    auto stats = replay_trace(trace, make_indexed_free_list);
+    ASSERT_EQ(stats.size(), 1u);
+    EXPECT_EQ(stats[0].num_allocations, 4u);
+    EXPECT_EQ(stats[0].num_failed_allocations, 0u);
+    EXPECT_EQ(stats[0].num_address_mismatches, 0u);
+    EXPECT_EQ(stats[0].peak_allocated_bytes, arena_size_bytes + page_size_bytes);
+    std::filesystem::remove(file_name);
+}
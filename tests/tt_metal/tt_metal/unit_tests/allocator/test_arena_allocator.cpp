@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "basic_fixture.hpp"
+#include "tt_metal/host_api.hpp"
+#include "tt_metal/impl/allocator/arena.hpp"
+
+namespace unit_tests::arena_allocator {
+
+constexpr uint64_t base_address = 1024;
+constexpr uint64_t arena_size_bytes = 4096;
+
+}  // namespace unit_tests::arena_allocator
+
+TEST_F(BasicFixture, TestArenaAllocatesTopDown) {
+    using namespace unit_tests::arena_allocator;
+    auto arena = tt::tt_metal::allocator::Arena(base_address, arena_size_bytes, /*min_allocation_size*/32, /*alignment*/32, /*bottom_up=*/false);
+    EXPECT_EQ(arena.allocate(1024).value(), base_address + arena_size_bytes - 1024);
+    // Sizes are rounded up to the min allocation size and alignment
+    EXPECT_EQ(arena.allocate(8).value(), base_address + arena_size_bytes - 1024 - 32);
+    EXPECT_EQ(arena.allocate(33).value(), base_address + arena_size_bytes - 1024 - 32 - 64);
+    EXPECT_EQ(arena.used_bytes(), 1024 + 32 + 64);
+    EXPECT_EQ(arena.num_live_allocations(), 3);
+    EXPECT_FALSE(arena.allocate(arena_size_bytes).has_value());
+}
+
+TEST_F(BasicFixture, TestArenaAllocatesBottomUp) {
+    using namespace unit_tests::arena_allocator;
+    auto arena = tt::tt_metal::allocator::Arena(base_address, arena_size_bytes, 32, 32, /*bottom_up=*/true);
+    EXPECT_EQ(arena.allocate(1024).value(), base_address);
+    EXPECT_EQ(arena.allocate(2048).value(), base_address + 1024);
+    EXPECT_EQ(arena.allocate(1024).value(), base_address + 3072);
+    EXPECT_FALSE(arena.allocate(32).has_value());
+    EXPECT_TRUE(arena.contains(base_address + arena_size_bytes - 32));
+    EXPECT_FALSE(arena.contains(base_address + arena_size_bytes));
+}
+
+TEST_F(BasicFixture, TestArenaReclaimsSpaceInStackOrder) {
+    using namespace unit_tests::arena_allocator;
+    auto arena = tt::tt_metal::allocator::Arena(base_address, arena_size_bytes, 32, 32, /*bottom_up=*/true);
+    auto a = arena.allocate(1024).value();
+    auto b = arena.allocate(1024).value();
+    auto c = arena.allocate(1024).value();
+
+    // b is below the top of the stack, its space is only reclaimed once c is freed too
+    arena.deallocate(b);
+    EXPECT_EQ(arena.used_bytes(), 3072);
+    EXPECT_EQ(arena.num_live_allocations(), 2);
+    arena.deallocate(c);
+    EXPECT_EQ(arena.used_bytes(), 1024);
+    EXPECT_EQ(arena.allocate(2048).value(), b);
+
+    EXPECT_ANY_THROW(arena.deallocate(c));
+    arena.deallocate(b);
+    arena.deallocate(a);
+    EXPECT_EQ(arena.used_bytes(), 0);
+    EXPECT_EQ(arena.num_live_allocations(), 0);
+}
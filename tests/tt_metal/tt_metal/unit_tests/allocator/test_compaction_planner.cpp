@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <random>
+
+#include "basic_fixture.hpp"
+#include "tt_metal/host_api.hpp"
+#include "tt_metal/impl/allocator/algorithms/indexed_free_list.hpp"
+#include "tt_metal/impl/allocator/compaction.hpp"
+
+namespace unit_tests::compaction_planner {
+
+using namespace tt::tt_metal::allocator;
+
+constexpr uint64_t max_size_bytes = 64 * 1024;
+constexpr uint64_t offset_bytes = 1024;
+
+IndexedFreeList make_allocator() {
+    return IndexedFreeList(max_size_bytes, offset_bytes, /*min_allocation_size*/32, /*alignment*/32, FreeList::SearchPolicy::FIRST);
+}
+
+// Applies the plan the same way BankManager::relocate_buffer does, which fails if a move targets space that is not free yet
+void apply_plan(Algorithm &allocator, const CompactionPlan &plan) {
+    for (const auto &relocation : plan.relocations) {
+        allocator.deallocate(relocation.src_address);
+        ASSERT_EQ(allocator.allocate_at_address(relocation.dst_address, relocation.size_bytes), relocation.dst_address);
+    }
+}
+
+std::vector<uint64_t> fragment(Algorithm &allocator, bool bottom_up, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<uint64_t> addresses;
+    while (true) {
+        auto address = allocator.allocate(32 * (1 + rng() % 32), bottom_up);
+        if (not address.has_value()) {
+            break;
+        }
+        addresses.push_back(address.value());
+    }
+    std::vector<uint64_t> kept;
+    for (auto address : addresses) {
+        if (rng() % 2) {
+            allocator.deallocate(address);
+        } else {
+            kept.push_back(address);
+        }
+    }
+    return kept;
+}
+
+void check_compacts_towards(bool bottom_up) {
+    for (uint32_t seed = 0; seed < 8; seed++) {
+        auto allocator = make_allocator();
+        fragment(allocator, bottom_up, seed);
+        auto stats_before = allocator.get_statistics();
+
+        auto plan = plan_compaction(allocator.get_blocks(), bottom_up);
+        EXPECT_EQ(plan.largest_free_block_bytes_before, stats_before.largest_free_block_bytes);
+        EXPECT_EQ(plan.largest_free_block_bytes_after, stats_before.total_free_bytes);
+        apply_plan(allocator, plan);
+
+        // All free space is now one block at the end opposite to where allocations grow from
+        auto blocks = allocator.get_blocks();
+        auto stats_after = allocator.get_statistics();
+        EXPECT_EQ(stats_after.total_allocated_bytes, stats_before.total_allocated_bytes);
+        EXPECT_EQ(stats_after.largest_free_block_bytes, stats_after.total_free_bytes);
+        const auto &free_block = bottom_up ? blocks.back() : blocks.front();
+        EXPECT_FALSE(free_block.allocated);
+        EXPECT_EQ(free_block.size, stats_after.total_free_bytes);
+
+        // Compacting again moves nothing
+        EXPECT_TRUE(plan_compaction(blocks, bottom_up).relocations.empty());
+    }
+}
+
+}  // namespace unit_tests::compaction_planner
+
+TEST_F(BasicFixture, TestCompactionPlanTopDown) {
+    unit_tests::compaction_planner::check_compacts_towards(/*bottom_up=*/false);
+}
+
+TEST_F(BasicFixture, TestCompactionPlanBottomUp) {
+    unit_tests::compaction_planner::check_compacts_towards(/*bottom_up=*/true);
+}
+
+TEST_F(BasicFixture, TestCompactionPlanKeepsPinnedBlocks) {
+    using namespace unit_tests::compaction_planner;
+    auto allocator = make_allocator();
+    // Top down: a is highest, c is lowest
+    auto a = allocator.allocate(1024, false).value();
+    auto b = allocator.allocate(1024, false).value();
+    auto c = allocator.allocate(1024, false).value();
+    auto d = allocator.allocate(1024, false).value();
+    auto e = allocator.allocate(1024, false).value();
+    allocator.deallocate(a);
+    allocator.deallocate(d);
+
+    auto plan = plan_compaction(allocator.get_blocks(), /*bottom_up=*/false, /*pinned_addresses=*/{c});
+    ASSERT_EQ(plan.relocations.size(), 2);
+    EXPECT_EQ(plan.relocations[0].src_address, b);
+    EXPECT_EQ(plan.relocations[0].dst_address, a);
+    // e packs against pinned c, not against b's new position
+    EXPECT_EQ(plan.relocations[1].src_address, e);
+    EXPECT_EQ(plan.relocations[1].dst_address, d);
+    EXPECT_EQ(plan.bytes_moved, 2048);
+    apply_plan(allocator, plan);
+}
@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <random>
+
+#include "basic_fixture.hpp"
+#include "tt_metal/host_api.hpp"
+#include "tt_metal/impl/allocator/algorithms/free_list.hpp"
+#include "tt_metal/impl/allocator/algorithms/indexed_free_list.hpp"
+
+namespace unit_tests::indexed_free_list {
+
+using tt::tt_metal::allocator::FreeList;
+using tt::tt_metal::allocator::IndexedFreeList;
+
+// Runs the same random series of allocations and deallocations on FreeList and IndexedFreeList and checks that
+// every operation returns the same address and leaves both allocators with the same blocks
+void check_matches_free_list(FreeList::SearchPolicy search_policy, uint32_t seed) {
+    constexpr uint64_t max_size_bytes = 64 * 1024;
+    constexpr uint64_t offset_bytes = 1024;
+    constexpr uint64_t min_allocation_size_bytes = 32;
+    constexpr uint64_t alignment = 32;
+    constexpr uint32_t num_operations = 4000;
+
+    FreeList free_list(max_size_bytes, offset_bytes, min_allocation_size_bytes, alignment, search_policy);
+    IndexedFreeList indexed_free_list(max_size_bytes, offset_bytes, min_allocation_size_bytes, alignment, search_policy);
+
+    std::mt19937 rng(seed);
+    std::vector<uint64_t> allocated_addresses;
+    for (uint32_t i = 0; i < num_operations; i++) {
+        uint32_t operation = rng() % 10;
+        if (operation < 5) {
+            uint64_t size_bytes = rng() % 2048;
+            bool bottom_up = rng() % 2;
+            auto expected = free_list.allocate(size_bytes, bottom_up);
+            ASSERT_EQ(indexed_free_list.allocate(size_bytes, bottom_up), expected) << "operation " << i;
+            if (expected.has_value()) {
+                allocated_addresses.push_back(expected.value());
+            }
+        } else if (operation < 6) {
+            uint64_t address = offset_bytes + (rng() % (max_size_bytes / alignment)) * alignment;
+            uint64_t size_bytes = rng() % 512;
+            auto expected = free_list.allocate_at_address(address, size_bytes);
+            ASSERT_EQ(indexed_free_list.allocate_at_address(address, size_bytes), expected) << "operation " << i;
+            if (expected.has_value()) {
+                allocated_addresses.push_back(expected.value());
+            }
+        } else if (not allocated_addresses.empty()) {
+            uint32_t index = rng() % allocated_addresses.size();
+            free_list.deallocate(allocated_addresses.at(index));
+            indexed_free_list.deallocate(allocated_addresses.at(index));
+            allocated_addresses.erase(allocated_addresses.begin() + index);
+        }
+
+        ASSERT_EQ(indexed_free_list.lowest_occupied_address(), free_list.lowest_occupied_address()) << "operation " << i;
+        ASSERT_EQ(indexed_free_list.available_addresses(0), free_list.available_addresses(0)) << "operation " << i;
+        auto stats = indexed_free_list.get_statistics();
+        auto expected_stats = free_list.get_statistics();
+        ASSERT_EQ(stats.total_allocated_bytes, expected_stats.total_allocated_bytes);
+        ASSERT_EQ(stats.total_free_bytes, expected_stats.total_free_bytes);
+        ASSERT_EQ(stats.largest_free_block_bytes, expected_stats.largest_free_block_bytes);
+        ASSERT_EQ(stats.largest_free_block_addrs, expected_stats.largest_free_block_addrs);
+
+        auto blocks = indexed_free_list.get_blocks();
+        auto expected_blocks = free_list.get_blocks();
+        ASSERT_EQ(blocks.size(), expected_blocks.size());
+        for (uint32_t block = 0; block < blocks.size(); block++) {
+            ASSERT_EQ(blocks[block].address, expected_blocks[block].address);
+            ASSERT_EQ(blocks[block].size, expected_blocks[block].size);
+            ASSERT_EQ(blocks[block].allocated, expected_blocks[block].allocated);
+        }
+    }
+}
+
+}  // namespace unit_tests::indexed_free_list
+
+TEST_F(BasicFixture, TestIndexedFreeListMatchesFirstFitFreeList) {
+    for (uint32_t seed = 0; seed < 8; seed++) {
+        unit_tests::indexed_free_list::check_matches_free_list(tt::tt_metal::allocator::FreeList::SearchPolicy::FIRST, seed);
+    }
+}
+
+TEST_F(BasicFixture, TestIndexedFreeListMatchesBestFitFreeList) {
+    for (uint32_t seed = 0; seed < 8; seed++) {
+        unit_tests::indexed_free_list::check_matches_free_list(tt::tt_metal::allocator::FreeList::SearchPolicy::BEST, seed);
+    }
+}
+
+TEST_F(BasicFixture, TestIndexedFreeListAddressLimitAndClear) {
+    constexpr uint64_t max_size_bytes = 1024;
+    tt::tt_metal::allocator::IndexedFreeList allocator(
+        max_size_bytes, /*offset*/0, /*min_allocation_size*/32, /*alignment*/32, tt::tt_metal::allocator::FreeList::SearchPolicy::FIRST);
+
+    EXPECT_EQ(allocator.allocate(max_size_bytes - 64, true), 0);
+    EXPECT_EQ(allocator.lowest_occupied_address(), 0);
+    // Like FreeList, the block is still handed out before the address limit check throws
+    EXPECT_ANY_THROW(allocator.allocate(32, false, /*address_limit=*/max_size_bytes));
+    EXPECT_EQ(allocator.allocate(32, false), max_size_bytes - 64);
+    EXPECT_EQ(allocator.allocate(32, true), std::nullopt);
+
+    allocator.deallocate(0);
+    EXPECT_EQ(allocator.lowest_occupied_address(), max_size_bytes - 64);
+
+    allocator.clear();
+    EXPECT_EQ(allocator.lowest_occupied_address(), std::nullopt);
+    EXPECT_EQ(allocator.allocate(max_size_bytes, true), 0);
+}
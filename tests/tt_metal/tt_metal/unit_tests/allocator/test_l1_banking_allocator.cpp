@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <gtest/gtest.h>
+#include <numeric>
 
 #include "basic_fixture.hpp"
 #include "device_fixture.hpp"
@@ -61,3 +62,119 @@ TEST_F(BasicFixture, TestL1BuffersDoNotGrowBeyondBankSize) {
 
     tt::tt_metal::CloseDevice(device);
 }
+
+// TODO: Uplift to DeviceFixture once it does not skip GS
+TEST_F(BasicFixture, TestL1CompactionRelocatesBuffers) {
+    tt::tt_metal::Device *device = tt::tt_metal::CreateDevice(0);
+
+    const uint32_t num_banks = device->num_banks(tt::tt_metal::BufferType::L1);
+    const uint32_t page_size = 32 * 1024;
+    tt::tt_metal::InterleavedBufferConfig l1_config{
+                    .device=device,
+                    .size = num_banks * page_size,
+                    .page_size = page_size,
+                    .buffer_type = tt::tt_metal::BufferType::L1
+        };
+
+    // L1 buffers are allocated top down, so c sits below b which sits below a
+    tt::tt_metal::Buffer a = tt::tt_metal::CreateBuffer(l1_config);
+    auto b = std::make_unique<tt::tt_metal::Buffer>(tt::tt_metal::CreateBuffer(l1_config));
+    tt::tt_metal::Buffer c = tt::tt_metal::CreateBuffer(l1_config);
+    const uint32_t b_address = b->address();
+
+    std::vector<uint32_t> a_data(a.size() / sizeof(uint32_t));
+    std::vector<uint32_t> c_data(c.size() / sizeof(uint32_t));
+    std::iota(a_data.begin(), a_data.end(), 0);
+    std::iota(c_data.begin(), c_data.end(), a_data.size());
+    tt::tt_metal::detail::WriteToBuffer(a, a_data);
+    tt::tt_metal::detail::WriteToBuffer(c, c_data);
+
+    b.reset();
+    auto stats_before = device->get_memory_allocation_statistics(tt::tt_metal::BufferType::L1);
+    auto plan = device->compact_l1();
+    auto stats_after = device->get_memory_allocation_statistics(tt::tt_metal::BufferType::L1);
+
+    ASSERT_EQ(plan.relocations.size(), 1);
+    EXPECT_EQ(plan.bytes_moved, page_size);
+    EXPECT_EQ(c.address(), b_address);
+    EXPECT_GT(stats_after.largest_free_block_bytes, stats_before.largest_free_block_bytes);
+    EXPECT_TRUE(device->plan_l1_compaction().relocations.empty());
+
+    std::vector<uint32_t> a_readback;
+    std::vector<uint32_t> c_readback;
+    tt::tt_metal::detail::ReadFromBuffer(a, a_readback);
+    tt::tt_metal::detail::ReadFromBuffer(c, c_readback);
+    EXPECT_EQ(a_readback, a_data);
+    EXPECT_EQ(c_readback, c_data);
+
+    tt::tt_metal::CloseDevice(device);
+}
+
+// TODO: Uplift to DeviceFixture once it does not skip GS
+TEST_F(BasicFixture, TestL1ArenaHoldsBuffersUntilPopped) {
+    tt::tt_metal::Device *device = tt::tt_metal::CreateDevice(0);
+
+    const uint32_t num_banks = device->num_banks(tt::tt_metal::BufferType::L1);
+    const uint32_t page_size = 4 * 1024;
+    tt::tt_metal::InterleavedBufferConfig l1_config{
+                    .device=device,
+                    .size = num_banks * page_size,
+                    .page_size = page_size,
+                    .buffer_type = tt::tt_metal::BufferType::L1
+        };
+    auto stats_before = device->get_memory_allocation_statistics(tt::tt_metal::BufferType::L1);
+    {
+        tt::tt_metal::ScopedL1Arena arena(device, 4 * page_size);
+        auto stats_with_arena = device->get_memory_allocation_statistics(tt::tt_metal::BufferType::L1);
+        EXPECT_EQ(stats_with_arena.total_allocated_bytes, stats_before.total_allocated_bytes + 4 * page_size);
+
+        // Buffers in the arena are stacked top down and do not touch the general allocator
+        tt::tt_metal::Buffer a = tt::tt_metal::CreateBuffer(l1_config);
+        tt::tt_metal::Buffer b = tt::tt_metal::CreateBuffer(l1_config);
+        EXPECT_EQ(b.address(), a.address() - page_size);
+        EXPECT_EQ(device->get_memory_allocation_statistics(tt::tt_metal::BufferType::L1).total_allocated_bytes, stats_with_arena.total_allocated_bytes);
+
+        // A buffer that would still be alive when the arena is released is caught
+        EXPECT_ANY_THROW(device->pop_l1_arena());
+    }
+    auto stats_after = device->get_memory_allocation_statistics(tt::tt_metal::BufferType::L1);
+    EXPECT_EQ(stats_after.total_allocated_bytes, stats_before.total_allocated_bytes);
+
+    tt::tt_metal::CloseDevice(device);
+}
+
+// TODO: Uplift to DeviceFixture once it does not skip GS
+TEST_F(BasicFixture, TestL1ArenaIsRetiredWhenBuffersOutliveItsScope) {
+    tt::tt_metal::Device *device = tt::tt_metal::CreateDevice(0);
+
+    const uint32_t num_banks = device->num_banks(tt::tt_metal::BufferType::L1);
+    const uint32_t page_size = 4 * 1024;
+    tt::tt_metal::InterleavedBufferConfig l1_config{
+                    .device=device,
+                    .size = num_banks * page_size,
+                    .page_size = page_size,
+                    .buffer_type = tt::tt_metal::BufferType::L1
+        };
+    auto stats_before = device->get_memory_allocation_statistics(tt::tt_metal::BufferType::L1);
+    {
+        tt::tt_metal::ScopedL1Arena outer(device, 4 * page_size);
+        tt::tt_metal::Buffer a = tt::tt_metal::CreateBuffer(l1_config);
+        std::unique_ptr<tt::tt_metal::Buffer> escaped;
+        {
+            tt::tt_metal::ScopedL1Arena inner(device, 4 * page_size);
+            escaped = std::make_unique<tt::tt_metal::Buffer>(device, num_banks * page_size, page_size, tt::tt_metal::BufferType::L1);
+        }
+        // The inner arena is retired and keeps its reservation, the next buffer goes to the outer arena right below a
+        tt::tt_metal::Buffer b = tt::tt_metal::CreateBuffer(l1_config);
+        EXPECT_EQ(b.address(), a.address() - page_size);
+        EXPECT_EQ(device->get_memory_allocation_statistics(tt::tt_metal::BufferType::L1).total_allocated_bytes, stats_before.total_allocated_bytes + 8 * page_size);
+
+        // Freeing the last buffer of the retired arena releases it
+        escaped.reset();
+        EXPECT_EQ(device->get_memory_allocation_statistics(tt::tt_metal::BufferType::L1).total_allocated_bytes, stats_before.total_allocated_bytes + 4 * page_size);
+    }
+    auto stats_after = device->get_memory_allocation_statistics(tt::tt_metal::BufferType::L1);
+    EXPECT_EQ(stats_after.total_allocated_bytes, stats_before.total_allocated_bytes);
+
+    tt::tt_metal::CloseDevice(device);
+}
@@ -89,7 +89,8 @@ bool verify_result_data_movement(
         auto processor = kernel->processor();
         for (const auto &logical_core : kernel->cores_with_runtime_args()) {
             auto expected_rt_args = core_to_rt_args.at(logical_core);
-            auto rt_args = kernel->runtime_args(logical_core);
+            const auto &rt_args_data = kernel->runtime_args(logical_core);
+            std::vector<uint32_t> rt_args(rt_args_data.begin(), rt_args_data.end());
             EXPECT_TRUE(rt_args == expected_rt_args);
             std::vector<uint32_t> written_args;
             tt_metal::detail::ReadFromDeviceL1(
@@ -143,6 +144,89 @@ TEST_F(DeviceFixture, LegallyModifyRTArgsDataMovement) {
     }
 }
 
+TEST_F(DeviceFixture, SetStridedRTArgsDataMovement) {
+    for (unsigned int id = 0; id < num_devices_; id++) {
+        CoreRange first_core_range = {.start = CoreCoord(0, 0), .end = CoreCoord(1, 1)};
+        CoreRange second_core_range = {.start = CoreCoord(3, 3), .end = CoreCoord(5, 5)};
+        CoreRangeSet core_range_set({first_core_range, second_core_range});
+        auto program =
+            unit_tests::runtime_args::initialize_program_data_movement(this->devices_.at(id), core_range_set);
+        ASSERT_TRUE(
+            program.num_kernels() ==
+            1);
+
+        // Three args per core, read from rows of four
+        constexpr uint32_t num_runtime_args = 3;
+        constexpr uint32_t stride = 4;
+        std::vector<CoreCoord> cores;
+        std::vector<uint32_t> runtime_args;
+        std::map<CoreCoord, std::vector<uint32_t>> core_to_rt_args;
+        for (auto core_range : core_range_set.ranges()) {
+            for (auto x = core_range.start.x; x <= core_range.end.x; x++) {
+                for (auto y = core_range.start.y; y <= core_range.end.y; y++) {
+                    CoreCoord logical_core(x, y);
+                    std::vector<uint32_t> core_runtime_args = {uint32_t(x), uint32_t(y), uint32_t(100 * x + y)};
+                    cores.push_back(logical_core);
+                    runtime_args.insert(runtime_args.end(), core_runtime_args.begin(), core_runtime_args.end());
+                    runtime_args.push_back(0xdeadbeef);
+                    core_to_rt_args[logical_core] = core_runtime_args;
+                }
+            }
+        }
+        SetRuntimeArgs(program, 0, cores, runtime_args.data(), num_runtime_args, stride);
+        detail::WriteRuntimeArgsToDevice(this->devices_.at(id), program);
+        EXPECT_TRUE(
+            unit_tests::runtime_args::verify_result_data_movement(this->devices_.at(id), program, core_to_rt_args));
+
+        // Every core's args fill one 16B slot, so they're stored back to back
+        Kernel *kernel = detail::GetKernel(program, 0);
+        EXPECT_TRUE(kernel->runtime_args_packed());
+        EXPECT_EQ(kernel->runtime_args_data().size(), cores.size() * stride);
+
+        // Updating args in place doesn't change the layout
+        uint32_t layout_version = kernel->runtime_args_layout_version();
+        GetRuntimeArgs(program, 0, CoreCoord(0, 0))[2] = 7;
+        core_to_rt_args[CoreCoord(0, 0)][2] = 7;
+        EXPECT_EQ(kernel->runtime_args_layout_version(), layout_version);
+        detail::WriteRuntimeArgsToDevice(this->devices_.at(id), program);
+        EXPECT_TRUE(
+            unit_tests::runtime_args::verify_result_data_movement(this->devices_.at(id), program, core_to_rt_args));
+    }
+}
+
+TEST_F(DeviceFixture, CopyRTArgsBetweenCoresDataMovement) {
+    for (unsigned int id = 0; id < num_devices_; id++) {
+        CoreRange first_core_range = {.start = CoreCoord(0, 0), .end = CoreCoord(1, 1)};
+        CoreRange second_core_range = {.start = CoreCoord(3, 3), .end = CoreCoord(5, 5)};
+        CoreRangeSet core_range_set({first_core_range, second_core_range});
+        auto program =
+            unit_tests::runtime_args::initialize_program_data_movement(this->devices_.at(id), core_range_set);
+        ASSERT_TRUE(
+            program.num_kernels() ==
+            1);
+
+        std::vector<uint32_t> source_runtime_args = {101, 202, 303};
+        SetRuntimeArgs(program, 0, CoreCoord(0, 0), source_runtime_args);
+
+        // The source is a core's own args, and giving every other core a slot moves them
+        std::vector<CoreCoord> cores;
+        std::map<CoreCoord, std::vector<uint32_t>> core_to_rt_args;
+        for (auto core_range : core_range_set.ranges()) {
+            for (auto x = core_range.start.x; x <= core_range.end.x; x++) {
+                for (auto y = core_range.start.y; y <= core_range.end.y; y++) {
+                    CoreCoord logical_core(x, y);
+                    cores.push_back(logical_core);
+                    core_to_rt_args[logical_core] = source_runtime_args;
+                }
+            }
+        }
+        SetRuntimeArgs(program, 0, cores, GetRuntimeArgs(program, 0, CoreCoord(0, 0)).data(), source_runtime_args.size(), 0);
+        detail::WriteRuntimeArgsToDevice(this->devices_.at(id), program);
+        EXPECT_TRUE(
+            unit_tests::runtime_args::verify_result_data_movement(this->devices_.at(id), program, core_to_rt_args));
+    }
+}
+
 bool verify_result_compute(
     Device *device, const Program &program,
         const std::map<CoreCoord, std::vector<uint32_t>> &core_to_rt_args,
@@ -179,7 +263,8 @@ bool verify_result_compute(
         auto processor = kernel->processor();
         for (const auto &logical_core : kernel->cores_with_runtime_args()) {
             auto expected_rt_args = core_to_rt_args.at(logical_core);
-            auto rt_args = kernel->runtime_args(logical_core);
+            const auto &rt_args_data = kernel->runtime_args(logical_core);
+            std::vector<uint32_t> rt_args(rt_args_data.begin(), rt_args_data.end());
             EXPECT_TRUE(rt_args == expected_rt_args);
             std::vector<uint32_t> written_args;
             tt_metal::detail::ReadFromDeviceL1(
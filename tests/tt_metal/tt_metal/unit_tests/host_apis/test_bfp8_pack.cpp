@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+
+#include "tests/tt_metal/tt_metal/unit_tests/common/basic_fixture.hpp"
+#include "tt_metal/common/bfloat8.hpp"
+#include "tt_metal/common/tile_transpose.hpp"
+
+namespace unit_tests::bfp8_pack {
+
+// Scalar packing of tiles stored as four row-major faces, built from the per-datum reference conversion
+template <bool truncate_bfp_mantissa>
+std::vector<uint32_t> reference_pack(const std::vector<float>& tiled_data, bool is_exp_a) {
+    std::vector<uint32_t> packed_result;
+    for (uint32_t tile = 0; tile < tiled_data.size() / 1024; tile++) {
+        std::vector<uint8_t> exponents;
+        std::vector<uint8_t> data;
+        for (uint32_t face_row = 0; face_row < 64; face_row++) {
+            std::vector<uint32_t> row(16);
+            std::memcpy(row.data(), tiled_data.data() + tile * 1024 + face_row * 16, 16 * sizeof(float));
+            uint8_t exp = get_max_exp(row, is_exp_a);
+            exponents.push_back(exp);
+            for (uint32_t datum : row) {
+                data.push_back(convert_u32_to_bfp8<truncate_bfp_mantissa>(datum, exp, is_exp_a));
+            }
+        }
+        exponents.insert(exponents.end(), data.begin(), data.end());
+        for (uint32_t i = 0; i < exponents.size(); i += 4) {
+            packed_result.push_back(get_exp_dword({exponents.begin() + i, exponents.begin() + i + 4}));
+        }
+    }
+    return packed_result;
+}
+
+// Mix of normal values across a wide exponent range, denormals, signed zeros, infinities and NaNs
+std::vector<float> create_test_data(uint32_t num_elements) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<uint32_t> bits;
+    std::uniform_real_distribution<float> exponent(-40.0f, 40.0f);
+    std::vector<float> data(num_elements);
+    for (uint32_t i = 0; i < num_elements; i++) {
+        switch (i % 8) {
+            case 0: {
+                uint32_t raw = bits(rng);
+                std::memcpy(&data[i], &raw, sizeof(float));
+                break;
+            }
+            case 1: data[i] = (i % 16 == 1) ? 0.0f : -0.0f; break;
+            case 2: data[i] = std::numeric_limits<float>::denorm_min() * (i % 1000); break;
+            default: data[i] = std::ldexp((bits(rng) % 2 ? -1.0f : 1.0f) * (1.0f + (bits(rng) % 1000) / 1000.0f), exponent(rng)); break;
+        }
+    }
+    return data;
+}
+
+template <bool truncate_bfp_mantissa>
+void check_matches_reference(bool is_exp_a) {
+    uint32_t height = 64;
+    uint32_t width = 96;
+    auto row_major_data = create_test_data(height * width);
+    std::vector<float> tiled_data(row_major_data.size());
+    tt::tile_transpose::tilize(row_major_data.data(), tiled_data.data(), height, width);
+
+    auto expected = reference_pack<truncate_bfp_mantissa>(tiled_data, is_exp_a);
+    EXPECT_EQ(pack_fp32_vec_as_bfp8_tiles<truncate_bfp_mantissa>(tiled_data, /*row_major_input=*/false, is_exp_a), expected);
+    EXPECT_EQ(
+        pack_fp32_row_major_as_bfp8_tiles<truncate_bfp_mantissa>(row_major_data.data(), height, width, is_exp_a),
+        expected);
+
+    // row_major_input on single tiles is the 32x32 case of the fused tilize
+    std::vector<float> single_tile(row_major_data.begin(), row_major_data.begin() + 1024);
+    std::vector<float> single_tile_tiled(1024);
+    tt::tile_transpose::tilize(single_tile.data(), single_tile_tiled.data(), 32, 32);
+    EXPECT_EQ(
+        pack_fp32_vec_as_bfp8_tiles<truncate_bfp_mantissa>(single_tile, /*row_major_input=*/true, is_exp_a),
+        reference_pack<truncate_bfp_mantissa>(single_tile_tiled, is_exp_a));
+}
+
+}  // namespace unit_tests::bfp8_pack
+
+TEST_F(BasicFixture, TestBfp8PackRoundMatchesScalar) {
+    unit_tests::bfp8_pack::check_matches_reference<false>(/*is_exp_a=*/false);
+    unit_tests::bfp8_pack::check_matches_reference<false>(/*is_exp_a=*/true);
+}
+
+TEST_F(BasicFixture, TestBfp8PackTruncateMatchesScalar) {
+    unit_tests::bfp8_pack::check_matches_reference<true>(/*is_exp_a=*/false);
+    unit_tests::bfp8_pack::check_matches_reference<true>(/*is_exp_a=*/true);
+}
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <elf.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+
+#include "tests/tt_metal/tt_metal/unit_tests/common/basic_fixture.hpp"
+#include "tt_metal/llrt/tt_memory.h"
+
+namespace unit_tests::elf_loader {
+
+constexpr uint32_t text_offset = 128;
+constexpr uint32_t data_offset = 144;
+constexpr uint32_t comment_offset = 152;
+constexpr uint32_t section_header_offset = 160;
+
+template <class T>
+void put(std::string &image, uint32_t offset, const T &value) {
+    std::memcpy(image.data() + offset, &value, sizeof(T));
+}
+
+Elf32_Shdr section(uint32_t type, uint32_t flags, uint32_t addr, uint32_t offset, uint32_t size) {
+    Elf32_Shdr shdr = {};
+    shdr.sh_type = type;
+    shdr.sh_flags = flags;
+    shdr.sh_addr = addr;
+    shdr.sh_offset = offset;
+    shdr.sh_size = size;
+    return shdr;
+}
+
+// A .text section with a partial last word, a .data section linked at 0x2000 but loaded at 0x3000, a .bss section
+// and a non loadable .comment section
+std::string create_test_elf() {
+    std::string image(section_header_offset + 5 * sizeof(Elf32_Shdr), '\0');
+
+    Elf32_Ehdr ehdr = {};
+    std::memcpy(ehdr.e_ident, ELFMAG, SELFMAG);
+    ehdr.e_ident[EI_CLASS] = ELFCLASS32;
+    ehdr.e_ident[EI_DATA] = ELFDATA2LSB;
+    ehdr.e_ident[EI_VERSION] = EV_CURRENT;
+    ehdr.e_type = ET_EXEC;
+    ehdr.e_machine = EM_RISCV;
+    ehdr.e_version = EV_CURRENT;
+    ehdr.e_ehsize = sizeof(Elf32_Ehdr);
+    ehdr.e_phoff = sizeof(Elf32_Ehdr);
+    ehdr.e_phentsize = sizeof(Elf32_Phdr);
+    ehdr.e_phnum = 2;
+    ehdr.e_shoff = section_header_offset;
+    ehdr.e_shentsize = sizeof(Elf32_Shdr);
+    ehdr.e_shnum = 5;
+    put(image, 0, ehdr);
+
+    Elf32_Phdr text_segment = {};
+    text_segment.p_type = PT_LOAD;
+    text_segment.p_offset = text_offset;
+    text_segment.p_vaddr = text_segment.p_paddr = 0x1000;
+    text_segment.p_filesz = text_segment.p_memsz = 10;
+    put(image, ehdr.e_phoff, text_segment);
+    Elf32_Phdr data_segment = {};
+    data_segment.p_type = PT_LOAD;
+    data_segment.p_offset = data_offset;
+    data_segment.p_vaddr = 0x2000;
+    data_segment.p_paddr = 0x3000;
+    data_segment.p_filesz = 8;
+    data_segment.p_memsz = 8 + 16;
+    put(image, ehdr.e_phoff + sizeof(Elf32_Phdr), data_segment);
+
+    for (uint32_t i = 0; i < 10; i++) {
+        image[text_offset + i] = static_cast<char>(i + 1);
+    }
+    put(image, data_offset, uint32_t(0xDEADBEEF));
+    put(image, data_offset + 4, uint32_t(0xCAFEF00D));
+    put(image, comment_offset, uint32_t(0xFFFFFFFF));
+
+    put(image, section_header_offset, Elf32_Shdr{});
+    put(image, section_header_offset + sizeof(Elf32_Shdr), section(SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR, 0x1000, text_offset, 10));
+    put(image, section_header_offset + 2 * sizeof(Elf32_Shdr), section(SHT_PROGBITS, SHF_ALLOC | SHF_WRITE, 0x2000, data_offset, 8));
+    put(image, section_header_offset + 3 * sizeof(Elf32_Shdr), section(SHT_NOBITS, SHF_ALLOC | SHF_WRITE, 0x2008, data_offset + 8, 16));
+    put(image, section_header_offset + 4 * sizeof(Elf32_Shdr), section(SHT_PROGBITS, 0, 0, comment_offset, 4));
+    return image;
+}
+
+}  // namespace unit_tests::elf_loader
+
+TEST_F(BasicFixture, TestElfLoaderMatchesHexFile) {
+    std::stringstream elf(unit_tests::elf_loader::create_test_elf());
+    ll_api::memory mem;
+    mem.fill_from_elf(elf);
+
+    // What objcopy -O verilog and hex8tohex32.py produce for the same ELF
+    std::stringstream hex("@00000400\n04030201\n08070605\n00000A09\n@00000C00\nDEADBEEF\nCAFEF00D\n");
+    ll_api::memory expected(hex);
+    EXPECT_EQ(mem.num_spans(), 2);
+    EXPECT_EQ(mem, expected);
+}
+
+TEST_F(BasicFixture, TestElfLoaderRejectsOtherFiles) {
+    std::stringstream hex("@00000400\n04030201\n");
+    ll_api::memory mem;
+    EXPECT_ANY_THROW(mem.fill_from_elf(hex));
+
+    std::string truncated_image = unit_tests::elf_loader::create_test_elf();
+    truncated_image.resize(unit_tests::elf_loader::section_header_offset);
+    std::stringstream truncated(truncated_image);
+    ll_api::memory truncated_mem;
+    EXPECT_ANY_THROW(truncated_mem.fill_from_elf(truncated));
+}
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "tests/tt_metal/tt_metal/unit_tests/common/basic_fixture.hpp"
+#include "tt_metal/jit_build/binary_cache.hpp"
+
+using namespace tt::tt_metal;
+
+namespace unit_tests::jit_binary_cache {
+
+namespace fs = std::filesystem;
+
+fs::path make_temp_dir(const std::string &name) {
+    fs::path dir = fs::temp_directory_path() / ("tt_metal_" + name + "_" + std::to_string(getpid()));
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    return dir;
+}
+
+void write_file(const fs::path &path, const std::string &contents) {
+    std::ofstream file(path, std::ios::binary);
+    file << contents;
+}
+
+std::string read_file(const fs::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+}  // namespace unit_tests::jit_binary_cache
+
+TEST_F(BasicFixture, TestJitBuildDigestIsSha256) {
+    JitBuildDigest empty;
+    EXPECT_EQ(empty.hex_digest(), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+
+    JitBuildDigest abc;
+    abc.update("abc", 3);
+    EXPECT_EQ(abc.hex_digest(), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+
+    // Spans more than one block
+    std::string message = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    JitBuildDigest split;
+    split.update(message.data(), 10);
+    split.update(message.data() + 10, message.size() - 10);
+    EXPECT_EQ(split.hex_digest(), "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+}
+
+TEST_F(BasicFixture, TestJitBinaryCacheFetchesPublishedEntries) {
+    using namespace unit_tests::jit_binary_cache;
+    fs::path root = make_temp_dir("binary_cache");
+    fs::path built = make_temp_dir("binary_cache_built");
+    fs::path loaded = make_temp_dir("binary_cache_loaded");
+    write_file(built / "brisc.elf", "brisc binary");
+
+    JitBinaryCache cache(root.string(), 1 << 20);
+    EXPECT_FALSE(cache.fetch("digest", loaded.string(), {"brisc.elf"}));
+    {
+        auto lock = cache.lock_entry("digest");
+        cache.publish("digest", built.string(), {"brisc.elf"});
+    }
+    // A second publish of the same digest keeps the first entry
+    write_file(built / "brisc.elf", "other binary");
+    cache.publish("digest", built.string(), {"brisc.elf"});
+
+    EXPECT_TRUE(cache.fetch("digest", loaded.string(), {"brisc.elf"}));
+    EXPECT_EQ(read_file(loaded / "brisc.elf"), "brisc binary");
+    EXPECT_FALSE(cache.fetch("digest", loaded.string(), {"brisc.elf", "brisc.hex"}));
+    EXPECT_TRUE(fs::is_empty(root / "tmp"));
+
+    fs::remove_all(root);
+    fs::remove_all(built);
+    fs::remove_all(loaded);
+}
+
+TEST_F(BasicFixture, TestJitBinaryCacheEvictsLeastRecentlyUsed) {
+    using namespace unit_tests::jit_binary_cache;
+    fs::path root = make_temp_dir("binary_cache_lru");
+    fs::path built = make_temp_dir("binary_cache_lru_built");
+    write_file(built / "trisc0.elf", std::string(1000, 'x'));
+
+    // Room for two entries
+    JitBinaryCache cache(root.string(), 2500);
+    cache.publish("a", built.string(), {"trisc0.elf"});
+    cache.publish("b", built.string(), {"trisc0.elf"});
+    // Make a the most recently used
+    fs::last_write_time(root / "entries" / "b", fs::last_write_time(root / "entries" / "b") - std::chrono::hours(1));
+    EXPECT_TRUE(cache.fetch("a", built.string(), {"trisc0.elf"}));
+    cache.publish("c", built.string(), {"trisc0.elf"});
+
+    EXPECT_LE(cache.size_bytes(), 2500);
+    EXPECT_TRUE(fs::exists(root / "entries" / "a"));
+    EXPECT_FALSE(fs::exists(root / "entries" / "b"));
+    EXPECT_TRUE(fs::exists(root / "entries" / "c"));
+
+    fs::remove_all(root);
+    fs::remove_all(built);
+}
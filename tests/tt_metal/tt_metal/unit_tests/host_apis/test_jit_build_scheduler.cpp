@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include "tests/tt_metal/tt_metal/unit_tests/common/basic_fixture.hpp"
+#include "tt_metal/jit_build/build_scheduler.hpp"
+
+using namespace tt::tt_metal;
+
+TEST_F(BasicFixture, TestJitBuildSchedulerRunsDependenciesFirstWithinCap) {
+    JitBuildScheduler scheduler(2);
+    std::atomic<uint32_t> num_running = 0;
+    std::atomic<uint32_t> max_running = 0;
+    std::atomic<uint32_t> num_compiled = 0;
+
+    std::vector<JitBuildJobHandle> compiled;
+    for (int i = 0; i < 8; i++) {
+        compiled.push_back(scheduler.submit("obj" + std::to_string(i), "compile", JitBuildStage::COMPILE, [&] {
+            uint32_t running = ++num_running;
+            uint32_t max = max_running;
+            while (running > max and not max_running.compare_exchange_weak(max, running)) {}
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            num_running--;
+            num_compiled++;
+        }));
+    }
+    uint32_t num_compiled_at_link = 0;
+    auto linked = scheduler.submit("elf", "link", JitBuildStage::LINK, [&] { num_compiled_at_link = num_compiled; }, compiled);
+    scheduler.wait({linked});
+
+    EXPECT_EQ(num_compiled_at_link, 8);
+    EXPECT_LE(max_running, 2);
+    auto stats = scheduler.get_stats();
+    EXPECT_EQ(stats.num_jobs_run, 9);
+    EXPECT_LE(stats.max_running_jobs, 2);
+    EXPECT_GE(linked->get_run_ms(), 0);
+}
+
+TEST_F(BasicFixture, TestJitBuildSchedulerDeduplicatesJobsInFlight) {
+    JitBuildScheduler scheduler(4);
+    std::atomic<bool> release = false;
+    std::atomic<uint32_t> num_runs = 0;
+    auto work = [&] {
+        while (not release) {
+            std::this_thread::yield();
+        }
+        num_runs++;
+    };
+
+    auto first = scheduler.submit("kernel/brisc.o", "compile", JitBuildStage::COMPILE, work);
+    auto second = scheduler.submit("kernel/brisc.o", "compile", JitBuildStage::COMPILE, work);
+    EXPECT_EQ(first, second);
+    release = true;
+    scheduler.wait({first, second});
+    EXPECT_EQ(num_runs, 1);
+    EXPECT_EQ(scheduler.get_stats().num_jobs_deduplicated, 1);
+
+    // Once finished the job runs again, the output may be stale
+    scheduler.wait({scheduler.submit("kernel/brisc.o", "compile", JitBuildStage::COMPILE, work)});
+    EXPECT_EQ(num_runs, 2);
+}
+
+TEST_F(BasicFixture, TestJitBuildSchedulerFailsDependentsOfFailedJobs) {
+    JitBuildScheduler scheduler(2);
+    bool linked_ran = false;
+    auto compiled = scheduler.submit("obj", "compile", JitBuildStage::COMPILE, [] { throw std::runtime_error("compile failed"); });
+    auto linked = scheduler.submit("elf", "link", JitBuildStage::LINK, [&] { linked_ran = true; }, {compiled});
+    EXPECT_THROW(scheduler.wait({linked}), std::runtime_error);
+    EXPECT_FALSE(linked_ran);
+
+    // Submitting against a failed job fails straight away
+    auto extracted = scheduler.submit("hex", "extract", JitBuildStage::EXTRACT, [] {}, {linked});
+    EXPECT_THROW(scheduler.wait({extracted}), std::runtime_error);
+    EXPECT_EQ(scheduler.get_stats().num_jobs_failed, 1);
+}
+
+TEST_F(BasicFixture, TestJitBuildSchedulerDeduplicatesBuildsUntilAllJobsFinish) {
+    JitBuildScheduler scheduler(4);
+    std::atomic<bool> release_link = false;
+    std::atomic<uint32_t> num_compiles = 0;
+    std::atomic<uint32_t> num_links = 0;
+    auto submit_jobs = [&] {
+        auto compiled = scheduler.submit("kernel/brisc.o", "compile", JitBuildStage::COMPILE, [&] { num_compiles++; });
+        auto linked = scheduler.submit("kernel/brisc.elf", "link", JitBuildStage::LINK, [&] {
+            while (not release_link) {
+                std::this_thread::yield();
+            }
+            num_links++;
+        }, {compiled});
+        return std::vector<JitBuildJobHandle>{linked};
+    };
+
+    auto first = scheduler.submit_build("kernel/brisc", submit_jobs);
+    while (num_compiles == 0) {
+        std::this_thread::yield();
+    }
+    // The compile has finished but the link reading its output hasn't, the build isn't submitted again
+    auto second = scheduler.submit_build("kernel/brisc", submit_jobs);
+    EXPECT_EQ(first, second);
+    release_link = true;
+    scheduler.wait(second);
+    EXPECT_EQ(num_compiles, 1);
+    EXPECT_EQ(num_links, 1);
+    EXPECT_EQ(scheduler.get_stats().num_builds_deduplicated, 1);
+
+    // Once finished the build runs again
+    scheduler.wait(scheduler.submit_build("kernel/brisc", submit_jobs));
+    EXPECT_EQ(num_compiles, 2);
+}
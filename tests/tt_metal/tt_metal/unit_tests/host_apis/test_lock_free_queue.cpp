@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "tests/tt_metal/tt_metal/unit_tests/common/basic_fixture.hpp"
+#include "tt_metal/impl/dispatch/lock_free_queue.hpp"
+
+using namespace tt::tt_metal;
+
+TEST_F(BasicFixture, TestLockFreeSPSCQueueIsBounded) {
+    LockFreeSPSCQueue<uint32_t> queue(5);
+    EXPECT_EQ(queue.capacity(), 8);
+
+    for (uint32_t i = 0; i < 8; i++) {
+        EXPECT_TRUE(queue.try_push(i));
+    }
+    uint32_t e = 100;
+    EXPECT_FALSE(queue.try_push(e));
+    EXPECT_EQ(queue.size(), 8);
+
+    for (uint32_t i = 0; i < 8; i++) {
+        EXPECT_TRUE(queue.try_pop(e));
+        EXPECT_EQ(e, i);
+    }
+    EXPECT_FALSE(queue.try_pop(e));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(BasicFixture, TestLockFreeSPSCQueueKeepsOrderAcrossThreads) {
+    constexpr uint32_t num_elements = 1 << 20;
+    // Move only elements, and a small ring so both sides keep wrapping and waiting on each other
+    LockFreeSPSCQueue<std::unique_ptr<uint32_t>> queue(16);
+
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < num_elements; i++) {
+            queue.push(std::make_unique<uint32_t>(i));
+        }
+    });
+
+    uint32_t num_out_of_order = 0;
+    for (uint32_t i = 0; i < num_elements; i++) {
+        std::unique_ptr<uint32_t> e = queue.pop();
+        if (e == nullptr or *e != i) {
+            num_out_of_order++;
+        }
+    }
+    producer.join();
+
+    EXPECT_EQ(num_out_of_order, 0);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(BasicFixture, TestLockFreeSPSCQueueBatches) {
+    LockFreeSPSCQueue<uint32_t> queue(8, LockFreeQueueWaitMode::SPIN);
+    std::vector<uint32_t> in = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    // Only as much as fits
+    EXPECT_EQ(queue.try_push_batch(in.data(), in.size()), 8);
+
+    std::vector<uint32_t> out(10);
+    EXPECT_EQ(queue.try_pop_batch(out.data(), 3), 3);
+    EXPECT_EQ(queue.try_push_batch(in.data() + 8, 2), 2);
+    EXPECT_EQ(queue.try_pop_batch(out.data() + 3, 10), 7);
+    EXPECT_EQ(in, out);
+}
+
+TEST_F(BasicFixture, TestLockFreeMPSCQueueKeepsEachProducersOrder) {
+    constexpr uint32_t num_producers = 4;
+    constexpr uint32_t num_elements_per_producer = 1 << 18;
+    constexpr uint32_t batch_size = 7;
+    LockFreeMPSCQueue<uint64_t> queue(64);
+
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < num_producers; p++) {
+        producers.emplace_back([&, p] {
+            // Half of the producers push in batches
+            std::vector<uint64_t> batch;
+            for (uint32_t i = 0; i < num_elements_per_producer; i++) {
+                uint64_t e = (uint64_t(p) << 32) | i;
+                if (p % 2 == 0) {
+                    queue.push(e);
+                    continue;
+                }
+                batch.push_back(e);
+                if (batch.size() == batch_size or i == num_elements_per_producer - 1) {
+                    queue.push_batch(batch.data(), batch.size());
+                    batch.clear();
+                }
+            }
+        });
+    }
+
+    std::vector<uint32_t> next(num_producers, 0);
+    uint32_t num_out_of_order = 0;
+    std::vector<uint64_t> batch(16);
+    for (uint32_t num_popped = 0; num_popped < num_producers * num_elements_per_producer;) {
+        size_t n = queue.pop_batch(batch.data(), batch.size());
+        for (size_t i = 0; i < n; i++) {
+            uint32_t p = batch[i] >> 32;
+            if (p >= num_producers or uint32_t(batch[i]) != next[p]) {
+                num_out_of_order++;
+                continue;
+            }
+            next[p]++;
+        }
+        num_popped += n;
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_EQ(num_out_of_order, 0);
+    EXPECT_EQ(next, std::vector<uint32_t>(num_producers, num_elements_per_producer));
+    uint64_t e;
+    EXPECT_FALSE(queue.try_pop(e));
+}
@@ -10,6 +10,7 @@
 #include "tt_metal/host_api.hpp"
 #include "tt_metal/test_utils/env_vars.hpp"
 #include "tt_metal/detail/tt_metal.hpp"
+#include "tt_metal/llrt/rtoptions.hpp"
 
 using namespace tt::tt_metal;
 
@@ -127,6 +128,26 @@ bool test_EnqueueWriteBuffer_and_EnqueueReadBuffer(Device* device, CommandQueue&
     return pass;
 }
 
+bool test_EnqueueWriteBufferPages_and_EnqueueReadBuffer(Device* device, CommandQueue& cq, const TestBufferConfig& config, uint32_t pages_per_write) {
+    size_t buf_size = config.num_pages * config.page_size;
+    Buffer bufa(device, buf_size, config.page_size, config.buftype);
+
+    vector<uint32_t> src = generate_arange_vector(bufa.size());
+
+    // Write the buffer back to front in ranges of pages, each sourced from its own offset into src
+    const char* src_bytes = reinterpret_cast<const char*>(src.data());
+    for (uint32_t end_page = config.num_pages; end_page > 0;) {
+        uint32_t num_pages = std::min(pages_per_write, end_page);
+        uint32_t dst_page_index = end_page - num_pages;
+        EnqueueWriteBufferPages(cq, bufa, src_bytes + dst_page_index * config.page_size, dst_page_index, num_pages, false);
+        end_page = dst_page_index;
+    }
+
+    vector<uint32_t> result(buf_size / sizeof(uint32_t));
+    EnqueueReadBuffer(cq, bufa, result.data(), true);
+    return src == result;
+}
+
 bool stress_test_EnqueueWriteBuffer_and_EnqueueReadBuffer(
     Device* device, CommandQueue& cq, const BufferStressTestConfig& config) {
     srand(config.seed);
@@ -305,6 +326,18 @@ TEST_F(CommandQueueFixture, TestNon32BAlignedPageSizeForDram2) {
     EXPECT_TRUE(local_test_functions::test_EnqueueWriteBuffer_and_EnqueueReadBuffer(this->device_, tt::tt_metal::detail::GetCommandQueue(device_), config));
 }
 
+TEST_F(CommandQueueFixture, WritePageRangesToAllDramBanks) {
+    TestBufferConfig config = {.num_pages = 1000, .page_size = 2048, .buftype = BufferType::DRAM};
+
+    EXPECT_TRUE(local_test_functions::test_EnqueueWriteBufferPages_and_EnqueueReadBuffer(this->device_, tt::tt_metal::detail::GetCommandQueue(device_), config, 37));
+}
+
+TEST_F(CommandQueueFixture, WritePageRangesNon32BAlignedPageSizeForDram) {
+    TestBufferConfig config = {.num_pages = 1250, .page_size = 200, .buftype = BufferType::DRAM};
+
+    EXPECT_TRUE(local_test_functions::test_EnqueueWriteBufferPages_and_EnqueueReadBuffer(this->device_, tt::tt_metal::detail::GetCommandQueue(device_), config, 100));
+}
+
 TEST_F(CommandQueueFixture, TestPageSizeTooLarge) {
     if (this->arch_ == tt::ARCH::WORMHOLE_B0) {
         GTEST_SKIP(); // This test hanging on wormhole b0
@@ -469,6 +502,73 @@ TEST_F(CommandQueueFixture, TestBackToBackNon32BAlignedPageSize) {
 }
 
 }  // end namespace l1_tests
+
+namespace async_tests {
+
+TEST_F(CommandQueueFixture, TestAsyncNonBlockingWritesAndReads) {
+    tt::llrt::OptionsG.set_async_command_queue_enabled(true);
+    CommandQueue& cq = tt::tt_metal::detail::GetCommandQueue(device_);
+
+    Buffer bufa(device_, 125000, 100, BufferType::L1);
+    auto src_a = local_test_functions::generate_arange_vector(bufa.size());
+    EnqueueWriteBuffer(cq, bufa, src_a, false);
+
+    Buffer bufb(device_, 152000, 2048, BufferType::DRAM);
+    auto src_b = local_test_functions::generate_arange_vector(bufb.size());
+    EnqueueWriteBuffer(cq, bufb, src_b, false);
+
+    vector<uint32_t> result_a;
+    EnqueueReadBuffer(cq, bufa, result_a, false);
+    vector<uint32_t> result_b;
+    EnqueueReadBuffer(cq, bufb, result_b, false);
+
+    Event event = EnqueueRecordEvent(cq);
+    EventSynchronize(event);
+    EXPECT_TRUE(EventQuery(event));
+    EXPECT_EQ(src_a, result_a);
+    EXPECT_EQ(src_b, result_b);
+
+    // Blocking calls still return with the work done
+    vector<uint32_t> result_a_blocking;
+    EnqueueReadBuffer(cq, bufa, result_a_blocking, true);
+    EXPECT_EQ(src_a, result_a_blocking);
+    Finish(cq);
+
+    tt::llrt::OptionsG.set_async_command_queue_enabled(false);
+}
+
+TEST_F(CommandQueueFixture, TestNonBlockingReadsWithoutAsyncMode) {
+    CommandQueue& cq = tt::tt_metal::detail::GetCommandQueue(device_);
+
+    // Pages that aren't 32B aligned, the last ones of each buffer have no room for their padding in dst
+    vector<std::unique_ptr<Buffer>> buffers;
+    vector<vector<uint32_t>> srcs;
+    for (uint32_t page_size : {100, 2052, 36}) {
+        buffers.push_back(std::make_unique<Buffer>(device_, page_size * 1000, page_size, BufferType::DRAM));
+        srcs.push_back(local_test_functions::generate_arange_vector(buffers.back()->size()));
+        EnqueueWriteBuffer(cq, *buffers.back(), srcs.back(), false);
+    }
+
+    vector<vector<uint32_t>> results(buffers.size());
+    for (uint32_t i = 0; i < buffers.size(); i++) {
+        EnqueueReadBuffer(cq, *buffers[i], results[i], false);
+    }
+    // Overwriting a buffer after its read was issued doesn't change what the read returns
+    vector<uint32_t> zeros(srcs[0].size(), 0);
+    EnqueueWriteBuffer(cq, *buffers[0], zeros, false);
+
+    EventSynchronize(EnqueueRecordEvent(cq));
+    for (uint32_t i = 0; i < buffers.size(); i++) {
+        EXPECT_EQ(srcs[i], results[i]);
+    }
+
+    vector<uint32_t> result_zeros;
+    EnqueueReadBuffer(cq, *buffers[0], result_zeros, false);
+    Finish(cq);
+    EXPECT_EQ(zeros, result_zeros);
+}
+
+}  // end namespace async_tests
 }  // end namespace basic_tests
 
 namespace stress_tests {
@@ -490,6 +590,17 @@ TEST_F(CommandQueueFixture, ShardedBufferReadWrites) {
         local_test_functions::stress_test_EnqueueWriteBuffer_and_EnqueueReadBuffer_sharded(this->device_, tt::tt_metal::detail::GetCommandQueue(this->device_), config));
 }
 
+TEST_F(CommandQueueFixture, BlockShardedBufferReadWrites) {
+    // Pages are reordered between host and device order, src must come back unchanged
+    BufferStressTestConfigSharded config({2,2}, {4,2});
+    config.seed = 0;
+    config.num_iterations = 10;
+    config.mem_config = TensorMemoryLayout::BLOCK_SHARDED;
+
+    EXPECT_TRUE(
+        local_test_functions::stress_test_EnqueueWriteBuffer_and_EnqueueReadBuffer_sharded(this->device_, tt::tt_metal::detail::GetCommandQueue(this->device_), config));
+}
+
 TEST_F(CommandQueueFixture, StressWrapTest) {
     const char* arch = getenv("ARCH_NAME");
     if ( strcasecmp(arch,"wormhole_b0") == 0 ) {
@@ -115,6 +115,25 @@ Tensor Tensor::to(Device *target_device, const MemoryConfig &mem_config) const {
     return tensor_impl::to_device_wrapper(*this, target_device, mem_config);
 }
 
+Tensor Tensor::to(Device *target_device, Layout target_layout, const MemoryConfig &mem_config) const {
+    ZoneScoped;
+    if (storage_type() == StorageType::DEVICE) {
+        TT_ASSERT(this->device() == target_device && "Currently do not support moving between devices");
+        TT_ASSERT(this->layout() == target_layout && "Bring tensor to host before converting to target layout");
+        return *this;
+    }
+    TT_ASSERT(!mem_config.is_sharded() &&
+                " Cannot be sharded, if sharded use to(Device *target_device, const MemoryConfig &mem_config, const ShardSpec & shard_spec)  instead");
+    tensor_impl::validate_on_device_dtype_and_layout(target_device, this->dtype(), target_layout);
+
+    // Fast dispatch can take the tensor a range of pages at a time, so BFLOAT16 tensors are tilized while they are uploaded
+    const bool fast_dispatch = std::getenv("TT_METAL_SLOW_DISPATCH_MODE") == nullptr;
+    if (fast_dispatch and this->dtype() == DataType::BFLOAT16 and this->layout() == Layout::ROW_MAJOR and target_layout == Layout::TILE) {
+        return tensor_impl::to_device_tilized_wrapper(*this, target_device, mem_config);
+    }
+    return this->to(target_layout).to(target_device, mem_config);
+}
+
 Tensor Tensor::cpu() const {
     ZoneScoped;
     if (storage_type() == StorageType::OWNED) {
@@ -43,6 +43,8 @@ class Tensor {
 
         Tensor to(Device *target_device, const MemoryConfig &mem_config={.memory_layout=tt::tt_metal::TensorMemoryLayout::INTERLEAVED}) const;
         Tensor to(Device *target_device, const MemoryConfig &mem_config, const ShardSpec & shard_spec) const;
+        // Moves the tensor to device and converts it to target_layout on the way
+        Tensor to(Device *target_device, Layout target_layout, const MemoryConfig &mem_config={.memory_layout=tt::tt_metal::TensorMemoryLayout::INTERLEAVED}) const;
 
         Tensor to(Layout target_layout) const;
 
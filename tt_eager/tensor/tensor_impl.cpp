@@ -182,6 +182,39 @@ void validate_on_device_dtype_and_layout(Device *device, DataType dtype, Layout
     supported_layout();
 }
 
+namespace detail {
+
+// bfloat8_b tiles are packed independently of each other, so conversions to and from FLOAT32 are split across the
+// executor by tile
+std::vector<float> unpack_bfp8_tiles_into_float_vec_parallel(const std::vector<uint32_t>& packed_data) {
+    const uint32_t packed_tile_size = constants::BFLOAT8_B_TILE_HW / sizeof(uint32_t);
+    const size_t num_tiles = packed_data.size() / packed_tile_size;
+    std::vector<float> float_data(num_tiles * constants::TILE_HW);
+    ::tt::tt_metal::detail::parallel_for(num_tiles, host_conversion_grain(constants::TILE_HW), [&](size_t begin, size_t end) {
+        const std::vector<uint32_t> packed_tiles(
+            packed_data.begin() + begin * packed_tile_size, packed_data.begin() + end * packed_tile_size);
+        const auto float_tiles = unpack_bfp8_tiles_into_float_vec(packed_tiles, /*row_major_output=*/false, /*is_exp_a=*/false);
+        std::copy(float_tiles.begin(), float_tiles.end(), float_data.begin() + begin * constants::TILE_HW);
+    });
+    return float_data;
+}
+
+std::vector<uint32_t> pack_fp32_vec_as_bfp8_tiles_parallel(const std::vector<float>& float_data) {
+    const uint32_t packed_tile_size = constants::BFLOAT8_B_TILE_HW / sizeof(uint32_t);
+    const size_t num_tiles = float_data.size() / constants::TILE_HW;
+    std::vector<uint32_t> packed_data(num_tiles * packed_tile_size);
+    ::tt::tt_metal::detail::parallel_for(num_tiles, host_conversion_grain(constants::TILE_HW), [&](size_t begin, size_t end) {
+        for (size_t tile = begin; tile < end; tile++) {
+            pack_fp32_tile_as_bfp8(
+                float_data.data() + tile * constants::TILE_HW, /*row_major_input=*/false, /*row_stride=*/constants::TILE_WIDTH,
+                /*is_exp_a=*/false, packed_data.data() + tile * packed_tile_size);
+        }
+    });
+    return packed_data;
+}
+
+}  // namespace detail
+
 Tensor to_layout_bfloat8_b(const Tensor &tensor, Layout target_layout) {
     // TODO(arakhmati): do not convert to FLOAT32
 
@@ -191,13 +224,13 @@ Tensor to_layout_bfloat8_b(const Tensor &tensor, Layout target_layout) {
 
     // Convert to FLOAT32 tensor and change layout
     auto input_packed_data = owned_buffer::get_as<uint32_t>(tensor).get();
-    auto input_float_data = unpack_bfp8_tiles_into_float_vec(input_packed_data, /*row_major_output=*/false, /*is_exp_a=*/false);
+    auto input_float_data = detail::unpack_bfp8_tiles_into_float_vec_parallel(input_packed_data);
     auto input_float_buffer = owned_buffer::create<float>(std::move(input_float_data));
     auto float_tensor = Tensor(OwnedStorage{input_float_buffer}, tensor.shape(), DataType::FLOAT32, tensor.layout()).to(target_layout);
 
     // Convert back to BFLOAT8_B
     auto output_float_data = owned_buffer::get_as<float>(float_tensor).get();
-    auto output_packed_data = pack_fp32_vec_as_bfp8_tiles(output_float_data, /*row_major_input=*/false, /*is_exp_a=*/false);
+    auto output_packed_data = detail::pack_fp32_vec_as_bfp8_tiles_parallel(output_float_data);
     auto output_uint32_buffer = owned_buffer::create<uint32_t>(std::move(output_packed_data));
     return Tensor(std::move(OwnedStorage{std::move(output_uint32_buffer)}), tensor.shape(), DataType::BFLOAT8_B, target_layout);
 }
@@ -208,13 +241,13 @@ Tensor pad_bfloat8_b(const Tensor &tensor, const Shape& output_tensor_shape, con
 
     // Convert to FLOAT32 tensor and pad
     auto input_packed_data = owned_buffer::get_as<uint32_t>(tensor).get();
-    auto input_float_data = unpack_bfp8_tiles_into_float_vec(input_packed_data, /*row_major_output=*/false, /*is_exp_a=*/false);
+    auto input_float_data = detail::unpack_bfp8_tiles_into_float_vec_parallel(input_packed_data);
     auto input_float_buffer = owned_buffer::create<float>(std::move(input_float_data));
     auto float_tensor = Tensor(OwnedStorage{input_float_buffer}, tensor.shape(), DataType::FLOAT32, tensor.layout()).pad(output_tensor_shape, input_tensor_start, pad_value);
 
     // Convert back to BFLOAT8_B
     auto output_float_data = owned_buffer::get_as<float>(float_tensor).get();
-    auto output_packed_data = pack_fp32_vec_as_bfp8_tiles(output_float_data, /*row_major_input=*/false, /*is_exp_a=*/false);
+    auto output_packed_data = detail::pack_fp32_vec_as_bfp8_tiles_parallel(output_float_data);
     auto output_uint32_buffer = owned_buffer::create<uint32_t>(std::move(output_packed_data));
     return Tensor(std::move(OwnedStorage{std::move(output_uint32_buffer)}), float_tensor.shape(), DataType::BFLOAT8_B, tensor.layout());
 }
@@ -224,13 +257,13 @@ Tensor unpad_bfloat8_b(const Tensor &tensor, const Shape& output_tensor_start, c
 
     // Convert to FLOAT32 tensor and unpad
     auto input_packed_data = owned_buffer::get_as<uint32_t>(tensor).get();
-    auto input_float_data = unpack_bfp8_tiles_into_float_vec(input_packed_data, /*row_major_output=*/false, /*is_exp_a=*/false);
+    auto input_float_data = detail::unpack_bfp8_tiles_into_float_vec_parallel(input_packed_data);
     auto input_float_buffer = owned_buffer::create<float>(std::move(input_float_data));
     auto float_tensor = Tensor(OwnedStorage{input_float_buffer}, tensor.shape(), DataType::FLOAT32, tensor.layout()).unpad(output_tensor_start, output_tensor_end);
 
     // Convert back to BFLOAT8_B
     auto output_float_data = owned_buffer::get_as<float>(float_tensor).get();
-    auto output_packed_data = pack_fp32_vec_as_bfp8_tiles(output_float_data, /*row_major_input=*/false, /*is_exp_a=*/false);
+    auto output_packed_data = detail::pack_fp32_vec_as_bfp8_tiles_parallel(output_float_data);
     auto output_uint32_buffer = owned_buffer::create<uint32_t>(std::move(output_packed_data));
     return Tensor(std::move(OwnedStorage{std::move(output_uint32_buffer)}), float_tensor.shape(), DataType::BFLOAT8_B, tensor.layout());
 }
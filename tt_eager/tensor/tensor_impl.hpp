@@ -9,6 +9,8 @@
 #include "tensor/tensor.hpp"
 #include "tensor/tensor_utils.hpp"
 #include "tensor/types.hpp"
+#include "tt_metal/common/executor.hpp"
+#include "tt_metal/common/tile_transpose.hpp"
 #include "tt_metal/detail/tt_metal.hpp"
 #include "tt_metal/host_api.hpp"
 #include "tt_metal/impl/dispatch/command_queue.hpp"
@@ -135,6 +137,15 @@ constexpr inline uint32_t packed_buffer_size_bytes<float>(uint32_t volume_unpack
 //                                  Layout converters
 // ======================================================================================
 namespace detail {
+// Minimum number of elements handled by one host task when layout conversion, pad and unpad are split across the
+// executor. Can be tuned with TT_METAL_HOST_CONVERSION_GRAIN_SIZE.
+static const size_t HOST_CONVERSION_GRAIN_SIZE = std::getenv("TT_METAL_HOST_CONVERSION_GRAIN_SIZE") ? std::stoul(std::getenv("TT_METAL_HOST_CONVERSION_GRAIN_SIZE")) : 1 << 18;
+
+// Number of work items of `item_size` elements that make up one host task
+inline size_t host_conversion_grain(size_t item_size) {
+    return std::max<size_t>(HOST_CONVERSION_GRAIN_SIZE / std::max<size_t>(item_size, 1), 1);
+}
+
 static std::vector<uint32_t> to_4D_shape(const Shape& shape) {
     if (shape.rank() == 1) {
         return {1, 1, 1, shape[-1]};
@@ -155,14 +166,43 @@ inline std::vector<T> convert_layout_row_major_to_tile(const Shape& shape, const
     TT_ASSERT(
         (shape[-2] % tt::constants::TILE_HEIGHT == 0 && shape[-1] % tt::constants::TILE_WIDTH == 0),
         "Unsupported shape for tensor conversion");
-    auto shape_vec = detail::to_4D_shape(shape);
-    return convert_layout(data_to_convert, shape_vec, TensorLayout::LIN_ROW_MAJOR, TensorLayout::TILED32_4FACES);
+    std::vector<T> output(data_to_convert.size());
+    if (output.empty()) {
+        return output;
+    }
+    // Rows of every [H, W] matrix are stacked, so the whole tensor tilizes as one (volume / W) x W matrix.
+    // Rows of tiles span batch, channel and height, and are converted in parallel.
+    const uint32_t width = shape[-1];
+    const size_t tile_row_size = tt::constants::TILE_HEIGHT * width;
+    const T* input = &data_to_convert[0];
+    T* output_ptr = output.data();
+    ::tt::tt_metal::detail::parallel_for(
+        data_to_convert.size() / tile_row_size, detail::host_conversion_grain(tile_row_size),
+        [input, output_ptr, width](size_t begin, size_t end) {
+            tile_transpose::tilize_tile_rows(input, output_ptr, width, begin, end);
+        });
+    return output;
 }
 
 template <typename T, template<typename> typename BufferType>
 inline std::vector<T> convert_layout_tile_to_row_major(const Shape& shape, const BufferType<T>& data_to_convert) {
-    auto shape_vec = detail::to_4D_shape(shape);
-    return convert_layout(data_to_convert, shape_vec, TensorLayout::TILED32_4FACES, TensorLayout::LIN_ROW_MAJOR);
+    TT_ASSERT(
+        (shape[-2] % tt::constants::TILE_HEIGHT == 0 && shape[-1] % tt::constants::TILE_WIDTH == 0),
+        "Unsupported shape for tensor conversion");
+    std::vector<T> output(data_to_convert.size());
+    if (output.empty()) {
+        return output;
+    }
+    const uint32_t width = shape[-1];
+    const size_t tile_row_size = tt::constants::TILE_HEIGHT * width;
+    const T* input = &data_to_convert[0];
+    T* output_ptr = output.data();
+    ::tt::tt_metal::detail::parallel_for(
+        data_to_convert.size() / tile_row_size, detail::host_conversion_grain(tile_row_size),
+        [input, output_ptr, width](size_t begin, size_t end) {
+            tile_transpose::untilize_tile_rows(input, output_ptr, width, begin, end);
+        });
+    return output;
 }
 
 // ======================================================================================
@@ -598,6 +638,118 @@ inline Tensor to_device_sharded(const Tensor &tensor, Device *target_device, con
     return Tensor(DeviceStorage{device_buffer}, shape, data_type, layout, shard_spec);
 }
 
+namespace detail {
+// Size of one host staging chunk when a tensor is tilized on its way to the device.
+// Can be tuned with TT_METAL_TILIZED_UPLOAD_CHUNK_SIZE, which is read by the first upload.
+inline size_t get_tilized_upload_chunk_size_bytes() {
+    static const size_t chunk_size_bytes = std::getenv("TT_METAL_TILIZED_UPLOAD_CHUNK_SIZE") ? std::stoul(std::getenv("TT_METAL_TILIZED_UPLOAD_CHUNK_SIZE")) : 1 << 20;
+    return chunk_size_bytes;
+}
+}  // namespace detail
+
+// Moves a ROW_MAJOR host tensor into an interleaved TILE device buffer without materializing the tiled tensor on host.
+// Rows of tiles are tilized straight from the (possibly borrowed) host data into one of two staging chunks, and the next
+// chunk is tilized on the executor while the current one is copied into the command queue.
+// A chunk is reused as soon as its non-blocking EnqueueWriteBufferPages returns, which the command queue allows in both
+// the sync and the async mode.
+// Only element types that are written to the device as-is are supported, which rules out float.
+template <typename T>
+inline Tensor to_device_tilized(const Tensor &tensor, Device *target_device, const MemoryConfig &memory_config) {
+    static_assert(packed_buffer_size_bytes<T>(1024) == 1024 * sizeof(T), "Element type is converted before it is written to device");
+    TT_ASSERT(tensor.storage_type() != StorageType::DEVICE);
+    TT_ASSERT(tensor.layout() == Layout::ROW_MAJOR);
+    TT_ASSERT(not memory_config.is_sharded(), "Sharded tensors have to be tilized on host before moving them to device");
+    TT_ASSERT(target_device != nullptr && "Need target device in order to move tensor to device!");
+    TT_ASSERT(tensor.is_allocated() && "Need data to exist in order to move it to device");
+
+    const auto shape = tensor.shape();
+    TT_ASSERT(
+        (shape[-2] % tt::constants::TILE_HEIGHT == 0 && shape[-1] % tt::constants::TILE_WIDTH == 0),
+        "Tensor shape incompatible for specified layout");
+
+    auto input_data = std::visit(
+        [] (auto&& storage) -> std::pair<const T*, size_t> {
+            using StorageType = std::decay_t<decltype(storage)>;
+            if constexpr (std::is_same_v<StorageType, OwnedStorage>) {
+                const auto data = owned_buffer::get_as<T>(storage.buffer);
+                return {data.begin(), data.size()};
+            }
+            else if constexpr (std::is_same_v<StorageType, BorrowedStorage>) {
+                const auto data = borrowed_buffer::get_as<T>(storage.buffer);
+                return {data.begin(), data.size()};
+            }
+            else if constexpr (std::is_same_v<StorageType, DeviceStorage>) {
+                TT_THROW("Device storage isn't supported");
+            }
+            else {
+                raise_unsupported_storage<StorageType>();
+            }
+        },
+        tensor.storage()
+    );
+    const T* input = input_data.first;
+    const size_t num_elements = input_data.second;
+    TT_ASSERT(
+        compute_buffer_size(shape, tensor.dtype()) == num_elements,
+        fmt::format("Tensor buffer size and number of data elements does not match: {} != {}", compute_buffer_size(shape, tensor.dtype()), num_elements)
+    );
+
+    auto device_buffer = allocate_buffer_on_device(
+        packed_buffer_size_bytes<T>(num_elements), target_device, shape, tensor.dtype(), Layout::TILE, memory_config);
+
+    const uint32_t width = shape[-1];
+    const size_t tile_row_size = tt::constants::TILE_HEIGHT * width;
+    const uint32_t pages_per_tile_row = width / tt::constants::TILE_WIDTH;
+    const size_t num_tile_rows = num_elements / tile_row_size;
+    if (num_tile_rows == 0) {
+        return Tensor(DeviceStorage{device_buffer}, shape, tensor.dtype(), Layout::TILE);
+    }
+    const size_t chunk_tile_rows = std::clamp<size_t>(
+        detail::get_tilized_upload_chunk_size_bytes() / (tile_row_size * sizeof(T)), 1, num_tile_rows);
+
+    std::vector<T> staging[2] = {std::vector<T>(chunk_tile_rows * tile_row_size), std::vector<T>(chunk_tile_rows * tile_row_size)};
+    auto tilize_chunk = [input, width, tile_row_size, chunk_tile_rows, num_tile_rows](size_t first_tile_row, T* chunk) {
+        const size_t chunk_size = std::min(chunk_tile_rows, num_tile_rows - first_tile_row);
+        tile_transpose::tilize_tile_rows(input + first_tile_row * tile_row_size, chunk, width, 0, chunk_size);
+    };
+    // Don't block an executor worker on a task queued behind it
+    const bool overlap = ::tt::tt_metal::detail::GetExecutor().this_worker_id() == -1;
+
+    auto& command_queue = tt::tt_metal::detail::GetCommandQueue(target_device);
+    tilize_chunk(0, staging[0].data());
+    for (size_t first_tile_row = 0, index = 0; first_tile_row < num_tile_rows; first_tile_row += chunk_tile_rows, index ^= 1) {
+        const size_t next_tile_row = first_tile_row + chunk_tile_rows;
+        std::future<void> next_chunk;
+        if (next_tile_row < num_tile_rows) {
+            T* next_staging = staging[index ^ 1].data();
+            if (overlap) {
+                next_chunk = ::tt::tt_metal::detail::async([&tilize_chunk, next_tile_row, next_staging] { tilize_chunk(next_tile_row, next_staging); });
+            } else {
+                tilize_chunk(next_tile_row, next_staging);
+            }
+        }
+
+        // Non-blocking writes are done with their source when they return, the async command queue copies it, so the
+        // chunk can be reused right after
+        const size_t chunk_size = std::min(chunk_tile_rows, num_tile_rows - first_tile_row);
+        try {
+            EnqueueWriteBufferPages(
+                command_queue, *device_buffer, staging[index].data(),
+                first_tile_row * pages_per_tile_row, chunk_size * pages_per_tile_row, false);
+        } catch (...) {
+            // The pending chunk writes into staging, which must outlive it
+            if (next_chunk.valid()) {
+                next_chunk.wait();
+            }
+            throw;
+        }
+        if (next_chunk.valid()) {
+            next_chunk.get();
+        }
+    }
+    return Tensor(DeviceStorage{device_buffer}, shape, tensor.dtype(), Layout::TILE);
+}
+
 template <typename T>
 inline Tensor to_layout(const Tensor &tensor, Layout target_layout) {
     if(tensor.layout() == target_layout) {
@@ -683,49 +835,39 @@ inline Tensor pad(const Tensor &tensor, const Shape& output_tensor_shape, const
             {input_tensor_start[3], output_tensor_shape[3] - input_tensor_shape[3] - input_tensor_start[3]}
         };
 
-        const std::array<uint32_t, 4> output_tensor_strides = {
-            output_tensor_shape[1] * output_tensor_shape[2] * output_tensor_shape[3],
-            output_tensor_shape[2] * output_tensor_shape[3],
-            output_tensor_shape[3],
-            1
-        };
-
         auto output_buffer = owned_buffer::create<T>(compute_volume(output_tensor_shape));
-        auto output_index = 0;
-        for(auto i = 0; i < pad_size[0][0] * output_tensor_strides[0]; i++) {
-            output_buffer[output_index++] = pad_value_;
+        if (output_buffer.size() == 0) {
+            return output_buffer;
         }
-        for(auto dim0 = 0; dim0 < input_tensor_shape[0]; dim0++) {
-            for(auto i = 0; i < pad_size[1][0] * output_tensor_strides[1]; i++) {
-                output_buffer[output_index++] = pad_value_;
-            }
-            for(auto dim1 = 0; dim1 < input_tensor_shape[1]; dim1++) {
-                for(auto i = 0; i < pad_size[2][0] * output_tensor_strides[2]; i++) {
-                    output_buffer[output_index++] = pad_value_;
-                }
-                for(auto dim2 = 0; dim2 < input_tensor_shape[2]; dim2++) {
-                    for(auto i = 0; i < pad_size[3][0] * output_tensor_strides[3]; i++) {
-                        output_buffer[output_index++] = pad_value_;
-                    }
-                    for(auto dim3 = 0; dim3 < input_tensor_shape[3]; dim3++) {
-                        auto input_index = dim3 + input_tensor_strides[2] * dim2 + input_tensor_strides[1] * dim1 + input_tensor_strides[0] * dim0;
-                        output_buffer[output_index++] = input_buffer[input_index];
-                    }
-                    for(auto i = 0; i < pad_size[3][1] * output_tensor_strides[3]; i++) {
-                        output_buffer[output_index++] = pad_value_;
-                    }
+        T* output = output_buffer.begin();
+        // An empty input is all padding, its rows are never read
+        const T* input = input_buffer.size() == 0 ? nullptr : &input_buffer[0];
+
+        // Every output row (innermost dim) is either all padding or padding around one input row, so rows can be
+        // filled independently. Rows span batch, channel and height and are filled in parallel.
+        const uint32_t output_row_size = output_tensor_shape[3];
+        const size_t num_output_rows = compute_volume(output_tensor_shape) / output_row_size;
+        auto pad_rows = [&](size_t begin, size_t end) {
+            for (size_t row = begin; row < end; row++) {
+                T* output_row = output + row * output_row_size;
+                const int64_t dim2 = static_cast<int64_t>(row % output_tensor_shape[2]) - input_tensor_start[2];
+                const int64_t dim1 = static_cast<int64_t>((row / output_tensor_shape[2]) % output_tensor_shape[1]) - input_tensor_start[1];
+                const int64_t dim0 = static_cast<int64_t>(row / (output_tensor_shape[2] * output_tensor_shape[1])) - input_tensor_start[0];
+                const bool is_input_row =
+                    dim0 >= 0 and dim0 < input_tensor_shape[0] and
+                    dim1 >= 0 and dim1 < input_tensor_shape[1] and
+                    dim2 >= 0 and dim2 < input_tensor_shape[2];
+                if (not is_input_row) {
+                    std::fill(output_row, output_row + output_row_size, pad_value_);
+                    continue;
                 }
-                for(auto i = 0; i < pad_size[2][1] * output_tensor_strides[2]; i++) {
-                    output_buffer[output_index++] = pad_value_;
-                }
-            }
-            for(auto i = 0; i < pad_size[1][1] * output_tensor_strides[1]; i++) {
-                output_buffer[output_index++] = pad_value_;
+                const T* input_row = input + input_tensor_strides[2] * dim2 + input_tensor_strides[1] * dim1 + input_tensor_strides[0] * dim0;
+                std::fill(output_row, output_row + pad_size[3][0], pad_value_);
+                std::copy(input_row, input_row + input_tensor_shape[3], output_row + pad_size[3][0]);
+                std::fill(output_row + pad_size[3][0] + input_tensor_shape[3], output_row + output_row_size, pad_value_);
             }
-        }
-        for(auto i = 0; i < pad_size[0][1] * output_tensor_strides[0]; i++) {
-            output_buffer[output_index++] = pad_value_;
-        }
+        };
+        ::tt::tt_metal::detail::parallel_for(num_output_rows, detail::host_conversion_grain(output_row_size), pad_rows);
         return output_buffer;
     };
 
@@ -787,18 +929,26 @@ inline Tensor unpad(const Tensor &tensor, const Shape& output_tensor_start, cons
         [&input_tensor_shape, &input_tensor_strides, &output_tensor_shape, &output_tensor_start, &output_tensor_end](
             const auto& input_buffer) {
             auto output_buffer = owned_buffer::create<T>(compute_volume(output_tensor_shape));
-            auto output_index = 0;
-            for (auto dim0 = output_tensor_start[0]; dim0 <= output_tensor_end[0]; dim0++) {
-                for (auto dim1 = output_tensor_start[1]; dim1 <= output_tensor_end[1]; dim1++) {
-                    for (auto dim2 = output_tensor_start[2]; dim2 <= output_tensor_end[2]; dim2++) {
-                        for (auto dim3 = output_tensor_start[3]; dim3 <= output_tensor_end[3]; dim3++) {
-                            auto input_index = dim3 + input_tensor_strides[2] * dim2 + input_tensor_strides[1] * dim1 +
-                                               input_tensor_strides[0] * dim0;
-                            output_buffer[output_index++] = input_buffer[input_index];
-                        }
-                    }
-                }
+            if (output_buffer.size() == 0) {
+                return output_buffer;
             }
+            T* output = output_buffer.begin();
+            const T* input = &input_buffer[0];
+
+            // Every output row (innermost dim) is one contiguous slice of an input row, so rows are copied in parallel
+            const uint32_t output_row_size = output_tensor_shape[3];
+            const size_t num_output_rows = compute_volume(output_tensor_shape) / output_row_size;
+            auto unpad_rows = [&](size_t begin, size_t end) {
+                for (size_t row = begin; row < end; row++) {
+                    const uint32_t dim2 = output_tensor_start[2] + row % output_tensor_shape[2];
+                    const uint32_t dim1 = output_tensor_start[1] + (row / output_tensor_shape[2]) % output_tensor_shape[1];
+                    const uint32_t dim0 = output_tensor_start[0] + row / (output_tensor_shape[2] * output_tensor_shape[1]);
+                    const T* input_row = input + output_tensor_start[3] + input_tensor_strides[2] * dim2 +
+                                         input_tensor_strides[1] * dim1 + input_tensor_strides[0] * dim0;
+                    std::copy(input_row, input_row + output_row_size, output + row * output_row_size);
+                }
+            };
+            ::tt::tt_metal::detail::parallel_for(num_output_rows, detail::host_conversion_grain(output_row_size), unpad_rows);
             return output_buffer;
         };
 
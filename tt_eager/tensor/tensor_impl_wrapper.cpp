@@ -94,6 +94,14 @@ Tensor to_device_wrapper_sharded(const Tensor &tensor, Device *target_device, co
     return to_device_map.at(tensor.dtype())(tensor, target_device, mem_config, shard_spec);
 }
 
+Tensor to_device_tilized_wrapper(const Tensor &tensor, Device *target_device, const MemoryConfig &mem_config) {
+    const static std::unordered_map<DataType, std::function<Tensor(const Tensor &, Device *, const MemoryConfig &)>>
+        to_device_tilized_map = {
+            {DataType::BFLOAT16, &to_device_tilized<bfloat16>},
+        };
+    return to_device_tilized_map.at(tensor.dtype())(tensor, target_device, mem_config);
+}
+
 Tensor to_layout_wrapper(const Tensor &tensor, Layout target_layout) {
     const static std::unordered_map<DataType, std::function<Tensor(const Tensor &, Layout)>> to_layout_map = {
         {DataType::BFLOAT16, &to_layout<bfloat16>},
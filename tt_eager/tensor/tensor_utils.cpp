@@ -41,11 +41,13 @@ namespace tt_metal {
         }
         if constexpr (std::is_same<T, float>::value) {
             if (output_dtype == DataType::BFLOAT8_B) {
-                auto output_float_data = output_buffer.get();
-                auto output_packed_data = pack_fp32_vec_as_bfp8_tiles(output_float_data, /*row_major_input=*/false, /*is_exp_a=*/false);
+                // Tilize while packing instead of packing, unpacking, tilizing and packing again. The weights are
+                // quantized once, with an exponent shared by each face row of the tilized matrix, so the values
+                // can differ from the old double quantized ones
+                auto output_packed_data = pack_fp32_row_major_as_bfp8_tiles(
+                    output_buffer.begin(), weight_matrix_rows, weight_matrix_cols, /*is_exp_a=*/false);
                 auto output_uint32_buffer = owned_buffer::create<uint32_t>(std::move(output_packed_data));
-                auto rm_tensor = Tensor(std::move(OwnedStorage{std::move(output_uint32_buffer)}), output_shape, output_dtype, Layout::ROW_MAJOR);
-                return rm_tensor.to(Layout::TILE);
+                return Tensor(std::move(OwnedStorage{std::move(output_uint32_buffer)}), output_shape, output_dtype, Layout::TILE);
             }
         } else {
             TT_ASSERT(output_dtype != DataType::BFLOAT8_B);
@@ -86,11 +88,13 @@ namespace tt_metal {
         }
         if constexpr (std::is_same<T, float>::value) {
             if (output_dtype == DataType::BFLOAT8_B) {
-                auto output_float_data = output_buffer.get();
-                auto output_packed_data = pack_fp32_vec_as_bfp8_tiles(output_float_data, /*row_major_input=*/false, /*is_exp_a=*/false);
+                // Tilize while packing instead of packing, unpacking, tilizing and packing again. The weights are
+                // quantized once, with an exponent shared by each face row of the tilized matrix, so the values
+                // can differ from the old double quantized ones
+                auto output_packed_data = pack_fp32_row_major_as_bfp8_tiles(
+                    output_buffer.begin(), weight_matrix_rows, weight_matrix_cols, /*is_exp_a=*/false);
                 auto output_uint32_buffer = owned_buffer::create<uint32_t>(std::move(output_packed_data));
-                auto rm_tensor = Tensor(std::move(OwnedStorage{std::move(output_uint32_buffer)}), output_shape, output_dtype, Layout::ROW_MAJOR);
-                return rm_tensor.to(Layout::TILE);
+                return Tensor(std::move(OwnedStorage{std::move(output_uint32_buffer)}), output_shape, output_dtype, Layout::TILE);
             }
         } else {
             TT_ASSERT(output_dtype != DataType::BFLOAT8_B);
@@ -105,6 +105,7 @@ TT_DNN_SRCS = \
 	tt_eager/tt_dnn/op_library/transformer_tms/multi_core_concatenate_heads/multi_core_concatenate_heads.cpp \
 	tt_eager/tt_dnn/op_library/transformer_tms/multi_core_attn_matmul/multi_core_attn_matmul.cpp \
 	tt_eager/tt_dnn/op_library/run_operation.cpp \
+	tt_eager/tt_dnn/op_library/op_metrics.cpp \
 	tt_eager/tt_dnn/op_library/split/split_tiled.cpp \
 	tt_eager/tt_dnn/op_library/split/split_last_dim_two_chunks_tiled.cpp \
 	tt_eager/tt_dnn/op_library/operation_history.cpp \
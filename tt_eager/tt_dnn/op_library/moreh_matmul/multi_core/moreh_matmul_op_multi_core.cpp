@@ -235,19 +235,17 @@ operation::ProgramWithCallbacks moreh_matmul_multi_core(
             CoreCoord core = {i / num_cores_y, i % num_cores_y};
 
             {
-                auto runtime_args = GetRuntimeArgs(program, reader_kernel_id, core);
+                auto &runtime_args = GetRuntimeArgs(program, reader_kernel_id, core);
                 runtime_args[0] = src_dram_buffer_a->address();
                 runtime_args[1] = src_dram_buffer_b->address();
                 runtime_args[14] = a_start_tile_id;
                 runtime_args[15] = b_start_tile_id;
-                SetRuntimeArgs(program, reader_kernel_id, core, runtime_args);
             }
 
             {
-                auto runtime_args = GetRuntimeArgs(program, writer_kernel_id, core);
+                auto &runtime_args = GetRuntimeArgs(program, writer_kernel_id, core);
                 runtime_args[0] = dst_dram_buffer->address();
                 runtime_args[2] = output_start_tile_id;
-                SetRuntimeArgs(program, writer_kernel_id, core, runtime_args);
             }
         }
     };
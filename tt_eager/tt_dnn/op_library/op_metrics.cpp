@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tt_dnn/op_library/op_metrics.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace tt::tt_metal::op_metrics {
+
+namespace {
+
+// Counters of a shard are only written by the thread that owns it, so an increment is a relaxed load and store rather
+// than a locked read-modify-write. Other threads only read them.
+inline void add_relaxed(std::atomic<uint64_t>& counter, uint64_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+struct ShardHistogram {
+    std::array<std::atomic<uint64_t>, LATENCY_NUM_BUCKETS> bucket_counts{};
+    std::atomic<uint64_t> total_ns{0};
+
+    void add(uint64_t ns) {
+        add_relaxed(this->bucket_counts[latency_bucket(ns)], 1);
+        add_relaxed(this->total_ns, ns);
+    }
+
+    void accumulate_into(LatencyHistogram& histogram) const {
+        for (uint32_t bucket = 0; bucket < LATENCY_NUM_BUCKETS; bucket++) {
+            auto count = this->bucket_counts[bucket].load(std::memory_order_relaxed);
+            histogram.bucket_counts[bucket] += count;
+            histogram.count += count;
+        }
+        histogram.total_ns += this->total_ns.load(std::memory_order_relaxed);
+    }
+};
+
+struct ShardEntry {
+    ShardEntry(const std::string& op_type, operation::Hash program_hash) : op_type(op_type), program_hash(program_hash) {}
+
+    const std::string op_type;
+    const operation::Hash program_hash;
+    std::atomic<uint64_t> num_runs{0};
+    std::atomic<uint64_t> num_cache_hits{0};
+    ShardHistogram dispatch_time;
+    ShardHistogram compile_time;
+    // Next entry of the shard, set before the entry is published
+    ShardEntry* next = nullptr;
+};
+
+// Entries of one thread. A shard outlives its thread and is handed to the next thread that starts recording, so the
+// metrics of threads that exited stay in the snapshots. Shards and entries are never freed.
+struct Shard {
+    // Owned by the thread holding the shard
+    ShardEntry* find_or_add(const std::string& op_type, operation::Hash program_hash) {
+        auto& entries_with_hash = this->index[program_hash];
+        for (auto entry : entries_with_hash) {
+            if (entry->op_type == op_type) {
+                return entry;
+            }
+        }
+        auto entry = new ShardEntry(op_type, program_hash);
+        entry->next = this->entries.load(std::memory_order_relaxed);
+        this->entries.store(entry, std::memory_order_release);
+        entries_with_hash.push_back(entry);
+        return entry;
+    }
+
+    // Pushed to only by the owning thread, walked by snapshots
+    std::atomic<ShardEntry*> entries{nullptr};
+    std::atomic<bool> in_use{true};
+    std::unordered_map<operation::Hash, std::vector<ShardEntry*>> index;
+    Shard* next = nullptr;
+};
+
+using MetricsKey = std::pair<std::string, operation::Hash>;
+
+struct Registry {
+    std::atomic<Shard*> shards{nullptr};
+    std::atomic<bool> enabled{[] {
+        const char* enabled = std::getenv("TT_METAL_OP_METRICS");
+        return enabled == nullptr or std::string(enabled) != "0";
+    }()};
+
+    // Resets keep the totals at the time of the reset and snapshots subtract them, so recording never has to
+    // synchronize with a reset
+    std::mutex baseline_mutex;
+    std::map<MetricsKey, OpMetrics> baseline;
+};
+
+// Never destroyed, threads may still record while static objects are destroyed at exit
+Registry& get_registry() {
+    static Registry* registry = new Registry();
+    return *registry;
+}
+
+Shard* acquire_shard() {
+    auto& registry = get_registry();
+    for (auto shard = registry.shards.load(std::memory_order_acquire); shard != nullptr; shard = shard->next) {
+        bool in_use = false;
+        if (not shard->in_use.load(std::memory_order_relaxed) and
+            shard->in_use.compare_exchange_strong(in_use, true, std::memory_order_acquire)) {
+            return shard;
+        }
+    }
+    auto shard = new Shard();
+    shard->next = registry.shards.load(std::memory_order_relaxed);
+    while (not registry.shards.compare_exchange_weak(shard->next, shard, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+    return shard;
+}
+
+struct ThreadShard {
+    Shard* shard = acquire_shard();
+    // Publishes the index to the next thread that acquires the shard
+    ~ThreadShard() { this->shard->in_use.store(false, std::memory_order_release); }
+};
+
+// Totals of all shards since the start
+std::map<MetricsKey, OpMetrics> totals() {
+    std::map<MetricsKey, OpMetrics> totals;
+    for (auto shard = get_registry().shards.load(std::memory_order_acquire); shard != nullptr; shard = shard->next) {
+        for (auto entry = shard->entries.load(std::memory_order_acquire); entry != nullptr; entry = entry->next) {
+            auto [metrics, added] = totals.try_emplace({entry->op_type, entry->program_hash});
+            if (added) {
+                metrics->second.op_type = entry->op_type;
+                metrics->second.program_hash = entry->program_hash;
+            }
+            metrics->second.num_runs += entry->num_runs.load(std::memory_order_relaxed);
+            metrics->second.num_cache_hits += entry->num_cache_hits.load(std::memory_order_relaxed);
+            entry->dispatch_time.accumulate_into(metrics->second.dispatch_time);
+            entry->compile_time.accumulate_into(metrics->second.compile_time);
+        }
+    }
+    return totals;
+}
+
+void subtract(LatencyHistogram& histogram, const LatencyHistogram& baseline) {
+    for (uint32_t bucket = 0; bucket < LATENCY_NUM_BUCKETS; bucket++) {
+        histogram.bucket_counts[bucket] -= std::min(histogram.bucket_counts[bucket], baseline.bucket_counts[bucket]);
+    }
+    histogram.count -= std::min(histogram.count, baseline.count);
+    histogram.total_ns -= std::min(histogram.total_ns, baseline.total_ns);
+}
+
+}  // namespace
+
+uint64_t LatencyHistogram::quantile_ns(double quantile) const {
+    if (this->count == 0) {
+        return 0;
+    }
+    auto rank = uint64_t(std::clamp(quantile, 0.0, 1.0) * (this->count - 1));
+    uint64_t num_below = 0;
+    for (uint32_t bucket = 0; bucket < LATENCY_NUM_BUCKETS; bucket++) {
+        num_below += this->bucket_counts[bucket];
+        if (num_below > rank) {
+            return latency_bucket_lower_bound(bucket);
+        }
+    }
+    return latency_bucket_lower_bound(LATENCY_NUM_BUCKETS - 1);
+}
+
+bool is_enabled() { return get_registry().enabled.load(std::memory_order_relaxed); }
+
+void set_enabled(bool enabled) { get_registry().enabled.store(enabled, std::memory_order_relaxed); }
+
+void record(
+    const std::string& op_type,
+    operation::Hash program_hash,
+    bool cache_hit,
+    std::chrono::nanoseconds dispatch_time,
+    std::chrono::nanoseconds compile_time) {
+    thread_local ThreadShard thread_shard;
+    auto entry = thread_shard.shard->find_or_add(op_type, program_hash);
+    add_relaxed(entry->num_runs, 1);
+    entry->dispatch_time.add(dispatch_time.count());
+    if (cache_hit) {
+        add_relaxed(entry->num_cache_hits, 1);
+    } else {
+        entry->compile_time.add(compile_time.count());
+    }
+}
+
+std::vector<OpMetrics> snapshot() {
+    auto& registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.baseline_mutex);
+    std::vector<OpMetrics> snapshot;
+    for (auto& [key, metrics] : totals()) {
+        auto baseline = registry.baseline.find(key);
+        if (baseline != registry.baseline.end()) {
+            metrics.num_runs -= std::min(metrics.num_runs, baseline->second.num_runs);
+            metrics.num_cache_hits -= std::min(metrics.num_cache_hits, baseline->second.num_cache_hits);
+            subtract(metrics.dispatch_time, baseline->second.dispatch_time);
+            subtract(metrics.compile_time, baseline->second.compile_time);
+        }
+        if (metrics.num_runs > 0) {
+            snapshot.push_back(std::move(metrics));
+        }
+    }
+    return snapshot;
+}
+
+void reset() {
+    auto& registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.baseline_mutex);
+    registry.baseline = totals();
+}
+
+}  // namespace tt::tt_metal::op_metrics
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "tt_dnn/op_library/operation.hpp"
+
+namespace tt::tt_metal::op_metrics {
+
+// Metrics of every device operation run, kept per operation type and program hash. Recording is cheap enough to stay on
+// in production: each thread updates its own shard with relaxed atomics and takes no lock, only snapshots and resets
+// walk all shards. Set TT_METAL_OP_METRICS=0 to turn recording off.
+
+// Latency histograms have log-linear buckets: every power of two range of nanoseconds is split into
+// LATENCY_SUB_BUCKETS equal buckets, so the bounds of a bucket are within 1 / LATENCY_SUB_BUCKETS of each other.
+constexpr uint32_t LATENCY_SUB_BUCKET_BITS = 3;
+constexpr uint32_t LATENCY_SUB_BUCKETS = 1 << LATENCY_SUB_BUCKET_BITS;
+// Latencies of 2^LATENCY_MAX_EXPONENT ns, about 18 minutes, and more share the last bucket
+constexpr uint32_t LATENCY_MAX_EXPONENT = 40;
+constexpr uint32_t LATENCY_NUM_BUCKETS = (LATENCY_MAX_EXPONENT - LATENCY_SUB_BUCKET_BITS + 1) * LATENCY_SUB_BUCKETS + 1;
+
+constexpr uint32_t latency_bucket(uint64_t ns) {
+    if (ns < LATENCY_SUB_BUCKETS) {
+        return ns;
+    }
+    uint32_t exponent = 63 - __builtin_clzll(ns);
+    if (exponent >= LATENCY_MAX_EXPONENT) {
+        return LATENCY_NUM_BUCKETS - 1;
+    }
+    uint32_t sub_bucket = (ns >> (exponent - LATENCY_SUB_BUCKET_BITS)) & (LATENCY_SUB_BUCKETS - 1);
+    return (exponent - LATENCY_SUB_BUCKET_BITS + 1) * LATENCY_SUB_BUCKETS + sub_bucket;
+}
+
+// Smallest latency that falls in the bucket
+constexpr uint64_t latency_bucket_lower_bound(uint32_t bucket) {
+    if (bucket < LATENCY_SUB_BUCKETS) {
+        return bucket;
+    }
+    uint32_t exponent = bucket / LATENCY_SUB_BUCKETS + LATENCY_SUB_BUCKET_BITS - 1;
+    uint64_t sub_bucket = bucket % LATENCY_SUB_BUCKETS;
+    return (LATENCY_SUB_BUCKETS + sub_bucket) << (exponent - LATENCY_SUB_BUCKET_BITS);
+}
+
+static_assert(latency_bucket(LATENCY_SUB_BUCKETS) == LATENCY_SUB_BUCKETS);
+static_assert(latency_bucket(latency_bucket_lower_bound(LATENCY_NUM_BUCKETS - 1)) == LATENCY_NUM_BUCKETS - 1);
+static_assert(latency_bucket(latency_bucket_lower_bound(LATENCY_NUM_BUCKETS - 1) - 1) == LATENCY_NUM_BUCKETS - 2);
+
+struct LatencyHistogram {
+    // Number of latencies in each bucket, LATENCY_NUM_BUCKETS of them
+    std::vector<uint64_t> bucket_counts = std::vector<uint64_t>(LATENCY_NUM_BUCKETS, 0);
+    uint64_t count = 0;
+    uint64_t total_ns = 0;
+
+    double mean_ns() const { return this->count == 0 ? 0.0 : double(this->total_ns) / this->count; }
+    // Lower bound of the bucket holding the given quantile, 0 <= quantile <= 1. 0 if the histogram is empty.
+    uint64_t quantile_ns(double quantile) const;
+};
+
+struct OpMetrics {
+    std::string op_type;
+    operation::Hash program_hash;
+    uint64_t num_runs = 0;
+    // Runs that found their program in the program cache, the others created and compiled it
+    uint64_t num_cache_hits = 0;
+    // Host time of the whole run, from validation to the program being enqueued or launched
+    LatencyHistogram dispatch_time;
+    // Time spent creating and compiling the program, recorded on runs that missed the program cache
+    LatencyHistogram compile_time;
+
+    double cache_hit_rate() const { return this->num_runs == 0 ? 0.0 : double(this->num_cache_hits) / this->num_runs; }
+};
+
+bool is_enabled();
+void set_enabled(bool enabled);
+
+// Called by run_device_operation
+void record(
+    const std::string& op_type,
+    operation::Hash program_hash,
+    bool cache_hit,
+    std::chrono::nanoseconds dispatch_time,
+    std::chrono::nanoseconds compile_time);
+
+// Metrics recorded since the start or the last reset, ordered by operation type and program hash. Runs recorded while
+// the snapshot is taken may be counted in some fields and not yet in others.
+std::vector<OpMetrics> snapshot();
+
+void reset();
+
+}  // namespace tt::tt_metal::op_metrics
@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <list>
+#include <map>
+
 #include <tt_eager/tensor/tensor.hpp>
 #include "tt_dnn/op_library/auto_format.hpp"
 #include "tt_dnn/op_library/operation.hpp"
@@ -14,8 +18,61 @@ namespace tt::tt_metal {
 
 namespace program_cache {
 
+// Counters kept per operation type
+struct ProgramCacheStats {
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    std::size_t evictions = 0;
+    // Time spent creating and compiling programs on a miss
+    std::chrono::nanoseconds compile_time{0};
+};
+
+struct ProgramCacheEntryInfo {
+    operation::Hash hash;
+    std::string op_type;
+    std::size_t binary_size_bytes;
+    std::size_t hits;
+    bool pinned;
+};
+
 namespace detail {
 
+// Capacity limits can be set with TT_METAL_PROGRAM_CACHE_MAX_ENTRIES and TT_METAL_PROGRAM_CACHE_MAX_BINARY_SIZE.
+// 0 means unbounded.
+static const std::size_t PROGRAM_CACHE_MAX_ENTRIES = std::getenv("TT_METAL_PROGRAM_CACHE_MAX_ENTRIES") ? std::stoul(std::getenv("TT_METAL_PROGRAM_CACHE_MAX_ENTRIES")) : 0;
+static const std::size_t PROGRAM_CACHE_MAX_BINARY_SIZE = std::getenv("TT_METAL_PROGRAM_CACHE_MAX_BINARY_SIZE") ? std::stoul(std::getenv("TT_METAL_PROGRAM_CACHE_MAX_BINARY_SIZE")) : 0;
+
+// Device of the first input on device, or the default device if there is none
+inline Device* get_device(const std::vector<Tensor>& input_tensors, const std::vector<std::optional<const Tensor>>& optional_input_tensors = {}) {
+    for (auto& input_tensor : input_tensors) {
+        if (input_tensor.storage_type() == StorageType::DEVICE) {
+            return input_tensor.device();
+        }
+    }
+    for (auto& optional_input_tensor : optional_input_tensors) {
+        if (optional_input_tensor.has_value() and optional_input_tensor.value().storage_type() == StorageType::DEVICE) {
+            return optional_input_tensor.value().device();
+        }
+    }
+    auto device = AutoFormat::GetDefaultDevice();
+    TT_ASSERT(device != nullptr, "Requires setting default device if no inputs to operation are on device");
+    return device;
+}
+
+// Size of all kernel binaries of a program compiled for `device`
+inline std::size_t get_binary_size_bytes(const Program& program, const Device* device) {
+    std::size_t binary_size_bytes = 0;
+    for (KernelHandle kernel_id = 0; kernel_id < program.num_kernels(); kernel_id++) {
+        for (const auto& binary : program.get_kernel(kernel_id)->binaries(device->id())) {
+            binary_size_bytes += binary.size() * sizeof(ll_api::memory::word_t);
+        }
+    }
+    return binary_size_bytes;
+}
+
+// Programs are evicted in least recently used order once the cache holds more than max_entries programs or more than
+// max_binary_size_bytes of kernel binaries. Pinned programs are never evicted.
+// Programs are compiled as soon as they are created, so that their binary size is known when they are inserted.
 struct ProgramCache {
     inline std::tuple<operation::ProgramWithCallbacks&, bool> get_or_create(
         const operation::DeviceOperation& op,
@@ -23,17 +80,48 @@ struct ProgramCache {
         const std::vector<std::optional<const Tensor>>& optional_input_tensors,
         std::vector<Tensor>& output_tensors) {
         auto program_hash = op.compute_program_hash(input_tensors, optional_input_tensors);
-        auto cache_hit = this->cache_.count(program_hash) > 0;
-        if (cache_hit) {
+        return this->get_or_create(program_hash, op, input_tensors, optional_input_tensors, output_tensors);
+    }
+
+    // For callers that already computed the program hash of the operation
+    inline std::tuple<operation::ProgramWithCallbacks&, bool> get_or_create(
+        operation::Hash program_hash,
+        const operation::DeviceOperation& op,
+        const std::vector<Tensor>& input_tensors,
+        const std::vector<std::optional<const Tensor>>& optional_input_tensors,
+        std::vector<Tensor>& output_tensors) {
+        auto op_type = op.get_type_name();
+        auto& stats = this->stats_[op_type];
+        auto cache_entry = this->cache_.find(program_hash);
+        if (cache_entry != this->cache_.end()) {
             tt::log_debug(tt::LogOp, "Program Cache: HIT - Getting program from the cache with hash \"{}\"", program_hash);
-            auto& program = this->cache_.at(program_hash);
-            return {program, cache_hit};
-        } else {
-            tt::log_debug(tt::LogOp, "Program Cache: MISS - Compiling new program with hash \"{}\"", program_hash);
-            this->cache_[program_hash] = op.create_program(input_tensors, optional_input_tensors, output_tensors);
-            auto& program = this->cache_[program_hash].program;
-            return {this->cache_[program_hash], cache_hit};
+            auto& entry = cache_entry->second;
+            stats.hits++;
+            entry.hits++;
+            this->lru_.splice(this->lru_.begin(), this->lru_, entry.lru_position);
+            return {entry.program_with_callbacks, true};
+        }
+
+        tt::log_debug(tt::LogOp, "Program Cache: MISS - Compiling new program with hash \"{}\"", program_hash);
+        auto start = std::chrono::steady_clock::now();
+        auto program_with_callbacks = op.create_program(input_tensors, optional_input_tensors, output_tensors);
+        auto device = get_device(input_tensors, optional_input_tensors);
+        std::size_t binary_size_bytes = 0;
+        if (device != nullptr) {
+            ::tt::tt_metal::detail::CompileProgram(device, program_with_callbacks.program);
+            binary_size_bytes = get_binary_size_bytes(program_with_callbacks.program, device);
         }
+        stats.compile_time += std::chrono::steady_clock::now() - start;
+        stats.misses++;
+
+        this->lru_.push_front(program_hash);
+        auto& entry = this->cache_.emplace(
+            program_hash,
+            Entry{std::move(program_with_callbacks), op_type, device, binary_size_bytes, 0, false, this->lru_.begin()}
+        ).first->second;
+        this->binary_size_bytes_ += binary_size_bytes;
+        this->evict(program_hash);
+        return {entry.program_with_callbacks, false};
     }
 
     void enable() {
@@ -50,13 +138,102 @@ struct ProgramCache {
 
     void clear() {
         this->cache_.clear();
+        this->lru_.clear();
+        this->binary_size_bytes_ = 0;
     }
 
+    void set_capacity(std::size_t max_entries, std::size_t max_binary_size_bytes) {
+        this->max_entries_ = max_entries;
+        this->max_binary_size_bytes_ = max_binary_size_bytes;
+        this->evict(std::nullopt);
+    }
+
+    std::size_t max_entries() const { return this->max_entries_; }
+
+    std::size_t max_binary_size_bytes() const { return this->max_binary_size_bytes_; }
+
+    // Returns false if no program with this hash is cached
+    bool set_pinned(operation::Hash program_hash, bool pinned) {
+        auto cache_entry = this->cache_.find(program_hash);
+        if (cache_entry == this->cache_.end()) {
+            return false;
+        }
+        cache_entry->second.pinned = pinned;
+        if (not pinned) {
+            this->evict(std::nullopt);
+        }
+        return true;
+    }
+
+    // Entries from most to least recently used
+    std::vector<ProgramCacheEntryInfo> entries() const {
+        std::vector<ProgramCacheEntryInfo> entries;
+        entries.reserve(this->cache_.size());
+        for (auto program_hash : this->lru_) {
+            const auto& entry = this->cache_.at(program_hash);
+            entries.push_back({program_hash, entry.op_type, entry.binary_size_bytes, entry.hits, entry.pinned});
+        }
+        return entries;
+    }
+
+    const std::map<std::string, ProgramCacheStats>& stats() const { return this->stats_; }
+
+    void reset_stats() { this->stats_.clear(); }
+
     inline std::size_t num_entries() const { return this->cache_.size(); }
 
+    inline std::size_t binary_size_bytes() const { return this->binary_size_bytes_; }
+
    private:
+    struct Entry {
+        operation::ProgramWithCallbacks program_with_callbacks;
+        std::string op_type;
+        Device* device;
+        std::size_t binary_size_bytes;
+        std::size_t hits;
+        bool pinned;
+        std::list<operation::Hash>::iterator lru_position;
+    };
+
+    bool over_capacity() const {
+        return (this->max_entries_ > 0 and this->cache_.size() > this->max_entries_) or
+               (this->max_binary_size_bytes_ > 0 and this->binary_size_bytes_ > this->max_binary_size_bytes_);
+    }
+
+    // Evicts least recently used programs until the cache fits its capacity. `keep` is the program that was just
+    // handed out, which must outlive the current operation.
+    void evict(std::optional<operation::Hash> keep) {
+        auto lru_position = this->lru_.end();
+        while (this->over_capacity() and lru_position != this->lru_.begin()) {
+            --lru_position;
+            auto program_hash = *lru_position;
+            auto cache_entry = this->cache_.find(program_hash);
+            if (cache_entry->second.pinned or program_hash == keep) {
+                continue;
+            }
+            auto& entry = cache_entry->second;
+            tt::log_debug(tt::LogOp, "Program Cache: EVICT - Removing program with hash \"{}\"", program_hash);
+            this->stats_[entry.op_type].evictions++;
+            this->binary_size_bytes_ -= entry.binary_size_bytes;
+            if (entry.device != nullptr and entry.device->is_initialized()) {
+                ::tt::tt_metal::detail::EvictCommandQueueProgram(entry.device, entry.program_with_callbacks.program);
+            }
+            lru_position = this->lru_.erase(lru_position);
+            this->cache_.erase(cache_entry);
+        }
+        if (this->over_capacity()) {
+            tt::log_warning(tt::LogOp, "Program Cache: pinned programs exceed the capacity of the cache");
+        }
+    }
+
     bool is_enabled_ = false;
-    std::unordered_map<operation::Hash, operation::ProgramWithCallbacks> cache_{};
+    std::size_t max_entries_ = PROGRAM_CACHE_MAX_ENTRIES;
+    std::size_t max_binary_size_bytes_ = PROGRAM_CACHE_MAX_BINARY_SIZE;
+    std::size_t binary_size_bytes_ = 0;
+    std::unordered_map<operation::Hash, Entry> cache_{};
+    // Most recently used program first
+    std::list<operation::Hash> lru_{};
+    std::map<std::string, ProgramCacheStats> stats_{};
 };
 
 inline ProgramCache PROGRAM_CACHE{};
@@ -83,6 +260,30 @@ inline void disable_and_clear() {
 }
 
 inline std::size_t num_entries() { return detail::PROGRAM_CACHE.num_entries(); }
+
+// Total size of the kernel binaries of all cached programs
+inline std::size_t binary_size_bytes() { return detail::PROGRAM_CACHE.binary_size_bytes(); }
+
+// Limits the cache to max_entries programs and max_binary_size_bytes of kernel binaries, 0 means unbounded.
+// Least recently used programs are evicted right away if the cache no longer fits.
+inline void set_capacity(std::size_t max_entries, std::size_t max_binary_size_bytes) {
+    detail::PROGRAM_CACHE.set_capacity(max_entries, max_binary_size_bytes);
+}
+
+inline std::size_t max_entries() { return detail::PROGRAM_CACHE.max_entries(); }
+
+inline std::size_t max_binary_size_bytes() { return detail::PROGRAM_CACHE.max_binary_size_bytes(); }
+
+// Pinned programs are never evicted. Returns false if no program with this hash is cached.
+inline bool pin(operation::Hash program_hash) { return detail::PROGRAM_CACHE.set_pinned(program_hash, true); }
+
+inline bool unpin(operation::Hash program_hash) { return detail::PROGRAM_CACHE.set_pinned(program_hash, false); }
+
+inline std::vector<ProgramCacheEntryInfo> entries() { return detail::PROGRAM_CACHE.entries(); }
+
+inline const std::map<std::string, ProgramCacheStats>& stats() { return detail::PROGRAM_CACHE.stats(); }
+
+inline void reset_stats() { detail::PROGRAM_CACHE.reset_stats(); }
 }
 
 }
@@ -9,9 +9,11 @@
 
 #include "third_party/magic_enum/magic_enum.hpp"
 #include "tt_dnn/op_library/auto_format.hpp"
+#include "tt_dnn/op_library/op_metrics.hpp"
 #include "tt_dnn/op_library/operation.hpp"
 #include "tt_dnn/op_library/program_cache.hpp"
 #include "tt_metal/detail/tt_metal.hpp"
+#include "tt_metal/impl/allocator/allocator_trace.hpp"
 #include "tt_metal/third_party/tracy/public/tracy/Tracy.hpp"
 #include "tt_metal/tools/profiler/op_profiler.hpp"
 #include "tt_numpy/functions.hpp"
@@ -20,33 +22,21 @@
 namespace tt::tt_metal::operation {
 
 bool is_logging_enabled() {
-    bool enabled = false;
-    if (std::getenv("TT_METAL_LOGGER_TYPES") != nullptr and std::getenv("TT_METAL_LOGGER_LEVEL") != nullptr) {
-        enabled |= std::string{std::getenv("TT_METAL_LOGGER_TYPES")} == "Op" and
-                   std::string{std::getenv("TT_METAL_LOGGER_LEVEL")} == "DEBUG";
-    }
-    enabled |= std::getenv("OPERATION_HISTORY_CSV") != nullptr;
+    // Called for every operation, the environment is only read once
+    static const bool enabled = [] {
+        bool enabled = false;
+        if (std::getenv("TT_METAL_LOGGER_TYPES") != nullptr and std::getenv("TT_METAL_LOGGER_LEVEL") != nullptr) {
+            enabled |= std::string{std::getenv("TT_METAL_LOGGER_TYPES")} == "Op" and
+                       std::string{std::getenv("TT_METAL_LOGGER_LEVEL")} == "DEBUG";
+        }
+        enabled |= std::getenv("OPERATION_HISTORY_CSV") != nullptr;
+        return enabled;
+    }();
     return enabled;
 }
 
 namespace detail {
 
-static Device* get_device(const std::vector<Tensor>& input_tensors, const std::vector<std::optional<const Tensor>>& optional_input_tensors = {}) {
-    for (auto& input_tensor : input_tensors) {
-        if (input_tensor.storage_type() == StorageType::DEVICE) {
-            return input_tensor.device();
-        }
-    }
-    for (auto& optional_input_tensor : optional_input_tensors) {
-        if (optional_input_tensor.has_value() and optional_input_tensor.value().storage_type() == StorageType::DEVICE) {
-            return optional_input_tensor.value().device();
-        }
-    }
-    auto device = AutoFormat::GetDefaultDevice();
-    TT_ASSERT(device != nullptr, "Requires setting default device if no inputs to operation are on device");
-    return device;
-}
-
 void override_addresses(
     const OverrideAddressesCallback& override_addresses_callback,
     const Program &program,
@@ -133,6 +123,7 @@ std::vector<Tensor> run_host_operation(const HostOperation& operation, const std
     ZoneText(operation.get_type_name().c_str(), operation.get_type_name().size());
 
     auto profile_scope = op_profiler::OpProfileScope(operation.get_type_name(), op_profiler::OpType::tt_dnn_cpu);
+    auto allocator_trace_tag = allocator::ScopedTraceTag(operation.get_type_name());
     auto do_profile = op_profiler::get_profiler_flag();
     if (do_profile) {
         detail::setup_profiler(operation, input_tensors);
@@ -155,25 +146,32 @@ std::vector<Tensor> run_device_operation(
     ZoneScoped;
     ZoneText(operation.get_type_name().c_str(), operation.get_type_name().size());
 
+    const auto start = std::chrono::steady_clock::now();
     auto profile_scope = op_profiler::OpProfileScope(operation.get_type_name(), op_profiler::OpType::tt_dnn_device);
+    auto allocator_trace_tag = allocator::ScopedTraceTag(operation.get_type_name());
 
-    std::function<std::variant<Program, std::reference_wrapper<Program>>(
+    // The program hash is only computed for the program cache, metrics of uncached runs are recorded under hash 0
+    Hash program_hash = 0;
+    bool cache_hit = false;
+    std::function<std::variant<std::shared_ptr<Program>, std::reference_wrapper<Program>>(
         const DeviceOperation&,
         const std::vector<Tensor>&,
         const std::vector<std::optional<const Tensor>>&,
         std::vector<Tensor>&)>
         get_or_create_program;
     if (program_cache::is_enabled()) {
-        get_or_create_program = [](const DeviceOperation& operation,
-                                   const std::vector<Tensor>& input_tensors,
-                                   const std::vector<std::optional<const Tensor>>& optional_input_tensors,
-                                   std::vector<Tensor>& output_tensors) -> std::reference_wrapper<Program> {
-            auto&& [program_with_callbacks, cache_hit] =
-                program_cache::get_or_create(operation, input_tensors, optional_input_tensors, output_tensors);
+        get_or_create_program = [&program_hash, &cache_hit](
+                                    const DeviceOperation& operation,
+                                    const std::vector<Tensor>& input_tensors,
+                                    const std::vector<std::optional<const Tensor>>& optional_input_tensors,
+                                    std::vector<Tensor>& output_tensors) -> std::reference_wrapper<Program> {
+            auto&& [program_with_callbacks, program_cache_hit] = program_cache::get_or_create(
+                program_hash, operation, input_tensors, optional_input_tensors, output_tensors);
             TT_ASSERT(program_with_callbacks.supports_program_cache());
+            cache_hit = program_cache_hit;
 
             auto& program = program_with_callbacks.program;
-            if (cache_hit) {
+            if (program_cache_hit) {
                 ZoneScopedN("Cache_hit_set_runtime_args");
                 if (program_with_callbacks.override_addresses_callback.has_value()) {
                     auto override_addresses_callback = program_with_callbacks.override_addresses_callback.value();
@@ -198,21 +196,38 @@ std::vector<Tensor> run_device_operation(
         get_or_create_program = [](const DeviceOperation& operation,
                                    const std::vector<Tensor>& input_tensors,
                                    const std::vector<std::optional<const Tensor>>& optional_input_tensors,
-                                   std::vector<Tensor>& output_tensors) -> Program {
+                                   std::vector<Tensor>& output_tensors) -> std::shared_ptr<Program> {
             auto program_with_callbacks =
                 operation.create_program(input_tensors, optional_input_tensors, output_tensors);
-            return std::move(program_with_callbacks.program);
+            // Compiled here rather than when it is enqueued so that compile time is measured with program creation
+            ::tt::tt_metal::detail::CompileProgram(
+                program_cache::detail::get_device(input_tensors, optional_input_tensors), program_with_callbacks.program);
+            return std::make_shared<Program>(std::move(program_with_callbacks.program));
         };
     }
 
     operation.validate(input_tensors, optional_input_tensors);
     auto output_tensors = operation.create_output_tensors(input_tensors);
+    if (program_cache::is_enabled()) {
+        program_hash = operation.compute_program_hash(input_tensors, optional_input_tensors);
+    }
+    const auto program_start = std::chrono::steady_clock::now();
     auto program = get_or_create_program(operation, input_tensors, optional_input_tensors, output_tensors);
+    const auto compile_time = std::chrono::steady_clock::now() - program_start;
 
     // Enqueue or Launch Program
     std::visit(
-        [&operation, &input_tensors, &optional_input_tensors](auto& program) {
-            auto device = detail::get_device(input_tensors, optional_input_tensors);
+        [&operation, &input_tensors, &optional_input_tensors](auto& program_handle) {
+            auto device = program_cache::detail::get_device(input_tensors, optional_input_tensors);
+            // An uncached program is handed over to the command queue, which may still read it after this returns
+            using ProgramHandle = std::decay_t<decltype(program_handle)>;
+            Program& program = [&program_handle]() -> Program& {
+                if constexpr (std::is_same_v<ProgramHandle, std::shared_ptr<Program>>) {
+                    return *program_handle;
+                } else {
+                    return program_handle.get();
+                }
+            }();
 
             auto do_profile = op_profiler::get_profiler_flag();
             if (do_profile) {
@@ -221,10 +236,10 @@ std::vector<Tensor> run_device_operation(
 
             if (USE_FAST_DISPATCH) {
 #ifndef TTNN_ENABLE_LOGGING
-                EnqueueProgram(tt::tt_metal::detail::GetCommandQueue(device), program, false);
+                EnqueueProgram(tt::tt_metal::detail::GetCommandQueue(device), program_handle, false);
 #else
                 const auto start{std::chrono::steady_clock::now()};
-                EnqueueProgram(tt::tt_metal::detail::GetCommandQueue(device), program, false);
+                EnqueueProgram(tt::tt_metal::detail::GetCommandQueue(device), program_handle, false);
                 Finish(tt::tt_metal::detail::GetCommandQueue(device));
                 const auto end{std::chrono::steady_clock::now()};
                 const auto elapsed_seconds = static_cast<std::size_t>((end - start).count());
@@ -245,6 +260,10 @@ std::vector<Tensor> run_device_operation(
 
     op_profiler::append_all_tensor_io_data(input_tensors, optional_input_tensors, output_tensors);
 
+    if (op_metrics::is_enabled()) {
+        op_metrics::record(
+            operation.get_type_name(), program_hash, cache_hit, std::chrono::steady_clock::now() - start, compile_time);
+    }
     return output_tensors;
 }
 }  // namespace detail
@@ -265,7 +284,7 @@ std::vector<Tensor> run_without_autoformat(
     const std::vector<Tensor>& input_tensors,
     const std::vector<std::optional<const Tensor>>& optional_input_tensors
 ) {
-    Device* device = detail::get_device(input_tensors, optional_input_tensors);
+    Device* device = program_cache::detail::get_device(input_tensors, optional_input_tensors);
 
     std::vector<Tensor> input_tensors_on_dev;
     input_tensors_on_dev.reserve(input_tensors.size());
@@ -296,7 +315,7 @@ std::vector<Tensor> run_with_autoformat(
     const float pad_value,
     const bool pad_c
 ) {
-    Device* device = detail::get_device(input_tensors, optional_input_tensors);
+    Device* device = program_cache::detail::get_device(input_tensors, optional_input_tensors);
 
     auto output_shapes = operation.compute_output_shapes(input_tensors);
 
@@ -347,7 +366,7 @@ std::vector<Tensor> run_with_autoformat(
     const std::vector<std::optional<const Tensor>>& optional_input_tensors,
     const std::vector<std::optional<FormatParams>>& optional_input_formatting
 ) {
-    Device* device = detail::get_device(input_tensors, optional_input_tensors);
+    Device* device = program_cache::detail::get_device(input_tensors, optional_input_tensors);
 
     auto output_shapes = operation.compute_output_shapes(input_tensors);
 
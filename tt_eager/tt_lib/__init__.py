@@ -2,4 +2,4 @@
 
 # SPDX-License-Identifier: Apache-2.0
 
-from ._C import tensor, device, dtx, profiler, program_cache, operations, ttnn
+from ._C import tensor, device, dtx, profiler, program_cache, op_metrics, operations, ttnn
@@ -9,6 +9,7 @@
 #include "operations/module.hpp"
 #include "tt_dnn/op_library/auto_format.hpp"
 #include "tt_dnn/op_library/math.hpp"
+#include "tt_dnn/op_library/op_metrics.hpp"
 #include "tt_dnn/op_library/program_cache.hpp"
 #include "tt_lib_bindings_tensor.hpp"
 #include "tt_metal/detail/persistent_kernel_cache.hpp"
@@ -122,6 +123,26 @@ void DeviceModule(py::module &m_device) {
         +------------------+----------------------------------+-----------------------+-------------+----------+
     )doc");
 
+    py::class_<allocator::CompactionPlan>(m_device, "CompactionPlan")
+        .def_property_readonly("num_relocations", [](const allocator::CompactionPlan& plan) { return plan.relocations.size(); })
+        .def_readonly("bytes_moved", &allocator::CompactionPlan::bytes_moved)
+        .def_readonly("largest_free_block_bytes_before", &allocator::CompactionPlan::largest_free_block_bytes_before)
+        .def_readonly("largest_free_block_bytes_after", &allocator::CompactionPlan::largest_free_block_bytes_after);
+    pyDevice.def("plan_l1_compaction", &Device::plan_l1_compaction, R"doc(
+        Plans sliding L1 buffers towards the top of L1 so that free space between them coalesces into one block, without moving anything.
+    )doc");
+    pyDevice.def("compact_l1", &Device::compact_l1, R"doc(
+        Waits for the device to go idle and moves L1 buffers so that free space between them coalesces into one block.
+        Tensors keep their buffers and see the new addresses. Returns the plan that was run.
+    )doc");
+    pyDevice.def("push_l1_arena", &Device::push_l1_arena, py::arg("size_per_bank"), py::arg("bottom_up") = false, R"doc(
+        Reserves size_per_bank bytes in every L1 bank as an arena. Until pop_l1_arena is called, L1 tensors created on this device
+        are bump allocated from the arena, and fall back to the general allocator once it is full.
+    )doc");
+    pyDevice.def("pop_l1_arena", &Device::pop_l1_arena, R"doc(
+        Releases the most recently pushed L1 arena. Throws if a tensor allocated from it has not been deallocated.
+    )doc");
+
     m_device.def("Synchronize", &detail::Synchronize, R"doc(
         Wait for all kernels on TT device to complete.
     )doc");
@@ -278,6 +299,58 @@ void ProgramCacheModule(py::module &m_program_cache) {
    m_program_cache.def("enable", &tt::tt_metal::program_cache::enable);
    m_program_cache.def("disable_and_clear", &tt::tt_metal::program_cache::disable_and_clear);
    m_program_cache.def("num_entries", &tt::tt_metal::program_cache::num_entries);
+   m_program_cache.def("binary_size_bytes", &tt::tt_metal::program_cache::binary_size_bytes, "Total size of the kernel binaries of all cached programs");
+   m_program_cache.def("set_capacity", &tt::tt_metal::program_cache::set_capacity, py::arg("max_entries"), py::arg("max_binary_size_bytes"), R"doc(
+        Limit the cache to ``max_entries`` programs and ``max_binary_size_bytes`` of kernel binaries. 0 means unbounded.
+        Least recently used programs that are not pinned are evicted once either limit is exceeded.
+   )doc");
+   m_program_cache.def("max_entries", &tt::tt_metal::program_cache::max_entries);
+   m_program_cache.def("max_binary_size_bytes", &tt::tt_metal::program_cache::max_binary_size_bytes);
+   m_program_cache.def("pin", &tt::tt_metal::program_cache::pin, py::arg("program_hash"), "Never evict the program with this hash. Returns False if it isn't cached.");
+   m_program_cache.def("unpin", &tt::tt_metal::program_cache::unpin, py::arg("program_hash"), "Allow the program with this hash to be evicted again. Returns False if it isn't cached.");
+
+   py::class_<program_cache::ProgramCacheEntryInfo>(m_program_cache, "ProgramCacheEntry")
+       .def_readonly("hash", &program_cache::ProgramCacheEntryInfo::hash)
+       .def_readonly("op_type", &program_cache::ProgramCacheEntryInfo::op_type)
+       .def_readonly("binary_size_bytes", &program_cache::ProgramCacheEntryInfo::binary_size_bytes)
+       .def_readonly("hits", &program_cache::ProgramCacheEntryInfo::hits)
+       .def_readonly("pinned", &program_cache::ProgramCacheEntryInfo::pinned);
+   m_program_cache.def("entries", &tt::tt_metal::program_cache::entries, "Cached programs from most to least recently used");
+
+   py::class_<program_cache::ProgramCacheStats>(m_program_cache, "ProgramCacheStats")
+       .def_readonly("hits", &program_cache::ProgramCacheStats::hits)
+       .def_readonly("misses", &program_cache::ProgramCacheStats::misses)
+       .def_readonly("evictions", &program_cache::ProgramCacheStats::evictions)
+       .def_property_readonly("compile_time_ns", [](const program_cache::ProgramCacheStats& stats) { return stats.compile_time.count(); });
+   m_program_cache.def("stats", &tt::tt_metal::program_cache::stats, py::return_value_policy::copy, "Hit, miss, eviction and compile time counters per operation type");
+   m_program_cache.def("reset_stats", &tt::tt_metal::program_cache::reset_stats);
+}
+
+void OpMetricsModule(py::module &m_op_metrics) {
+   m_op_metrics.def("is_enabled", &op_metrics::is_enabled);
+   m_op_metrics.def("set_enabled", &op_metrics::set_enabled, py::arg("enabled"), "Turn recording of operation metrics on or off. On unless TT_METAL_OP_METRICS=0.");
+
+   py::class_<op_metrics::LatencyHistogram>(m_op_metrics, "LatencyHistogram")
+       .def_readonly("bucket_counts", &op_metrics::LatencyHistogram::bucket_counts)
+       .def_readonly("count", &op_metrics::LatencyHistogram::count)
+       .def_readonly("total_ns", &op_metrics::LatencyHistogram::total_ns)
+       .def("mean_ns", &op_metrics::LatencyHistogram::mean_ns)
+       .def("quantile_ns", &op_metrics::LatencyHistogram::quantile_ns, py::arg("quantile"), "Lower bound of the bucket holding the quantile, between 0 and 1");
+   m_op_metrics.def("bucket_lower_bound_ns", &op_metrics::latency_bucket_lower_bound, py::arg("bucket"), "Smallest latency counted in a bucket of a LatencyHistogram");
+
+   py::class_<op_metrics::OpMetrics>(m_op_metrics, "OpMetrics")
+       .def_readonly("op_type", &op_metrics::OpMetrics::op_type)
+       .def_readonly("program_hash", &op_metrics::OpMetrics::program_hash)
+       .def_readonly("num_runs", &op_metrics::OpMetrics::num_runs)
+       .def_readonly("num_cache_hits", &op_metrics::OpMetrics::num_cache_hits)
+       .def_readonly("dispatch_time", &op_metrics::OpMetrics::dispatch_time)
+       .def_readonly("compile_time", &op_metrics::OpMetrics::compile_time)
+       .def("cache_hit_rate", &op_metrics::OpMetrics::cache_hit_rate);
+   m_op_metrics.def("snapshot", &op_metrics::snapshot, R"doc(
+        Metrics of the device operations run since the start or the last reset, one entry per operation type and
+        program hash. The program hash is 0 for runs made with the program cache disabled.
+   )doc");
+   m_op_metrics.def("reset", &op_metrics::reset);
 }
 
 } // end namespace tt_metal
@@ -305,6 +378,9 @@ PYBIND11_MODULE(_C, m) {
     py::module_ m_program_cache = m.def_submodule("program_cache", "Submodule for caching operations");
     tt::tt_metal::ProgramCacheModule(m_program_cache);
 
+    py::module_ m_op_metrics = m.def_submodule("op_metrics", "Submodule for per operation latency and cache metrics");
+    tt::tt_metal::OpMetricsModule(m_op_metrics);
+
     py::module_ m_operations = m.def_submodule("operations", "Submodule for operations");
     tt::operations::py_module(m_operations);
 
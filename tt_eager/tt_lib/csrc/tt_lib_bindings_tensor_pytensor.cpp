@@ -159,8 +159,7 @@ Tensor convert_torch_tensor_to_tt_tensor(
             auto data_ptr =
                 reinterpret_cast<float *>(py::cast<std::size_t>(contiguous_torch_tensor.attr("data_ptr")()));
             auto num_elements = py::cast<std::size_t>(contiguous_torch_tensor.attr("numel")());
-            auto data = std::vector<float>(data_ptr, data_ptr + num_elements);
-            auto uint32_vector = pack_fp32_vec_as_bfp8_tiles(data, /*row_major_input=*/false, /*is_exp_a=*/false);
+            auto uint32_vector = pack_fp32_vec_as_bfp8_tiles(data_ptr, num_elements, /*row_major_input=*/false, /*is_exp_a=*/false);
             auto buffer = owned_buffer::create<uint32_t>(std::move(uint32_vector));
             auto storage = OwnedStorage{std::move(buffer)};
             return Tensor(std::move(storage), shape, data_type, Layout::ROW_MAJOR);
@@ -639,6 +638,36 @@ Tensor convert_torch_tensor_to_tt_tensor(
 
                     tt_tensor = tt_tensor.to(tt_device)
             )doc")
+            .def(
+                "to",
+                [](const Tensor &self, Device *device, Layout layout, const MemoryConfig &mem_config) {
+                    return self.to(device, layout, mem_config);
+                },
+                py::arg().noconvert(),
+                py::arg("layout").noconvert(),
+                py::arg("mem_config").noconvert() = MemoryConfig{.memory_layout = TensorMemoryLayout::INTERLEAVED},
+                py::keep_alive<0, 2>(),
+                R"doc(
+                Move TT Tensor from host device to TT accelerator device and convert it to provided memory layout on the way.
+
+                With fast dispatch, ROW_MAJOR BFLOAT16 tensors are tilized in chunks while they are uploaded, so a tensor
+                that borrows torch.Tensor's storage is never copied in full on host. Other conversions are equivalent to
+                ``tt_tensor.to(layout).to(tt_device, mem_config)``.
+
+                +-----------+-------------------------------------------------+----------------------------+-----------------------+----------+
+                | Argument  | Description                                     | Data type                  | Valid range           | Required |
+                +===========+=================================================+============================+=======================+==========+
+                | arg0      | Device to which tensor will be moved            | tt_lib.device.Device       | TT accelerator device | Yes      |
+                +-----------+-------------------------------------------------+----------------------------+-----------------------+----------+
+                | arg1      | Target memory layout                            | tt_lib.tensor.Layout       | ROW_MAJOR, TILE       | Yes      |
+                +-----------+-------------------------------------------------+----------------------------+-----------------------+----------+
+                | arg2      | MemoryConfig of tensor of TT accelerator device | tt_lib.tensor.MemoryConfig | Interleaved           | No       |
+                +-----------+-------------------------------------------------+----------------------------+-----------------------+----------+
+
+                .. code-block:: python
+
+                    tt_tensor = tt_lib.tensor.Tensor(py_tensor).to(tt_device, tt_lib.tensor.Layout.TILE)
+            )doc")
             .def("to", [](const Tensor &self, Device *device, const MemoryConfig &mem_config, const ShardSpec & shard_spec) {
                 return self.to(device, mem_config, shard_spec);
             }, py::arg().noconvert(), py::arg("mem_config").noconvert() = MemoryConfig{.memory_layout=TensorMemoryLayout::HEIGHT_SHARDED},  py::arg("shard_spec").noconvert(),
@@ -146,74 +146,163 @@ inline uint32_t create_packed_bfp8_packed_as_u32(const std::vector<uint32_t> &u3
     return tmp_o;
 }
 
-inline std::vector<uint32_t> pack_fp32_vec_as_bfp8_tiles(const std::vector<float> &fp32_vec, bool row_major_input, bool is_exp_a) {
-    ZoneScoped;
+namespace bfp8_detail {
+
+// Vectorized convert_u32_to_bfp8 for 8 fp32 values sharing `shared_exp`. Returns one bfp8 value per 32-bit lane.
+template <bool truncate_bfp_mantissa>
+inline __m256i convert_u32_to_bfp8(__m256i input, __m256i shared_exp, bool is_exp_a) {
+    __m256i exp = _mm256_and_si256(_mm256_srli_epi32(input, 23), _mm256_set1_epi32(0xff));
+    __m256i mantissa = _mm256_and_si256(input, _mm256_set1_epi32(0x007fffff));
+    __m256i sign = _mm256_srli_epi32(input, 31);
+    if (is_exp_a) {
+        // rebias saturates the mantissa at the top of the range and clears it at the bottom
+        __m256i rebiased_exp = _mm256_sub_epi32(exp, _mm256_set1_epi32(127 - 15));
+        __m256i saturated = _mm256_cmpgt_epi32(rebiased_exp, _mm256_set1_epi32(31));
+        __m256i underflowed = _mm256_cmpgt_epi32(_mm256_setzero_si256(), rebiased_exp);
+        mantissa = _mm256_blendv_epi8(mantissa, _mm256_set1_epi32(0x007fffff), saturated);
+        mantissa = _mm256_andnot_si256(underflowed, mantissa);
+        exp = _mm256_min_epi32(_mm256_max_epi32(rebiased_exp, _mm256_setzero_si256()), _mm256_set1_epi32(31));
+    }
 
-    uint32_t single_bfp8_tile_size = tile_size(tt::DataFormat::Bfp8_b);
-    int num_float_in_tile = 1024;
-    TT_ASSERT(fp32_vec.size() % num_float_in_tile == 0);
-    uint32_t num_tiles = fp32_vec.size() / num_float_in_tile;
+    // add hidden 1 and align to the shared exponent; shifts of 32 or more produce 0, as in the scalar loop
+    mantissa = _mm256_or_si256(mantissa, _mm256_set1_epi32(1 << 23));
+    mantissa = _mm256_srlv_epi32(mantissa, _mm256_sub_epi32(shared_exp, exp));
 
-    std::vector<uint32_t> packed_result;
+    if constexpr (truncate_bfp_mantissa) {
+        mantissa = _mm256_srli_epi32(mantissa, 17);
+    } else {
+        mantissa = _mm256_srli_epi32(_mm256_add_epi32(mantissa, _mm256_set1_epi32(1 << 16)), 17);
+        mantissa = _mm256_min_epu32(mantissa, _mm256_set1_epi32(127));
+    }
 
-    std::vector<uint8_t> exponents;
-    std::vector<uint32_t> data;
+    // add sign bit only if result is not 0
+    __m256i is_zero_mantissa = _mm256_cmpeq_epi32(mantissa, _mm256_setzero_si256());
+    sign = _mm256_andnot_si256(is_zero_mantissa, sign);
+    __m256i result = _mm256_or_si256(_mm256_slli_epi32(sign, 7), mantissa);
 
-    int subtiles_in_tile_row = 2;
-    int subtiles_in_tile_col = 2;
-    int subtile_rows = 16;
-    int subtile_cols = 16;
-    int num_elements_in_dword = 4;
-    int fp32_element_index = 0;
-    for (int tile_index = 0; tile_index < num_tiles; ++tile_index) {
-        std::vector<uint32_t> packed_data;
-        for (int tr = 0; tr < subtiles_in_tile_row; ++tr) {
-            for (int tc = 0; tc < subtiles_in_tile_col; ++tc) {
-                for (int i = 0; i < subtile_rows; ++i) {
-                    std::vector<uint32_t> single_row;
-                    // populate a single row
-                    for (int j = 0; j < subtile_cols; ++j) {
-                        int data_index;
-                        if (row_major_input) {
-                            data_index = (tr*16 + i)*32 + (tc*16 + j) + (num_float_in_tile * tile_index);
-                        } else {
-                            data_index = fp32_element_index++;
-                        }
-                        float float_num = fp32_vec.at(data_index);
-                        uint32_t uint32_num = *reinterpret_cast<uint32_t*>(&float_num);
-                        single_row.push_back(uint32_num);
-                    }
+    // +/- 0.0 always packs to 0
+    __m256i is_zero = _mm256_cmpeq_epi32(_mm256_and_si256(input, _mm256_set1_epi32(0x7fffffff)), _mm256_setzero_si256());
+    return _mm256_andnot_si256(is_zero, result);
+}
 
-                    uint8_t exp = get_max_exp(single_row, is_exp_a);
-                    exponents.push_back(exp);
+// Vectorized exponent extraction of get_max_exp, before the max is taken
+inline __m256i get_exp(__m256i input, bool is_exp_a) {
+    __m256i exp = _mm256_and_si256(_mm256_srli_epi32(input, 23), _mm256_set1_epi32(0xff));
+    if (is_exp_a) {
+        exp = _mm256_sub_epi32(exp, _mm256_set1_epi32(127 - 15));
+        exp = _mm256_min_epi32(_mm256_max_epi32(exp, _mm256_setzero_si256()), _mm256_set1_epi32(31));
+    }
+    return exp;
+}
 
-                    if (exponents.size() % num_elements_in_dword == 0) {
-                        packed_result.push_back(get_exp_dword(exponents));
-                        exponents.clear();
-                    }
+// Packs one 16 element face row: writes its shared exponent to `exp_out` and its 16 bfp8 values to `data_out`
+template <bool truncate_bfp_mantissa>
+inline void pack_face_row(const float* row, bool is_exp_a, uint8_t* exp_out, uint8_t* data_out) {
+    __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row));
+    __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + 8));
+
+    // horizontal max of the 16 exponents, broadcast to every lane
+    __m256i max_exp = _mm256_max_epu32(get_exp(lo, is_exp_a), get_exp(hi, is_exp_a));
+    max_exp = _mm256_max_epu32(max_exp, _mm256_permute2x128_si256(max_exp, max_exp, 0x01));
+    max_exp = _mm256_max_epu32(max_exp, _mm256_shuffle_epi32(max_exp, 0x4e));
+    max_exp = _mm256_max_epu32(max_exp, _mm256_shuffle_epi32(max_exp, 0xb1));
+    *exp_out = static_cast<uint8_t>(_mm256_cvtsi256_si32(max_exp));
+
+    __m256i lo_bfp8 = convert_u32_to_bfp8<truncate_bfp_mantissa>(lo, max_exp, is_exp_a);
+    __m256i hi_bfp8 = convert_u32_to_bfp8<truncate_bfp_mantissa>(hi, max_exp, is_exp_a);
+
+    // Narrow 16 x 32-bit lanes to 16 bytes. Packing works within 128-bit lanes, leaving dwords ordered
+    // lo[0:3], hi[0:3], ..., lo[4:7], hi[4:7], ... so gather them back into element order.
+    __m256i packed = _mm256_packus_epi32(lo_bfp8, hi_bfp8);
+    packed = _mm256_packus_epi16(packed, packed);
+    packed = _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 0, 4, 1, 5));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data_out), _mm256_castsi256_si128(packed));
+}
 
-                    for (uint32_t u32_datum : single_row) {
-                        data.push_back(u32_datum);
-                        if (data.size() % num_elements_in_dword == 0) {
-                            uint32_t datum = create_packed_bfp8_packed_as_u32(data, exp, is_exp_a);
-                            packed_data.push_back(datum);
-                            data.clear();
-                        }
-                    }
+}  // namespace bfp8_detail
+
+// Packs one 32x32 tile of fp32 values into bfp8 (16 exponent words followed by 256 data words).
+// With row_major_input the tile is read row-major with `row_stride` floats between rows, so a tile can be taken
+// straight out of a larger row-major matrix and tilized while it is packed. Otherwise the tile is read as four
+// contiguous row-major 16x16 faces.
+template <bool truncate_bfp_mantissa=false>
+inline void pack_fp32_tile_as_bfp8(const float* tile, bool row_major_input, uint32_t row_stride, bool is_exp_a, uint32_t* packed_tile) {
+    constexpr int subtiles_in_tile_row = 2;
+    constexpr int subtiles_in_tile_col = 2;
+    constexpr int subtile_rows = 16;
+    constexpr int subtile_cols = 16;
+    constexpr int num_exponents_in_tile = subtiles_in_tile_row * subtiles_in_tile_col * subtile_rows;
+
+    // Exponents and data are both packed 4 per dword with [0] in the LSBs, which is memory order on the host
+    uint8_t* exponents = reinterpret_cast<uint8_t*>(packed_tile);
+    uint8_t* data = exponents + num_exponents_in_tile;
+    for (int tr = 0; tr < subtiles_in_tile_row; ++tr) {
+        for (int tc = 0; tc < subtiles_in_tile_col; ++tc) {
+            for (int i = 0; i < subtile_rows; ++i) {
+                const float* row;
+                if (row_major_input) {
+                    row = tile + (tr * subtile_rows + i) * row_stride + tc * subtile_cols;
+                } else {
+                    row = tile + ((tr * subtiles_in_tile_col + tc) * subtile_rows + i) * subtile_cols;
                 }
+                bfp8_detail::pack_face_row<truncate_bfp_mantissa>(row, is_exp_a, exponents++, data);
+                data += subtile_cols;
             }
         }
-        // prepend exponents to follow data packing order:
-        //  16 exponents for sub-tile 0​
-        //      exp_row0, exp_row1, … exp_row15​
-        //  16 exponents for sub-tile 1​
-        //  16 exponents for sub-tile 2​
-        //  16 exponents for sub-tile 3​
-        //  entire sub-tile 0 (RM layout)​
-        //  entire sub-tile 1 (RM layout)​
-        //  entire sub-tile 2 (RM layout)​
-        //  entire sub-tile 3 (RM layout)
-        packed_result.insert(packed_result.end(), packed_data.begin(), packed_data.end());
+    }
+}
+
+template <bool truncate_bfp_mantissa=false>
+inline std::vector<uint32_t> pack_fp32_vec_as_bfp8_tiles(const float* fp32_data, size_t num_elements, bool row_major_input, bool is_exp_a) {
+    ZoneScoped;
+
+    uint32_t single_bfp8_tile_size = tile_size(tt::DataFormat::Bfp8_b);
+    int num_float_in_tile = 1024;
+    TT_ASSERT(num_elements % num_float_in_tile == 0);
+    uint32_t num_tiles = num_elements / num_float_in_tile;
+
+    // prepend exponents to follow data packing order:
+    //  16 exponents for sub-tile 0​
+    //      exp_row0, exp_row1, … exp_row15​
+    //  16 exponents for sub-tile 1​
+    //  16 exponents for sub-tile 2​
+    //  16 exponents for sub-tile 3​
+    //  entire sub-tile 0 (RM layout)​
+    //  entire sub-tile 1 (RM layout)​
+    //  entire sub-tile 2 (RM layout)​
+    //  entire sub-tile 3 (RM layout)
+    uint32_t num_packed_in_tile = single_bfp8_tile_size / sizeof(uint32_t);
+    std::vector<uint32_t> packed_result(num_tiles * num_packed_in_tile);
+    for (uint32_t tile_index = 0; tile_index < num_tiles; ++tile_index) {
+        pack_fp32_tile_as_bfp8<truncate_bfp_mantissa>(
+            fp32_data + tile_index * num_float_in_tile, row_major_input, /*row_stride=*/32, is_exp_a,
+            packed_result.data() + tile_index * num_packed_in_tile);
+    }
+
+    return packed_result;
+}
+
+template <bool truncate_bfp_mantissa=false>
+inline std::vector<uint32_t> pack_fp32_vec_as_bfp8_tiles(const std::vector<float> &fp32_vec, bool row_major_input, bool is_exp_a) {
+    return pack_fp32_vec_as_bfp8_tiles<truncate_bfp_mantissa>(fp32_vec.data(), fp32_vec.size(), row_major_input, is_exp_a);
+}
+
+// Tilizes and packs a row-major [height x width] fp32 matrix (or stack of matrices) into bfp8 tiles in one pass
+template <bool truncate_bfp_mantissa=false>
+inline std::vector<uint32_t> pack_fp32_row_major_as_bfp8_tiles(const float* fp32_data, uint64_t height, uint32_t width, bool is_exp_a) {
+    ZoneScoped;
+
+    TT_ASSERT(height % 32 == 0 and width % 32 == 0, "Height and width must be divisible by 32");
+    uint32_t num_packed_in_tile = tile_size(tt::DataFormat::Bfp8_b) / sizeof(uint32_t);
+    uint32_t num_tiles_in_row = width / 32;
+    std::vector<uint32_t> packed_result((height / 32) * num_tiles_in_row * num_packed_in_tile);
+    uint32_t* packed_tile = packed_result.data();
+    for (uint64_t tile_row = 0; tile_row < height / 32; ++tile_row) {
+        for (uint32_t tile_col = 0; tile_col < num_tiles_in_row; ++tile_col) {
+            const float* tile = fp32_data + tile_row * 32 * width + tile_col * 32;
+            pack_fp32_tile_as_bfp8<truncate_bfp_mantissa>(tile, /*row_major_input=*/true, width, is_exp_a, packed_tile);
+            packed_tile += num_packed_in_tile;
+        }
     }
 
     return packed_result;
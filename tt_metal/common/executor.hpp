@@ -4,8 +4,11 @@
 
 #pragma once
 #include "third_party/taskflow/taskflow/taskflow.hpp"
+#include <algorithm>
+#include <exception>
 #include <thread>
 #include <stdexcept>
+#include <vector>
 
 namespace tt::tt_metal::detail {
     static const size_t EXECUTOR_NTHREADS = std::getenv("TT_METAL_THREADCOUNT") ? std::stoi( std::getenv("TT_METAL_THREADCOUNT") ) : std::thread::hardware_concurrency();
@@ -34,4 +37,51 @@ namespace tt::tt_metal::detail {
 
         return res;
     }
+
+    // Splits [0, num_items) into at most EXECUTOR_NTHREADS chunks of at least grain_size items and calls func(begin, end)
+    // for each chunk on the executor. The calling thread runs the first chunk and then waits for the rest; the first
+    // exception thrown by any chunk is re-thrown once every chunk has finished.
+    // Runs everything inline when called from an executor worker, because blocking a worker on tasks queued behind it
+    // can starve the pool.
+    template<class F>
+    void parallel_for(size_t num_items, size_t grain_size, F&& func)
+    {
+        grain_size = std::max<size_t>(grain_size, 1);
+        size_t num_chunks = std::min<size_t>((num_items + grain_size - 1) / grain_size, EXECUTOR_NTHREADS);
+        if (num_chunks <= 1 or GetExecutor().this_worker_id() != -1) {
+            func(size_t{0}, num_items);
+            return;
+        }
+
+        size_t chunk_size = (num_items + num_chunks - 1) / num_chunks;
+        std::vector<std::future<void>> events;
+        events.reserve(num_chunks - 1);
+        for (size_t begin = chunk_size; begin < num_items; begin += chunk_size) {
+            size_t end = std::min(begin + chunk_size, num_items);
+            events.emplace_back(async([&func, begin, end] { func(begin, end); }));
+        }
+
+        std::exception_ptr exception = nullptr;
+        try {
+            func(size_t{0}, chunk_size);
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        // Every chunk references func, so wait for all of them before surfacing an error
+        for (auto& event : events) {
+            event.wait();
+        }
+        for (auto& event : events) {
+            try {
+                event.get();
+            } catch (...) {
+                if (exception == nullptr) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+        if (exception != nullptr) {
+            std::rethrow_exception(exception);
+        }
+    }
 }
@@ -13,6 +13,7 @@
 #include "common/assert.hpp"
 #include "tt_metal/third_party/tracy/public/tracy/Tracy.hpp"
 #include "math.hpp"
+#include "tile_transpose.hpp"
 
 using namespace std;
 enum TensorLayout {
@@ -24,67 +25,25 @@ enum TensorLayout {
 template <class T, template<typename> typename BufferType>
 std::vector<T> convert_to_tile_layout(const BufferType<T>& data) {
     ZoneScoped;
-    std::vector<T> result;
     TT_ASSERT(data.size() % (32 * 32) == 0);
-    int num_tiles = data.size() / (32 * 32);
-    for(int tile_idx = 0; tile_idx < num_tiles; tile_idx++) {
-        std::vector<T> top_left;
-        std::vector<T> top_right;
-        std::vector<T> bottom_left;
-        std::vector<T> bottom_right;
-
-        int index = tile_idx * (32 * 32);
-        for(int row = 0; row < 32; row++) {
-            for(int col = 0; col < 32; col++) {
-                if(row < 16 and col < 16) {
-                    top_left.push_back(data[index]);
-                } else if(row < 16 and col >= 16) {
-                    top_right.push_back(data[index]);
-                } else if(row >= 16 and col < 16) {
-                    bottom_left.push_back(data[index]);
-                } else if(row >= 16 and col >= 16) {
-                    bottom_right.push_back(data[index]);
-                } else {
-                    TT_ASSERT(false);
-                }
-                index++;
-            }
-        }
-        TT_ASSERT(top_left.size() == 16 * 16);
-        TT_ASSERT(top_right.size() == 16 * 16);
-        TT_ASSERT(bottom_left.size() == 16 * 16);
-        TT_ASSERT(bottom_right.size() == 16 * 16);
-
-        result.insert(result.end(), top_left.begin(), top_left.end());
-        result.insert(result.end(), top_right.begin(), top_right.end());
-        result.insert(result.end(), bottom_left.begin(), bottom_left.end());
-        result.insert(result.end(), bottom_right.begin(), bottom_right.end());
+    std::vector<T> result(data.size());
+    if (data.size() == 0) {
+        return result;
     }
-
+    // Each 32x32 row-major tile is one row of tiles of a 32-wide matrix
+    tt::tile_transpose::tilize(&data[0], result.data(), data.size() / 32, 32);
     return result;
 }
 
 template <class T, template<typename> typename BufferTyp>
 std::vector<T> convert_to_flat_layout(const BufferTyp<T>& data) {
     ZoneScoped;
-    std::vector<T> result;
     TT_ASSERT(data.size() % (32 * 32) == 0);
-    int num_tiles = data.size() / (32 * 32);
-    for(int tile_idx = 0; tile_idx < num_tiles; tile_idx++) {
-        int tile_start = tile_idx * (32 * 32);
-        for(int face_y = 0; face_y < 2; face_y++) {
-            for(int row = 0; row < 16; row++) {
-                int start = tile_start + face_y * (16 * 32) + row * 16;
-                for(int face_x = 0; face_x < 2; face_x++) {
-                    int offset = face_x * (16 * 16);
-                    for(int col = offset; col < offset + 16; col++) {
-                        result.push_back(data[start + col]);
-                    }
-                }
-            }
-        }
+    std::vector<T> result(data.size());
+    if (data.size() == 0) {
+        return result;
     }
-
+    tt::tile_transpose::untilize(&data[0], result.data(), data.size() / 32, 32);
     return result;
 }
 
@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+//
+// Host tilize/untilize engine.
+// Converts between row-major data and 32x32 tiles made of four row-major 16x16 faces
+// (TILED32_4FACES in test_tiles.hpp). Every face row is 16 contiguous elements on both sides of the
+// conversion, so the engine moves whole face rows with vector loads/stores straight into a preallocated
+// output instead of building it element by element.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <immintrin.h>
+
+#include "common/assert.hpp"
+
+namespace tt::tile_transpose {
+
+constexpr uint32_t TILE_HEIGHT = 32;
+constexpr uint32_t TILE_WIDTH = 32;
+constexpr uint32_t FACE_HEIGHT = 16;
+constexpr uint32_t FACE_WIDTH = 16;
+constexpr uint32_t TILE_NUM_ELEMENTS = TILE_HEIGHT * TILE_WIDTH;
+constexpr uint32_t FACE_NUM_ELEMENTS = FACE_HEIGHT * FACE_WIDTH;
+
+// Number of tiles along a row of tiles that are converted together. A block of 8 fp32 tiles is 32KB,
+// so the tiles being filled (or drained) stay resident in L1 while the 32 input rows stream through.
+constexpr uint32_t DEFAULT_BLOCK_WIDTH_TILES = 8;
+
+namespace detail {
+
+// Copies one 16 element face row. This is 32B for 16-bit types and 64B for 32-bit types.
+template <typename T>
+inline void copy_face_row(const T* src, T* dst) {
+    static_assert(std::is_trivially_copyable_v<T>, "Tile transpose requires a trivially copyable element type");
+    static_assert(sizeof(T) == 2 or sizeof(T) == 4, "Tile transpose supports 16-bit and 32-bit element types only");
+    constexpr uint32_t num_bytes = FACE_WIDTH * sizeof(T);
+#if defined(__AVX512F__)
+    if constexpr (num_bytes == 64) {
+        _mm512_storeu_si512(reinterpret_cast<void*>(dst), _mm512_loadu_si512(reinterpret_cast<const void*>(src)));
+        return;
+    }
+#endif
+#if defined(__AVX2__)
+    const auto* src_bytes = reinterpret_cast<const char*>(src);
+    auto* dst_bytes = reinterpret_cast<char*>(dst);
+    for (uint32_t offset = 0; offset < num_bytes; offset += sizeof(__m256i)) {
+        __m256i row = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_bytes + offset));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst_bytes + offset), row);
+    }
+#else
+    std::memcpy(dst, src, num_bytes);
+#endif
+}
+
+// Offset of row `row` (0..31) of a tile's left half inside the tile. The right half is one face further.
+inline uint32_t face_row_offset(uint32_t row) {
+    return (row / FACE_HEIGHT) * 2 * FACE_NUM_ELEMENTS + (row % FACE_HEIGHT) * FACE_WIDTH;
+}
+
+}  // namespace detail
+
+// Tilizes rows of tiles [first_tile_row, last_tile_row) of a row-major matrix with `width` columns.
+// A stack of matrices whose height is a multiple of 32 is treated as one tall matrix, since tiles are
+// ordered the same way in both cases. Output tiles are written at their final position in `dst`, which
+// lets callers split one conversion across threads by tile row.
+template <typename T>
+inline void tilize_tile_rows(
+    const T* src, T* dst, uint32_t width, uint64_t first_tile_row, uint64_t last_tile_row,
+    uint32_t block_width_tiles = DEFAULT_BLOCK_WIDTH_TILES) {
+    TT_ASSERT(width % TILE_WIDTH == 0, "Width must be divisible by 32");
+    TT_ASSERT(block_width_tiles > 0);
+    const uint32_t num_tiles_in_row = width / TILE_WIDTH;
+    for (uint64_t tile_row = first_tile_row; tile_row < last_tile_row; tile_row++) {
+        const T* src_tile_row = src + tile_row * TILE_HEIGHT * width;
+        T* dst_tile_row = dst + tile_row * num_tiles_in_row * TILE_NUM_ELEMENTS;
+        for (uint32_t block_start = 0; block_start < num_tiles_in_row; block_start += block_width_tiles) {
+            const uint32_t block_end = std::min(block_start + block_width_tiles, num_tiles_in_row);
+            for (uint32_t row = 0; row < TILE_HEIGHT; row++) {
+                const T* src_row = src_tile_row + row * width;
+                const uint32_t dst_offset = detail::face_row_offset(row);
+                for (uint32_t tile = block_start; tile < block_end; tile++) {
+                    const T* src_tile = src_row + tile * TILE_WIDTH;
+                    T* dst_tile = dst_tile_row + tile * TILE_NUM_ELEMENTS + dst_offset;
+                    detail::copy_face_row(src_tile, dst_tile);
+                    detail::copy_face_row(src_tile + FACE_WIDTH, dst_tile + FACE_NUM_ELEMENTS);
+                }
+            }
+        }
+    }
+}
+
+// Inverse of tilize_tile_rows
+template <typename T>
+inline void untilize_tile_rows(
+    const T* src, T* dst, uint32_t width, uint64_t first_tile_row, uint64_t last_tile_row,
+    uint32_t block_width_tiles = DEFAULT_BLOCK_WIDTH_TILES) {
+    TT_ASSERT(width % TILE_WIDTH == 0, "Width must be divisible by 32");
+    TT_ASSERT(block_width_tiles > 0);
+    const uint32_t num_tiles_in_row = width / TILE_WIDTH;
+    for (uint64_t tile_row = first_tile_row; tile_row < last_tile_row; tile_row++) {
+        const T* src_tile_row = src + tile_row * num_tiles_in_row * TILE_NUM_ELEMENTS;
+        T* dst_tile_row = dst + tile_row * TILE_HEIGHT * width;
+        for (uint32_t block_start = 0; block_start < num_tiles_in_row; block_start += block_width_tiles) {
+            const uint32_t block_end = std::min(block_start + block_width_tiles, num_tiles_in_row);
+            for (uint32_t row = 0; row < TILE_HEIGHT; row++) {
+                T* dst_row = dst_tile_row + row * width;
+                const uint32_t src_offset = detail::face_row_offset(row);
+                for (uint32_t tile = block_start; tile < block_end; tile++) {
+                    const T* src_tile = src_tile_row + tile * TILE_NUM_ELEMENTS + src_offset;
+                    T* dst_tile = dst_row + tile * TILE_WIDTH;
+                    detail::copy_face_row(src_tile, dst_tile);
+                    detail::copy_face_row(src_tile + FACE_NUM_ELEMENTS, dst_tile + FACE_WIDTH);
+                }
+            }
+        }
+    }
+}
+
+// Tilizes a row-major [height x width] matrix (or stack of matrices) from `src` into `dst`.
+// `dst` must hold height * width elements and must not alias `src`.
+template <typename T>
+inline void tilize(const T* src, T* dst, uint64_t height, uint32_t width) {
+    TT_ASSERT(height % TILE_HEIGHT == 0, "Height must be divisible by 32");
+    tilize_tile_rows(src, dst, width, 0, height / TILE_HEIGHT);
+}
+
+// Untilizes tiles from `src` into a row-major [height x width] matrix (or stack of matrices) in `dst`.
+// `dst` must hold height * width elements and must not alias `src`.
+template <typename T>
+inline void untilize(const T* src, T* dst, uint64_t height, uint32_t width) {
+    TT_ASSERT(height % TILE_HEIGHT == 0, "Height must be divisible by 32");
+    untilize_tile_rows(src, dst, width, 0, height / TILE_HEIGHT);
+}
+
+}  // namespace tt::tile_transpose
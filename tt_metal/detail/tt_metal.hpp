@@ -13,8 +13,10 @@
 #include "tt_metal/impl/dispatch/command_queue.hpp"
 #include "tt_metal/impl/dispatch/dispatch_core_manager.hpp"
 #include "tt_metal/detail/program.hpp"
+#include "tt_metal/llrt/rtoptions.hpp"
 #include "tt_metal/llrt/watcher.hpp"
 #include "tt_metal/jit_build/genfiles.hpp"
+#include "tt_metal/tools/profiler/common.hpp"
 #include "tt_metal/host_api.hpp"
 
 using std::unique_lock;
@@ -125,6 +127,30 @@ namespace tt::tt_metal{
          * */
         void DumpDeviceProfileResults(Device *device,const std::unordered_map<CoreType, std::vector<CoreCoord>> &logical_cores);
 
+        /**
+         * Drain the device profiler rings of the device one last time and stop draining them. Called when the device
+         * is closed, does nothing unless TT_METAL_DEVICE_PROFILER_RING is set
+         *
+         * Return value: void
+         *
+         * | Argument      | Description                                       | Type                                                         | Valid Range               | Required |
+         * |---------------|---------------------------------------------------|--------------------------------------------------------------|---------------------------|----------|
+         * | device        | The device being closed.                          | Device *                                                     |                           | True     |
+         * */
+        void DetachDeviceProfilerRing(Device *device);
+
+        /**
+         * Counters of every RISC profiler buffer drained on the device with TT_METAL_DEVICE_PROFILER_RING set. The high
+         * watermark of a buffer reaching its ring size means the host fell behind and markers were overwritten
+         *
+         * Return value: std::vector<DeviceProfilerRingStats>
+         *
+         * | Argument      | Description                                       | Type                                                         | Valid Range               | Required |
+         * |---------------|---------------------------------------------------|--------------------------------------------------------------|---------------------------|----------|
+         * | device        | The device holding the profiled programs.         | Device *                                                     |                           | True     |
+         * */
+        std::vector<DeviceProfilerRingStats> GetDeviceProfilerRingStats(Device *device);
+
         /**
          * Set the directory for all CSV logs produced by the profiler instance in the tt-metal module
          *
@@ -285,7 +311,13 @@ namespace tt::tt_metal{
             static std::mutex cq_creation_mutex;
             {
                 std::lock_guard<std::mutex> lock(cq_creation_mutex);
-                command_queues[device->id()] = std::make_unique<CommandQueue>(device, 0);
+                // The command queue may own a worker thread, so it's only rebuilt for a reopened device or a new mode
+                std::unique_ptr<CommandQueue> &cq = command_queues[id];
+                if (cq == nullptr or cq->device != device or &cq->manager != device->manager.get() or
+                    cq->async_mode != llrt::OptionsG.get_async_command_queue_enabled()) {
+                    cq.reset();
+                    cq = std::make_unique<CommandQueue>(device, 0);
+                }
             }
             return *(command_queues[id]);
         }
@@ -315,6 +347,14 @@ namespace tt::tt_metal{
             }
         }
 
+        // Releases the device copy of a program that the command queue keeps for re-enqueueing it
+        inline void EvictCommandQueueProgram(Device *device, const Program &program)
+        {
+            if (std::getenv("TT_METAL_SLOW_DISPATCH_MODE") == nullptr) {
+                EvictProgram(GetCommandQueue(device), program);
+            }
+        }
+
         inline void GenerateDeviceHeaders(Device *device,
                                           const std::string &path)
         {
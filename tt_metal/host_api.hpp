@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <variant>
 #include <vector>
@@ -31,6 +32,7 @@ class Program;
 class Host;
 class Device;
 class CommandQueue;
+class Event;
 class Trace;
 class CircularBuffer;
 
@@ -240,9 +242,25 @@ void SetRuntimeArgs(const Program &program, KernelHandle kernel, const std::vari
 void SetRuntimeArgs(const Program &program, KernelHandle kernel, const std::vector< CoreCoord > & core_spec, const std::vector< std::vector<uint32_t> > &runtime_args);
 
 /**
- * Get the runtime args for a kernel.
+ * Set the same number of runtime args on many cores of a kernel at once, reading each core's args from a strided array. The args of core_spec[i] start at runtime_args + i * stride, a stride of 0 gives every core the same args.
  *
- * Return value: std::vector<uint32_t> &
+ * Return value: void
+ *
+ * | Argument         | Description                                                            | Type                           | Valid Range                                                              | Required |
+ * |------------------|------------------------------------------------------------------------|--------------------------------|--------------------------------------------------------------------------|----------|
+ * | program          | The program containing kernels, circular buffers, semaphores           | const Program &                |                                                                          | Yes      |
+ * | kernel_id        | ID of the kernel that will receive the runtime args                    | KernelHandle (uint64_t)        |                                                                          | Yes      |
+ * | core_spec        | Location of Tensix core(s) where the runtime args will be written      | const std::vector<CoreCoord> & | Any set of logical Tensix core coordinates on which the kernel is placed | Yes      |
+ * | runtime_args     | The runtime args of the first core                                     | const uint32_t *               | At least (core_spec.size() - 1) * stride + num_runtime_args words        | Yes      |
+ * | num_runtime_args | Number of runtime args of each core                                    | uint32_t                       |                                                                          | Yes      |
+ * | stride           | Words between the runtime args of consecutive cores                    | uint32_t                       | 0 or at least num_runtime_args                                           | Yes      |
+ */
+void SetRuntimeArgs(const Program &program, KernelHandle kernel, const std::vector<CoreCoord> &core_spec, const uint32_t *runtime_args, uint32_t num_runtime_args, uint32_t stride);
+
+/**
+ * Get the runtime args for a kernel. The returned args can be modified in place, a copy of them is only valid until another core of the kernel gets runtime args.
+ *
+ * Return value: RuntimeArgsData &
  *
  * | Argument     | Description                                                            | Type                          | Valid Range                        | Required |
  * |--------------|------------------------------------------------------------------------|-------------------------------|------------------------------------|----------|
@@ -250,11 +268,15 @@ void SetRuntimeArgs(const Program &program, KernelHandle kernel, const std::vect
  * | kernel_id    | ID of the kernel that will receive the runtime args                    | KernelHandle (uint64_t)                |                                    | Yes      |
  * | logical_core | The location of the Tensix core where the runtime args will be written | const CoreCoord &             | Any logical Tensix core coordinate | Yes      |
  */
-std::vector<uint32_t>& GetRuntimeArgs(const Program &program, KernelHandle kernel_id, const CoreCoord &logical_core);
+RuntimeArgsData& GetRuntimeArgs(const Program &program, KernelHandle kernel_id, const CoreCoord &logical_core);
 
 /**
  * Reads a buffer from the device
  *
+ * A non-blocking read returns once the read is issued, the command queue's completion reader thread copies the data into
+ * dst as the device writes it while later commands are enqueued. The data is in dst once an event recorded after the read
+ * completes, or after Finish. dst must not be resized or freed until then.
+ *
  * Return value: void
  *
  * | Argument     | Description                                                            | Type                          | Valid Range                            | Required |
@@ -262,13 +284,17 @@ std::vector<uint32_t>& GetRuntimeArgs(const Program &program, KernelHandle kerne
  * | cq           | The command queue object which dispatches the command to the hardware  | CommandQueue &                |                                        | Yes      |
  * | buffer       | The device buffer we are reading from                                  | Buffer &                      |                                        | Yes      |
  * | dst          | The vector where the results that are read will be stored              | vector<uint32_t> &            |                                        | Yes      |
- * | blocking     | Whether or not this is a blocking operation                            | bool                          | Only blocking mode supported currently | Yes      |
+ * | blocking     | Whether or not this is a blocking operation                            | bool                          |                                        | Yes      |
  */
 void EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, vector<uint32_t>& dst, bool blocking);
 
 /**
  * Reads a buffer from the device
  *
+ * A non-blocking read returns once the read is issued, the command queue's completion reader thread copies the data into
+ * dst as the device writes it while later commands are enqueued. The data is in dst once an event recorded after the read
+ * completes, or after Finish. dst must not be resized or freed until then.
+ *
  * Return value: void
  *
  * | Argument     | Description                                                            | Type                          | Valid Range                            | Required |
@@ -276,13 +302,16 @@ void EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, vector<uint32_t>& dst,
  * | cq           | The command queue object which dispatches the command to the hardware  | CommandQueue &                |                                        | Yes      |
  * | buffer       | The device buffer we are reading from                                  | Buffer &                      |                                        | Yes      |
  * | dst          | The memory where the result will be stored                             | void*                         |                                        | Yes      |
- * | blocking     | Whether or not this is a blocking operation                            | bool                          | Only blocking mode supported currently | Yes      |
+ * | blocking     | Whether or not this is a blocking operation                            | bool                          |                                        | Yes      |
  */
 void EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, void* dst, bool blocking);
 
 /**
  * Writes a buffer to the device
  *
+ * A non-blocking write is done with src when it returns, so src can be reused right away. With the async command queue
+ * (TT_METAL_ASYNC_COMMAND_QUEUE) it copies src for the command queue's worker thread.
+ *
  * Return value: void
  *
  * | Argument     | Description                                                            | Type                          | Valid Range                        | Required |
@@ -297,6 +326,9 @@ void EnqueueWriteBuffer(CommandQueue& cq, Buffer& buffer, vector<uint32_t>& src,
 /**
  * Writes a buffer to the device
  *
+ * A non-blocking write is done with src when it returns, so src can be reused right away. With the async command queue
+ * (TT_METAL_ASYNC_COMMAND_QUEUE) it copies src for the command queue's worker thread.
+ *
  * Return value: void
  *
  * | Argument     | Description                                                            | Type                          | Valid Range                        | Required |
@@ -308,9 +340,31 @@ void EnqueueWriteBuffer(CommandQueue& cq, Buffer& buffer, vector<uint32_t>& src,
  */
 void EnqueueWriteBuffer(CommandQueue& cq, Buffer& buffer, const void* src, bool blocking);
 
+/**
+ * Writes a contiguous range of pages of an interleaved buffer to the device
+ *
+ * Like EnqueueWriteBuffer, a non-blocking write is done with src when it returns.
+ *
+ * Return value: void
+ *
+ * | Argument       | Description                                                            | Type                          | Valid Range                                      | Required |
+ * |----------------|------------------------------------------------------------------------|-------------------------------|--------------------------------------------------|----------|
+ * | cq             | The command queue object which dispatches the command to the hardware  | CommandQueue &                |                                                  | Yes      |
+ * | buffer         | The device buffer we are writing to                                    | Buffer &                      | Must not be sharded                              | Yes      |
+ * | src            | The pages we are writing, starting with page dst_page_index         | const void*                   |                                                  | Yes      |
+ * | dst_page_index | Index of the first buffer page to write                                | uint32_t                      | 0 to buffer.num_pages() - 1                      | Yes      |
+ * | num_pages      | Number of pages to write                                               | uint32_t                      | Up to buffer.num_pages() - dst_page_index        | Yes      |
+ * | blocking       | Whether or not this is a blocking operation                            | bool                          |                                                  | Yes      |
+ */
+void EnqueueWriteBufferPages(CommandQueue& cq, Buffer& buffer, const void* src, uint32_t dst_page_index, uint32_t num_pages, bool blocking);
+
 /**
  * Writes a program to the device and launches it
  *
+ * With the async command queue (TT_METAL_ASYNC_COMMAND_QUEUE) the program is read on the command queue's worker thread,
+ * and the call waits for the worker to be done with it, so the program can be changed or freed once it returns. Hand
+ * the program over as a shared_ptr to return without waiting.
+ *
  * Return value: void
  *
  * | Argument     | Description                                                            | Type                          | Valid Range                        | Required |
@@ -323,6 +377,25 @@ void EnqueueWriteBuffer(CommandQueue& cq, Buffer& buffer, const void* src, bool
  */
 void EnqueueProgram(CommandQueue& cq, Program& program, bool blocking, std::optional<std::reference_wrapper<Trace>> trace = {});
 
+/**
+ * Writes a program to the device and launches it, keeping the program alive until the command queue is done with it
+ *
+ * With the async command queue (TT_METAL_ASYNC_COMMAND_QUEUE) the call returns without waiting for the command queue's
+ * worker thread, so the program must not be changed, including its runtime args, until an event recorded after the
+ * enqueue completes.
+ *
+ * Return value: void
+ *
+ * | Argument     | Description                                                            | Type                          | Valid Range                        | Required |
+ * |--------------|------------------------------------------------------------------------|-------------------------------|------------------------------------|----------|
+ * | cq           | The command queue object which dispatches the command to the hardware  | CommandQueue &                |                                    | Yes      |
+ * | program      | The program that will be executed on the device that cq is bound to    | std::shared_ptr<Program>      | Not null                           | Yes      |
+ * | blocking     | Whether or not this is a blocking operation                            | bool                          |                                    | Yes      |
+ * | trace        | The trace object which represents the history of previously issued     | optional<reference_wrapper<Trace>>                       |                                    | Yes      |
+ * |              | commands                                                               |                               |                                    |          |
+ */
+void EnqueueProgram(CommandQueue& cq, std::shared_ptr<Program> program, bool blocking, std::optional<std::reference_wrapper<Trace>> trace = {});
+
 /**
  * Blocks until all previously dispatched commands on the device have completed
  *
@@ -334,6 +407,42 @@ void EnqueueProgram(CommandQueue& cq, Program& program, bool blocking, std::opti
  */
 void Finish(CommandQueue& cq);
 
+/**
+ * Records an event in the command queue. The event completes once the host side of every command enqueued before it is
+ * done: sources of writes can be reused and reads have landed in their destination. Without the async command queue
+ * this is already the case when an enqueue call returns, apart from non-blocking reads still being copied out, and the
+ * event is complete from the start if there are none.
+ *
+ * Return value: Event
+ *
+ * | Argument     | Description                                                            | Type                          | Valid Range                        | Required |
+ * |--------------|------------------------------------------------------------------------|-------------------------------|------------------------------------|----------|
+ * | cq           | The command queue object which dispatches the command to the hardware  | CommandQueue &                |                                    | Yes      |
+ */
+Event EnqueueRecordEvent(CommandQueue& cq);
+
+/**
+ * Blocks until the event completes, rethrows the error if a command before it failed
+ *
+ * Return value: void
+ *
+ * | Argument     | Description                                                            | Type                          | Valid Range                        | Required |
+ * |--------------|------------------------------------------------------------------------|-------------------------------|------------------------------------|----------|
+ * | event        | Event recorded with EnqueueRecordEvent                                 | const Event &                 |                                    | Yes      |
+ */
+void EventSynchronize(const Event& event);
+
+/**
+ * Returns whether the event has completed, without blocking
+ *
+ * Return value: bool
+ *
+ * | Argument     | Description                                                            | Type                          | Valid Range                        | Required |
+ * |--------------|------------------------------------------------------------------------|-------------------------------|------------------------------------|----------|
+ * | event        | Event recorded with EnqueueRecordEvent                                 | const Event &                 |                                    | Yes      |
+ */
+bool EventQuery(const Event& event);
+
 /**
  * Creates a trace object which can be used to record commands that have been run. This
  * trace can later be replayed without the further need to create more commands.
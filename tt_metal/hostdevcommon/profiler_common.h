@@ -28,4 +28,22 @@ enum BufferIndex {BUFFER_END_INDEX, DROPPED_MARKER_COUNTER, MARKER_DATA_START};
 
 enum TimerDataIndex {TIMER_ID, TIMER_VAL_L, TIMER_VAL_H, TIMER_DATA_UINT32_SIZE};
 
+/**
+ * Ring mode, TT_METAL_DEVICE_PROFILER_RING
+ *
+ * The same buffer is a ring that never drops markers, the host drains it while kernels run. Buffer end index holds the
+ * number of markers written since the ring started and marker n is stored at
+ * MARKER_DATA_START + (n % ring size) * TIMER_DATA_UINT32_SIZE. Each RISC starts its ring once and flags it with
+ * RING_STARTED in place of the dropped marker counter, so the count carries over from one program to the next.
+ *
+ * */
+
+enum RingBufferIndex {RING_WRITE_COUNT = BUFFER_END_INDEX, RING_STATE = DROPPED_MARKER_COUNTER};
+
+constexpr uint32_t RING_STARTED = 0x474e4952;
+
+constexpr uint32_t ring_num_markers(uint32_t buffer_size_bytes) {
+    return (buffer_size_bytes / sizeof(uint32_t) - MARKER_DATA_START) / TIMER_DATA_UINT32_SIZE;
+}
+
 }
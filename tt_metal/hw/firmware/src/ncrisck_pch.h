@@ -0,0 +1,18 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Headers ncrisck.cc includes ahead of the kernel that don't depend on it, precompiled once per build environment
+// dataflow_api.h includes the kernel's generated headers so it can't be precompiled
+
+#pragma once
+
+#include "risc_common.h"
+#include "tensix.h"
+#include "tensix_types.h"
+#include "noc.h"
+#include "noc_overlay_parameters.h"
+#include "noc_nonblocking_api.h"
+#include "stream_io_map.h"
+#include "firmware_common.h"
+#include "tools/profiler/kernel_profiler.hpp"
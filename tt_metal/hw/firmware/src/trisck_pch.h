@@ -0,0 +1,14 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Headers trisck.cc and chlkc_list.h include ahead of the kernel that don't depend on it, precompiled once per build
+// environment. The llk api headers use the kernel's generated data format headers so they can't be precompiled
+
+#pragma once
+
+#include "firmware_common.h"
+#include "ckernel.h"
+#include "ckernel_gpr_map.h"
+#include "llk_param_structs.h"
+#include "tools/profiler/kernel_profiler.hpp"
@@ -33,6 +33,8 @@ class Algorithm {
 
     uint64_t max_size_bytes() const { return max_size_bytes_; }
 
+    uint64_t offset_bytes() const { return offset_bytes_; }
+
     std::optional<uint64_t> lowest_occupied_address() const {
         if (not this->lowest_occupied_address_.has_value()) {
             return this->lowest_occupied_address_;
@@ -55,6 +57,9 @@ class Algorithm {
 
     virtual Statistics get_statistics() const = 0;
 
+    // Every free and allocated block, ordered by address
+    virtual std::vector<MemoryBlock> get_blocks() const = 0;
+
     virtual void dump_blocks(std::ofstream &out) const = 0;
 
    protected:
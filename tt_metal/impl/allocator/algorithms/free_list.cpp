@@ -422,6 +422,16 @@ Statistics FreeList::get_statistics() const {
     return stats;
 }
 
+std::vector<MemoryBlock> FreeList::get_blocks() const {
+    std::vector<MemoryBlock> blocks;
+    Block *curr_block = this->block_head_;
+    while (curr_block != nullptr) {
+        blocks.push_back({.address = curr_block->address + this->offset_bytes_, .size = curr_block->size, .allocated = this->is_allocated(curr_block)});
+        curr_block = curr_block->next_block;
+    }
+    return blocks;
+}
+
 FreeList::~FreeList() {
     this->reset();
 }
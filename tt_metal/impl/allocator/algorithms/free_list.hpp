@@ -40,6 +40,8 @@ class FreeList : public Algorithm {
 
     Statistics get_statistics() const;
 
+    std::vector<MemoryBlock> get_blocks() const;
+
     void dump_blocks(std::ofstream &out) const;
 
    private:
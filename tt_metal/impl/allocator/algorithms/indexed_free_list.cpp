@@ -0,0 +1,409 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tt_metal/impl/allocator/algorithms/indexed_free_list.hpp"
+#include "common/assert.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace allocator {
+
+IndexedFreeList::IndexedFreeList(uint64_t max_size_bytes, uint64_t offset_bytes, uint64_t min_allocation_size, uint64_t alignment, FreeList::SearchPolicy search_policy)
+    : Algorithm(max_size_bytes, offset_bytes, min_allocation_size, alignment), search_policy_(search_policy), free_block_root_(nullptr), total_allocated_bytes_(0), priority_state_(0x9E3779B9) {
+    this->init();
+}
+
+void IndexedFreeList::init() {
+    this->insert_free_block(0, this->max_size_bytes_);
+}
+
+uint64_t IndexedFreeList::largest_size_in_subtree(const FreeBlock *root) {
+    return root == nullptr ? 0 : root->largest_size_in_subtree;
+}
+
+void IndexedFreeList::update_subtree(FreeBlock *root) {
+    root->largest_size_in_subtree = std::max({root->size, largest_size_in_subtree(root->left), largest_size_in_subtree(root->right)});
+}
+
+void IndexedFreeList::split(FreeBlock *root, uint64_t address, FreeBlock *&left, FreeBlock *&right) {
+    if (root == nullptr) {
+        left = nullptr;
+        right = nullptr;
+        return;
+    }
+    if (root->address < address) {
+        split(root->right, address, root->right, right);
+        left = root;
+    } else {
+        split(root->left, address, left, root->left);
+        right = root;
+    }
+    update_subtree(root);
+}
+
+IndexedFreeList::FreeBlock *IndexedFreeList::merge(FreeBlock *left, FreeBlock *right) {
+    if (left == nullptr) {
+        return right;
+    }
+    if (right == nullptr) {
+        return left;
+    }
+    if (left->priority > right->priority) {
+        left->right = merge(left->right, right);
+        update_subtree(left);
+        return left;
+    }
+    right->left = merge(left, right->left);
+    update_subtree(right);
+    return right;
+}
+
+void IndexedFreeList::resize(FreeBlock *root, uint64_t address, uint64_t new_address, uint64_t new_size_bytes) {
+    TT_ASSERT(root != nullptr);
+    if (root->address == address) {
+        root->address = new_address;
+        root->size = new_size_bytes;
+    } else {
+        resize(address < root->address ? root->left : root->right, address, new_address, new_size_bytes);
+    }
+    update_subtree(root);
+}
+
+void IndexedFreeList::destroy(FreeBlock *root) {
+    if (root == nullptr) {
+        return;
+    }
+    destroy(root->left);
+    destroy(root->right);
+    delete root;
+}
+
+void IndexedFreeList::collect_free_blocks(const FreeBlock *root, std::vector<std::pair<uint64_t, uint64_t>> &free_blocks) {
+    if (root == nullptr) {
+        return;
+    }
+    collect_free_blocks(root->left, free_blocks);
+    free_blocks.push_back({root->address, root->size});
+    collect_free_blocks(root->right, free_blocks);
+}
+
+// xorshift32, deterministic so that runs are reproducible
+uint32_t IndexedFreeList::next_priority() {
+    this->priority_state_ ^= this->priority_state_ << 13;
+    this->priority_state_ ^= this->priority_state_ >> 17;
+    this->priority_state_ ^= this->priority_state_ << 5;
+    return this->priority_state_;
+}
+
+void IndexedFreeList::insert_free_block(uint64_t address, uint64_t size_bytes) {
+    auto free_block = new IndexedFreeList::FreeBlock{
+        .address = address,
+        .size = size_bytes,
+        .largest_size_in_subtree = size_bytes,
+        .priority = this->next_priority()
+    };
+    FreeBlock *left, *right;
+    split(this->free_block_root_, address, left, right);
+    this->free_block_root_ = merge(merge(left, free_block), right);
+    if (this->search_policy_ == FreeList::SearchPolicy::BEST) {
+        this->free_blocks_by_size_.insert({size_bytes, address});
+    }
+}
+
+void IndexedFreeList::remove_free_block(uint64_t address, uint64_t size_bytes) {
+    FreeBlock *left, *middle, *right;
+    split(this->free_block_root_, address, left, middle);
+    split(middle, address + 1, middle, right);
+    TT_ASSERT(middle != nullptr and middle->address == address and middle->size == size_bytes);
+    delete middle;
+    this->free_block_root_ = merge(left, right);
+    if (this->search_policy_ == FreeList::SearchPolicy::BEST) {
+        this->free_blocks_by_size_.erase({size_bytes, address});
+    }
+}
+
+void IndexedFreeList::resize_free_block(uint64_t address, uint64_t size_bytes, uint64_t new_address, uint64_t new_size_bytes) {
+    resize(this->free_block_root_, address, new_address, new_size_bytes);
+    if (this->search_policy_ != FreeList::SearchPolicy::BEST) {
+        return;
+    }
+    // Reuse the index node instead of reallocating it
+    auto index_node = this->free_blocks_by_size_.extract({size_bytes, address});
+    TT_ASSERT(not index_node.empty());
+    index_node.value() = {new_size_bytes, new_address};
+    this->free_blocks_by_size_.insert(std::move(index_node));
+}
+
+const IndexedFreeList::FreeBlock *IndexedFreeList::find_free_block(uint64_t address) const {
+    const FreeBlock *curr_block = this->free_block_root_;
+    while (curr_block != nullptr and curr_block->address != address) {
+        curr_block = address < curr_block->address ? curr_block->left : curr_block->right;
+    }
+    return curr_block;
+}
+
+const IndexedFreeList::FreeBlock *IndexedFreeList::find_free_block_at_or_below(uint64_t address) const {
+    const FreeBlock *found_block = nullptr;
+    const FreeBlock *curr_block = this->free_block_root_;
+    while (curr_block != nullptr) {
+        if (curr_block->address <= address) {
+            found_block = curr_block;
+            curr_block = curr_block->right;
+        } else {
+            curr_block = curr_block->left;
+        }
+    }
+    return found_block;
+}
+
+// Matches FreeList::search_best: smallest block that fits, ties go to the lowest (bottom up) or highest (top down) address
+std::optional<std::pair<uint64_t, uint64_t>> IndexedFreeList::search_best(uint64_t size_bytes, bool bottom_up) const {
+    auto it = this->free_blocks_by_size_.lower_bound({size_bytes, 0});
+    if (it == this->free_blocks_by_size_.end()) {
+        return std::nullopt;
+    }
+    if (not bottom_up) {
+        it = std::prev(this->free_blocks_by_size_.upper_bound({it->first, std::numeric_limits<uint64_t>::max()}));
+    }
+    return std::make_pair(it->second, it->first);
+}
+
+// Matches FreeList::search_first: lowest (bottom up) or highest (top down) addressed block that fits
+std::optional<std::pair<uint64_t, uint64_t>> IndexedFreeList::search_first(uint64_t size_bytes, bool bottom_up) const {
+    const FreeBlock *curr_block = this->free_block_root_;
+    if (largest_size_in_subtree(curr_block) < size_bytes) {
+        return std::nullopt;
+    }
+    while (true) {
+        const FreeBlock *near = bottom_up ? curr_block->left : curr_block->right;
+        const FreeBlock *far = bottom_up ? curr_block->right : curr_block->left;
+        if (largest_size_in_subtree(near) >= size_bytes) {
+            curr_block = near;
+        } else if (curr_block->size >= size_bytes) {
+            return std::make_pair(curr_block->address, curr_block->size);
+        } else {
+            curr_block = far;
+        }
+    }
+}
+
+std::optional<std::pair<uint64_t, uint64_t>> IndexedFreeList::search(uint64_t size_bytes, bool bottom_up) const {
+    switch (this->search_policy_) {
+        case FreeList::SearchPolicy::BEST:
+            return search_best(size_bytes, bottom_up);
+        break;
+        case FreeList::SearchPolicy::FIRST:
+            return search_first(size_bytes, bottom_up);
+        break;
+        default:
+            TT_ASSERT(false && "Unsupported search policy");
+    }
+    return std::nullopt;
+}
+
+void IndexedFreeList::allocate_slice_of_free_block(uint64_t free_block_address, uint64_t free_block_size, uint64_t address, uint64_t size_bytes) {
+    TT_ASSERT(address >= free_block_address and address + size_bytes <= free_block_address + free_block_size);
+    uint64_t end_address = address + size_bytes;
+    uint64_t free_block_end_address = free_block_address + free_block_size;
+    bool free_space_on_left = address > free_block_address;
+    bool free_space_on_right = end_address < free_block_end_address;
+    if (free_space_on_left) {
+        this->resize_free_block(free_block_address, free_block_size, free_block_address, address - free_block_address);
+        if (free_space_on_right) {
+            this->insert_free_block(end_address, free_block_end_address - end_address);
+        }
+    } else if (free_space_on_right) {
+        this->resize_free_block(free_block_address, free_block_size, end_address, free_block_end_address - end_address);
+    } else {
+        this->remove_free_block(free_block_address, free_block_size);
+    }
+    this->allocated_blocks_.insert({address, size_bytes});
+    this->total_allocated_bytes_ += size_bytes;
+}
+
+void IndexedFreeList::update_lowest_occupied_address(uint64_t address) {
+    if (not this->lowest_occupied_address_.has_value()) {
+        this->lowest_occupied_address_ = address;
+    } else {
+        this->lowest_occupied_address_ = std::min(this->lowest_occupied_address_.value(), address);
+    }
+}
+
+// Blocks tile the whole range, so the lowest allocated block is at 0 unless a free block starts there
+void IndexedFreeList::update_lowest_occupied_address() {
+    if (this->allocated_blocks_.empty()) {
+        this->lowest_occupied_address_ = std::nullopt;
+        return;
+    }
+    const FreeBlock *first_block = this->find_free_block(0);
+    this->lowest_occupied_address_ = first_block == nullptr ? 0 : first_block->size;
+}
+
+std::optional<uint64_t> IndexedFreeList::allocate(uint64_t size_bytes, bool bottom_up, uint64_t address_limit) {
+    uint64_t alloc_size = size_bytes < this->min_allocation_size_ ? this->min_allocation_size_ : size_bytes;
+    alloc_size = this->align(alloc_size);
+    auto free_block = search(alloc_size, bottom_up);
+
+    if (not free_block.has_value()) {
+        return std::nullopt;
+    }
+
+    auto [free_block_address, free_block_size] = free_block.value();
+    uint64_t address = bottom_up ? free_block_address : (free_block_address + free_block_size) - alloc_size;
+    this->allocate_slice_of_free_block(free_block_address, free_block_size, address, alloc_size);
+
+    this->update_lowest_occupied_address(address);
+    if (address + this->offset_bytes_ < address_limit) {
+        TT_THROW("Out of Memory: Cannot allocate at an address below {}", address_limit);
+    }
+    return address + this->offset_bytes_;
+}
+
+std::optional<uint64_t> IndexedFreeList::allocate_at_address(uint64_t absolute_start_address, uint64_t size_bytes) {
+    TT_ASSERT(absolute_start_address % this->alignment_ == 0, "Requested address " + std::to_string(absolute_start_address) + " should be " + std::to_string(this->alignment_) + "B aligned");
+    auto start_address = absolute_start_address - this->offset_bytes_;
+    uint64_t alloc_size = size_bytes < this->min_allocation_size_ ? this->min_allocation_size_ : size_bytes;
+    alloc_size = this->align(alloc_size);
+    // Only the free block starting at or below start_address can encompass it
+    const FreeBlock *free_block = this->find_free_block_at_or_below(start_address);
+    if (free_block == nullptr or free_block->size < alloc_size or start_address - free_block->address > free_block->size - alloc_size) {
+        return std::nullopt;
+    }
+
+    this->allocate_slice_of_free_block(free_block->address, free_block->size, start_address, alloc_size);
+    this->update_lowest_occupied_address(start_address);
+    return absolute_start_address;
+}
+
+void IndexedFreeList::deallocate(uint64_t absolute_address) {
+    uint64_t address = absolute_address - this->offset_bytes_;
+    auto allocated_block = this->allocated_blocks_.find(address);
+    if (allocated_block == this->allocated_blocks_.end()) {
+        return;
+    }
+    uint64_t size_bytes = allocated_block->second;
+    this->allocated_blocks_.erase(allocated_block);
+    this->total_allocated_bytes_ -= size_bytes;
+
+    // Coalesce with the free blocks directly before and after the deallocated block
+    const FreeBlock *prev = this->find_free_block_at_or_below(address);
+    bool merge_prev = prev != nullptr and prev->address + prev->size == address;
+    const FreeBlock *next = this->find_free_block(address + size_bytes);
+    if (merge_prev and next != nullptr) {
+        uint64_t merged_size = prev->size + size_bytes + next->size;
+        this->remove_free_block(next->address, next->size);
+        this->resize_free_block(prev->address, prev->size, prev->address, merged_size);
+    } else if (merge_prev) {
+        this->resize_free_block(prev->address, prev->size, prev->address, prev->size + size_bytes);
+    } else if (next != nullptr) {
+        this->resize_free_block(next->address, next->size, address, size_bytes + next->size);
+    } else {
+        this->insert_free_block(address, size_bytes);
+    }
+
+    if (address == this->lowest_occupied_address_) {
+        this->update_lowest_occupied_address();
+    }
+}
+
+void IndexedFreeList::reset() {
+    destroy(this->free_block_root_);
+    this->free_block_root_ = nullptr;
+    this->free_blocks_by_size_.clear();
+    this->allocated_blocks_.clear();
+    this->total_allocated_bytes_ = 0;
+    this->lowest_occupied_address_ = std::nullopt;
+}
+
+void IndexedFreeList::clear() {
+    this->reset();
+    this->init();
+}
+
+std::vector<std::pair<uint64_t, uint64_t>> IndexedFreeList::available_addresses(uint64_t size_bytes) const {
+    uint64_t alloc_size = size_bytes < this->min_allocation_size_ ? this->min_allocation_size_ : size_bytes;
+    alloc_size = this->align(alloc_size);
+    std::vector<std::pair<uint64_t, uint64_t>> free_blocks;
+    collect_free_blocks(this->free_block_root_, free_blocks);
+    std::vector<std::pair<uint64_t, uint64_t>> addresses;
+    for (const auto &[address, size] : free_blocks) {
+        if (size >= alloc_size) {
+            uint64_t end_range = (address + size) - alloc_size;
+            addresses.push_back({address, end_range});
+        }
+    }
+    return addresses;
+}
+
+Statistics IndexedFreeList::get_statistics() const {
+    Statistics stats{
+        .total_allocatable_size_bytes = this->max_size_bytes_,
+        .total_allocated_bytes = this->total_allocated_bytes_,
+        .total_free_bytes = 0,
+        .largest_free_block_bytes = 0
+    };
+
+    std::vector<std::pair<uint64_t, uint64_t>> free_blocks;
+    collect_free_blocks(this->free_block_root_, free_blocks);
+    for (const auto &[address, size] : free_blocks) {
+        stats.total_free_bytes += size;
+        if (size >= stats.largest_free_block_bytes) {
+            stats.largest_free_block_bytes = size;
+            stats.largest_free_block_addrs.push_back(address + this->offset_bytes_);
+        }
+    }
+    if (stats.total_allocated_bytes == 0) {
+        stats.total_free_bytes = this->max_size_bytes_;
+        stats.largest_free_block_bytes = this->max_size_bytes_;
+    }
+    return stats;
+}
+
+std::vector<MemoryBlock> IndexedFreeList::get_blocks() const {
+    std::vector<std::pair<uint64_t, uint64_t>> free_blocks;
+    collect_free_blocks(this->free_block_root_, free_blocks);
+    std::vector<std::pair<uint64_t, uint64_t>> allocated_blocks(this->allocated_blocks_.begin(), this->allocated_blocks_.end());
+    std::sort(allocated_blocks.begin(), allocated_blocks.end());
+
+    std::vector<MemoryBlock> blocks;
+    blocks.reserve(free_blocks.size() + allocated_blocks.size());
+    auto free_block = free_blocks.begin();
+    auto allocated_block = allocated_blocks.begin();
+    while (free_block != free_blocks.end() or allocated_block != allocated_blocks.end()) {
+        if (allocated_block == allocated_blocks.end() or (free_block != free_blocks.end() and free_block->first < allocated_block->first)) {
+            blocks.push_back({.address = free_block->first + this->offset_bytes_, .size = free_block->second, .allocated = false});
+            free_block++;
+        } else {
+            blocks.push_back({.address = allocated_block->first + this->offset_bytes_, .size = allocated_block->second, .allocated = true});
+            allocated_block++;
+        }
+    }
+    return blocks;
+}
+
+void IndexedFreeList::dump_blocks(std::ofstream &out) const {
+    out << ",,Blocks:\n";
+    for (const auto &block : this->get_blocks()) {
+        out << ",,,Address (KB):," << block.address / 1024 << "\n"
+            << ",,,Size (KB):," << block.size / 1024 << "\n"
+            << ",,,Allocated (Y/N):," << (block.allocated ? "Y" : "N") << "\n";
+    }
+    out << "\n";
+}
+
+IndexedFreeList::~IndexedFreeList() {
+    this->reset();
+}
+
+}  // namespace allocator
+
+}  // namespace tt_metal
+
+}  // namespace tt
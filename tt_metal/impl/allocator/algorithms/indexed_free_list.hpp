@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <set>
+#include <unordered_map>
+
+#include "hostdevcommon/common_values.hpp"
+#include "tt_metal/impl/allocator/algorithms/allocator_algorithm.hpp"
+#include "tt_metal/impl/allocator/algorithms/free_list.hpp"
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace allocator {
+
+// Free list allocator that places blocks at exactly the same addresses as FreeList for a given search policy,
+// but without walking the block and free lists.
+//  - Free blocks live in a treap ordered by address where every node caches the largest free block in its subtree,
+//    so first fit from either end is a single O(log n) descent
+//  - With the best fit policy, free blocks are also indexed by (size, address), so best fit is a single O(log n) lookup
+//  - Allocated blocks are kept in a hash map from address to size, so deallocate does not search for the block
+class IndexedFreeList : public Algorithm {
+   public:
+    IndexedFreeList(uint64_t max_size_bytes, uint64_t offset_bytes, uint64_t min_allocation_size, uint64_t alignment, FreeList::SearchPolicy search_policy);
+
+    ~IndexedFreeList();
+
+    void init();
+
+    std::vector<std::pair<uint64_t, uint64_t>> available_addresses(uint64_t size_bytes) const;
+
+    std::optional<uint64_t> allocate(uint64_t size_bytes, bool bottom_up=true, uint64_t address_limit=0);
+
+    std::optional<uint64_t> allocate_at_address(uint64_t absolute_start_address, uint64_t size_bytes);
+
+    void deallocate(uint64_t absolute_address);
+
+    void clear();
+
+    Statistics get_statistics() const;
+
+    std::vector<MemoryBlock> get_blocks() const;
+
+    void dump_blocks(std::ofstream &out) const;
+
+   private:
+    struct FreeBlock {
+        uint64_t address;
+        uint64_t size;
+        uint64_t largest_size_in_subtree;
+        uint32_t priority;
+        FreeBlock *left = nullptr;
+        FreeBlock *right = nullptr;
+    };
+
+    static uint64_t largest_size_in_subtree(const FreeBlock *root);
+
+    static void update_subtree(FreeBlock *root);
+
+    // Splits root into blocks with address < address (left) and blocks with address >= address (right)
+    static void split(FreeBlock *root, uint64_t address, FreeBlock *&left, FreeBlock *&right);
+
+    // Every block in left must have a lower address than every block in right
+    static FreeBlock *merge(FreeBlock *left, FreeBlock *right);
+
+    // Changes the address and size of the block at address in place. The new address must keep the block between its
+    // neighbours, which holds whenever a free block shrinks or grows without overlapping another free block
+    static void resize(FreeBlock *root, uint64_t address, uint64_t new_address, uint64_t new_size_bytes);
+
+    static void destroy(FreeBlock *root);
+
+    static void collect_free_blocks(const FreeBlock *root, std::vector<std::pair<uint64_t, uint64_t>> &free_blocks);
+
+    void insert_free_block(uint64_t address, uint64_t size_bytes);
+
+    void remove_free_block(uint64_t address, uint64_t size_bytes);
+
+    void resize_free_block(uint64_t address, uint64_t size_bytes, uint64_t new_address, uint64_t new_size_bytes);
+
+    const FreeBlock *find_free_block(uint64_t address) const;
+
+    // Free block with the highest address that is <= address
+    const FreeBlock *find_free_block_at_or_below(uint64_t address) const;
+
+    std::optional<std::pair<uint64_t, uint64_t>> search_best(uint64_t size_bytes, bool bottom_up) const;
+
+    std::optional<std::pair<uint64_t, uint64_t>> search_first(uint64_t size_bytes, bool bottom_up) const;
+
+    std::optional<std::pair<uint64_t, uint64_t>> search(uint64_t size_bytes, bool bottom_up) const;
+
+    // Allocates [address, address + size_bytes) out of the free block starting at free_block_address
+    void allocate_slice_of_free_block(uint64_t free_block_address, uint64_t free_block_size, uint64_t address, uint64_t size_bytes);
+
+    uint32_t next_priority();
+
+    void reset();
+
+    void update_lowest_occupied_address();
+
+    void update_lowest_occupied_address(uint64_t address);
+
+    FreeList::SearchPolicy search_policy_;
+    FreeBlock *free_block_root_;
+    std::set<std::pair<uint64_t, uint64_t>> free_blocks_by_size_;
+    std::unordered_map<uint64_t, uint64_t> allocated_blocks_;
+    uint64_t total_allocated_bytes_;
+    uint32_t priority_state_;
+};
+
+}  // namespace allocator
+
+}  // namespace tt_metal
+
+}  // namespace tt
@@ -4,6 +4,7 @@
 
 #include "tt_metal/impl/allocator/allocator.hpp"
 #include "tt_metal/impl/allocator/algorithms/free_list.hpp"
+#include "tt_metal/impl/allocator/algorithms/indexed_free_list.hpp"
 #include "tt_metal/impl/buffers/buffer.hpp"
 #include "tt_metal/common/math.hpp"
 #include "tt_metal/detail/util.hpp"
@@ -17,7 +18,20 @@ namespace tt_metal {
 namespace allocator {
 
 void BankManager::init_allocator(uint64_t size_bytes, uint64_t offset) {
-    this->allocator_ = std::make_unique<FreeList>(
+    // IndexedFreeList places buffers at the same addresses as FreeList in O(log n) per operation.
+    // TT_METAL_ALLOCATOR_ALGORITHM=free_list falls back to the linear free list.
+    static const bool use_linear_free_list = std::getenv("TT_METAL_ALLOCATOR_ALGORITHM") != nullptr and std::string(std::getenv("TT_METAL_ALLOCATOR_ALGORITHM")) == "free_list";
+    if (use_linear_free_list) {
+        this->allocator_ = std::make_unique<FreeList>(
+            size_bytes,
+            offset,
+            this->min_allocation_size_bytes_,
+            ADDRESS_ALIGNMENT,
+            FreeList::SearchPolicy::FIRST
+        );
+        return;
+    }
+    this->allocator_ = std::make_unique<IndexedFreeList>(
         size_bytes,
         offset,
         this->min_allocation_size_bytes_,
@@ -86,6 +100,14 @@ uint64_t BankManager::allocate_buffer(uint32_t size, uint32_t page_size, bool bo
     }
     // Each page needs to be at a 32B aligned address
     uint32_t size_per_bank = tt::tt_metal::detail::SizeBytesPerBank(size, page_size, num_banks);
+    if (not this->arenas_.empty() and this->arenas_.back().bottom_up() == bottom_up) {
+        // Arenas are reserved above the interleaved address limit, so they can hold interleaved and sharded buffers.
+        // An arena only takes buffers placed in its own direction, the others go to the general allocator
+        auto address = this->arenas_.back().allocate(size_per_bank);
+        if (address.has_value()) {
+            return address.value();
+        }
+    }
     uint64_t address_limit = 0;
     if(!is_sharded and this->buffer_type_ == BufferType::L1) {
         address_limit = this->interleaved_address_limit_;
@@ -100,10 +122,30 @@ uint64_t BankManager::allocate_buffer(uint32_t size, uint32_t page_size, bool bo
 }
 
 void BankManager::deallocate_buffer(uint64_t address) {
+    for (auto arena = this->arenas_.rbegin(); arena != this->arenas_.rend(); arena++) {
+        if (arena->contains(address)) {
+            arena->deallocate(address);
+            return;
+        }
+    }
+    for (auto arena = this->retired_arenas_.begin(); arena != this->retired_arenas_.end(); arena++) {
+        if (arena->contains(address)) {
+            arena->deallocate(address);
+            if (arena->num_live_allocations() == 0) {
+                this->allocator_->deallocate(arena->base_address());
+                this->allocated_buffers_.erase(arena->base_address());
+                this->retired_arenas_.erase(arena);
+            }
+            return;
+        }
+    }
     this->allocator_->deallocate(address);
 }
 
 void BankManager::deallocate_all(){
+    // Arena reservations are tracked with the other buffers and freed with them
+    this->arenas_.clear();
+    this->retired_arenas_.clear();
     for (uint64_t addr : this->allocated_buffers_)
     {
         this->allocator_->deallocate(addr);
@@ -112,6 +154,8 @@ void BankManager::deallocate_all(){
 
 
 void BankManager::clear() {
+    this->arenas_.clear();
+    this->retired_arenas_.clear();
     this->allocator_->clear();
 }
 
@@ -128,6 +172,8 @@ BankManager&& BankManager::operator=(BankManager&& that) {
     bank_id_to_bank_offset_ = that.bank_id_to_bank_offset_;
     allocator_.reset( that.allocator_.release() );
     interleaved_address_limit_ = that.interleaved_address_limit_;
+    arenas_ = std::move(that.arenas_);
+    retired_arenas_ = std::move(that.retired_arenas_);
     return std::move(*this);
 }
 
@@ -144,10 +190,78 @@ Statistics BankManager::get_statistics() const {
     return this->allocator_->get_statistics();
 }
 
+std::vector<MemoryBlock> BankManager::get_blocks() const {
+    return this->allocator_->get_blocks();
+}
+
 void BankManager::dump_blocks(std::ofstream &out) const {
     this->allocator_->dump_blocks(out);
 }
 
+void BankManager::relocate_buffer(uint64_t address, uint64_t new_address, uint64_t size_bytes) {
+    TT_FATAL(this->allocated_buffers_.find(address) != this->allocated_buffers_.end(), "Cannot relocate {} buffer at {}, it was not allocated", magic_enum::enum_name(this->buffer_type_), address);
+    this->allocator_->deallocate(address);
+    this->allocated_buffers_.erase(address);
+    auto relocated_address = this->allocator_->allocate_at_address(new_address, size_bytes);
+    if (not relocated_address.has_value()) {
+        TT_THROW("Cannot relocate {} B {} buffer from {} to {}, destination is not free", size_bytes, magic_enum::enum_name(this->buffer_type_), address, new_address);
+    }
+    this->allocated_buffers_.insert(new_address);
+}
+
+const Arena &BankManager::push_arena(uint64_t size_per_bank, bool bottom_up) {
+    uint64_t arena_size = this->allocator_->align(size_per_bank);
+    uint64_t address_limit = this->buffer_type_ == BufferType::L1 ? this->interleaved_address_limit_ : 0;
+    // The limit is checked here rather than by the allocator, which throws with the block it found still allocated
+    auto address = this->allocator_->allocate(arena_size, bottom_up, /*address_limit=*/0);
+    if (not address.has_value()) {
+        TT_THROW("Out of Memory: Not enough space to reserve a {} B {} arena in each bank, no free block is large enough", arena_size, magic_enum::enum_name(this->buffer_type_));
+    }
+    if (address.value() < address_limit) {
+        this->allocator_->deallocate(address.value());
+        TT_THROW("Out of Memory: Not enough space to reserve a {} B {} arena in each bank, the free block found is below the interleaved address limit {}", arena_size, magic_enum::enum_name(this->buffer_type_), address_limit);
+    }
+    this->allocated_buffers_.insert(address.value());
+    this->arenas_.emplace_back(address.value(), arena_size, this->min_allocation_size_bytes_, ADDRESS_ALIGNMENT, bottom_up);
+    return this->arenas_.back();
+}
+
+uint64_t BankManager::pop_arena() {
+    TT_FATAL(not this->arenas_.empty(), "No {} arena to pop", magic_enum::enum_name(this->buffer_type_));
+    const auto &arena = this->arenas_.back();
+    if (arena.num_live_allocations() != 0) {
+        TT_THROW("Cannot pop {} arena at {}, {} buffers allocated from it are still alive", magic_enum::enum_name(this->buffer_type_), arena.base_address(), arena.num_live_allocations());
+    }
+    uint64_t address = arena.base_address();
+    this->allocator_->deallocate(address);
+    this->allocated_buffers_.erase(address);
+    this->arenas_.pop_back();
+    return address;
+}
+
+std::optional<uint64_t> BankManager::release_arena() {
+    TT_FATAL(not this->arenas_.empty(), "No {} arena to release", magic_enum::enum_name(this->buffer_type_));
+    if (this->arenas_.back().num_live_allocations() == 0) {
+        return this->pop_arena();
+    }
+    this->retired_arenas_.push_back(std::move(this->arenas_.back()));
+    this->arenas_.pop_back();
+    return std::nullopt;
+}
+
+uint32_t BankManager::num_arenas() const {
+    return this->arenas_.size() + this->retired_arenas_.size();
+}
+
+TraceBankConfig BankManager::get_trace_bank_config() const {
+    return TraceBankConfig{
+        .buffer_type = std::string(magic_enum::enum_name(this->buffer_type_)),
+        .num_banks = this->num_banks(),
+        .bank_size_bytes = this->allocator_->max_size_bytes(),
+        .offset_bytes = this->allocator_->offset_bytes(),
+        .interleaved_address_limit = this->interleaved_address_limit_};
+}
+
 void init_one_bank_per_channel(Allocator &allocator, const AllocatorConfig &alloc_config) {
     // Space up to DRAM_UNRESERVED_BASE is reserved for DRAM write barrier
     uint64_t offset_bytes = static_cast<uint64_t>(DRAM_UNRESERVED_BASE);
@@ -260,6 +374,111 @@ void dump_memory_blocks(const Allocator &allocator, const BufferType &buffer_typ
     }
 }
 
+std::vector<MemoryBlock> get_memory_blocks(const Allocator &allocator, const BufferType &buffer_type) {
+    switch (buffer_type) {
+        case BufferType::DRAM: return allocator.dram_manager.get_blocks();
+        case BufferType::L1: return allocator.l1_manager.get_blocks();
+        default: {
+            TT_THROW("Unsupported buffer type!");
+        }
+    }
+    return {};
+}
+
+void relocate_buffer(Allocator &allocator, const BufferType &buffer_type, uint64_t address, uint64_t new_address, uint64_t size_bytes) {
+    switch (buffer_type) {
+        case BufferType::DRAM:
+            allocator.dram_manager.relocate_buffer(address, new_address, size_bytes);
+        break;
+        case BufferType::L1:
+            allocator.l1_manager.relocate_buffer(address, new_address, size_bytes);
+        break;
+        default: {
+            TT_THROW("Unsupported buffer type!");
+        }
+    }
+    if (allocator.trace_recorder != nullptr) {
+        allocator.trace_recorder->record_relocate(std::string(magic_enum::enum_name(buffer_type)), address, new_address, size_bytes);
+    }
+}
+
+static BankManager &get_bank_manager(Allocator &allocator, const BufferType &buffer_type) {
+    switch (buffer_type) {
+        case BufferType::DRAM: return allocator.dram_manager;
+        case BufferType::L1: return allocator.l1_manager;
+        default: {
+            TT_THROW("Unsupported buffer type!");
+        }
+    }
+}
+
+void push_arena(Allocator &allocator, const BufferType &buffer_type, uint64_t size_per_bank, bool bottom_up) {
+    auto &bank_manager = get_bank_manager(allocator, buffer_type);
+    if (allocator.trace_recorder == nullptr) {
+        bank_manager.push_arena(size_per_bank, bottom_up);
+        return;
+    }
+
+    // The reservation is recorded as an interleaved buffer with one page in each bank, so replay reserves it from the
+    // general allocator like the bank manager did, and then bump allocates the buffers that follow from it
+    std::string buffer_type_name(magic_enum::enum_name(buffer_type));
+    uint64_t num_banks = bank_manager.num_banks();
+    uint64_t arena_size = round_up(size_per_bank, ADDRESS_ALIGNMENT);
+    std::optional<uint64_t> address;
+    try {
+        address = bank_manager.push_arena(size_per_bank, bottom_up).base_address();
+    } catch (...) {
+        allocator.trace_recorder->record_allocate(buffer_type_name, arena_size * num_banks, arena_size, bottom_up, std::nullopt, std::nullopt);
+        throw;
+    }
+    allocator.trace_recorder->record_allocate(buffer_type_name, arena_size * num_banks, arena_size, bottom_up, std::nullopt, address);
+    allocator.trace_recorder->record_push_arena(buffer_type_name, address.value(), arena_size, bottom_up);
+}
+
+void pop_arena(Allocator &allocator, const BufferType &buffer_type) {
+    uint64_t address = get_bank_manager(allocator, buffer_type).pop_arena();
+    if (allocator.trace_recorder != nullptr) {
+        std::string buffer_type_name(magic_enum::enum_name(buffer_type));
+        allocator.trace_recorder->record_pop_arena(buffer_type_name);
+        allocator.trace_recorder->record_deallocate(buffer_type_name, address);
+    }
+}
+
+bool release_arena(Allocator &allocator, const BufferType &buffer_type) {
+    auto address = get_bank_manager(allocator, buffer_type).release_arena();
+    if (allocator.trace_recorder != nullptr) {
+        std::string buffer_type_name(magic_enum::enum_name(buffer_type));
+        if (address.has_value()) {
+            allocator.trace_recorder->record_pop_arena(buffer_type_name);
+            allocator.trace_recorder->record_deallocate(buffer_type_name, address.value());
+        } else {
+            allocator.trace_recorder->record_retire_arena(buffer_type_name);
+        }
+    }
+    return address.has_value();
+}
+
+uint32_t num_arenas(const Allocator &allocator, const BufferType &buffer_type) {
+    switch (buffer_type) {
+        case BufferType::DRAM: return allocator.dram_manager.num_arenas();
+        case BufferType::L1: return allocator.l1_manager.num_arenas();
+        default: {
+            TT_THROW("Unsupported buffer type!");
+        }
+    }
+    return 0;
+}
+
+void start_trace(Allocator &allocator, const std::string &file_name) {
+    allocator.trace_recorder = std::make_unique<TraceRecorder>(file_name);
+    allocator.trace_recorder->record_bank(allocator.dram_manager.get_trace_bank_config());
+    allocator.trace_recorder->record_bank(allocator.l1_manager.get_trace_bank_config());
+}
+
+void stop_trace(Allocator &allocator) {
+    allocator.trace_recorder.reset();
+}
+
 std::optional<uint64_t> lowest_occupied_l1_address(const Allocator &allocator, uint32_t bank_id) {
     return allocator.l1_manager.lowest_occupied_address(bank_id);
 }
@@ -269,14 +488,31 @@ uint64_t base_alloc(const AllocatorConfig &config, BankManager &bank_manager, ui
 }
 
 uint64_t allocate_buffer(Allocator &allocator, uint32_t size, uint32_t page_size, const BufferType &buffer_type, bool bottom_up, std::optional<uint32_t> num_shards) {
-    uint64_t address = 0;
-    switch (buffer_type) {
-        case BufferType::DRAM: return allocator.descriptor.dram.alloc(allocator.config, allocator.dram_manager, size, page_size, bottom_up, std::nullopt);
-        case BufferType::L1: return allocator.descriptor.l1.alloc(allocator.config, allocator.l1_manager, size, page_size, bottom_up, num_shards);
-        default: {
-            TT_THROW("Unsupported buffer type!");
+    auto allocate = [&]() -> uint64_t {
+        switch (buffer_type) {
+            case BufferType::DRAM: return allocator.descriptor.dram.alloc(allocator.config, allocator.dram_manager, size, page_size, bottom_up, std::nullopt);
+            case BufferType::L1: return allocator.descriptor.l1.alloc(allocator.config, allocator.l1_manager, size, page_size, bottom_up, num_shards);
+            default: {
+                TT_THROW("Unsupported buffer type!");
+            }
         }
+        return 0;
+    };
+    if (allocator.trace_recorder == nullptr) {
+        return allocate();
     }
+
+    std::string buffer_type_name(magic_enum::enum_name(buffer_type));
+    // DRAM buffers are always interleaved, even if num_shards is passed in
+    std::optional<uint32_t> traced_num_shards = buffer_type == BufferType::DRAM ? std::nullopt : num_shards;
+    uint64_t address = 0;
+    try {
+        address = allocate();
+    } catch (...) {
+        allocator.trace_recorder->record_allocate(buffer_type_name, size, page_size, bottom_up, traced_num_shards, std::nullopt);
+        throw;
+    }
+    allocator.trace_recorder->record_allocate(buffer_type_name, size, page_size, bottom_up, traced_num_shards, address);
     return address;
 }
 
@@ -292,11 +528,17 @@ void deallocate_buffer(Allocator &allocator, uint64_t address, const BufferType
             TT_THROW("Unsupported buffer type!");
         }
     }
+    if (allocator.trace_recorder != nullptr) {
+        allocator.trace_recorder->record_deallocate(std::string(magic_enum::enum_name(buffer_type)), address);
+    }
 }
 
 void deallocate_buffers(Allocator &allocator) {
     allocator.dram_manager.deallocate_all();
     allocator.l1_manager.deallocate_all();
+    if (allocator.trace_recorder != nullptr) {
+        allocator.trace_recorder->record_deallocate_all();
+    }
 }
 
 void clear(Allocator &allocator) {
@@ -13,6 +13,8 @@
 #include "common/assert.hpp"
 #include "common/core_coord.h"
 #include "tt_metal/impl/allocator/algorithms/allocator_algorithm.hpp"
+#include "tt_metal/impl/allocator/allocator_trace.hpp"
+#include "tt_metal/impl/allocator/arena.hpp"
 
 namespace tt {
 
@@ -49,8 +51,31 @@ class BankManager {
 
     Statistics get_statistics() const;
 
+    std::vector<MemoryBlock> get_blocks() const;
+
     void dump_blocks(std::ofstream &out) const;
 
+    // Moves the allocation of size_bytes at address to new_address, which must be free once address is released
+    void relocate_buffer(uint64_t address, uint64_t new_address, uint64_t size_bytes);
+
+    TraceBankConfig get_trace_bank_config() const;
+
+    // Reserves size_per_bank bytes from the general allocator. Until the arena is popped, buffers placed in the arena's
+    // direction are bump allocated from it and only fall back to the general allocator once it is full. Arenas nest.
+    // The reservation is tracked like a buffer, deallocate_all frees it
+    const Arena &push_arena(uint64_t size_per_bank, bool bottom_up);
+
+    // Hands the most recently pushed arena back to the general allocator and returns the address it was reserved at.
+    // Every buffer allocated from it must have been deallocated
+    uint64_t pop_arena();
+
+    // Like pop_arena, but an arena with buffers still alive is retired instead: it takes no more allocations and its
+    // reservation is handed back once its last buffer is deallocated. Returns the address if it was handed back now
+    std::optional<uint64_t> release_arena();
+
+    // Pushed and retired arenas
+    uint32_t num_arenas() const;
+
    private:
     constexpr static uint32_t min_allocation_size_bytes_ = 32;
 
@@ -62,6 +87,10 @@ class BankManager {
     std::unordered_map<uint32_t, int64_t> bank_id_to_bank_offset_;
     std::unique_ptr<Algorithm> allocator_;
     uint64_t interleaved_address_limit_;
+    // Active arenas, the last one is used for allocations
+    std::vector<Arena> arenas_;
+    // Released while buffers allocated from them were alive, freed with their last buffer
+    std::vector<Arena> retired_arenas_;
     void validate_bank_id(uint32_t bank_id) const;
 
     void init_allocator(uint64_t size_bytes, uint64_t offset);
@@ -92,6 +121,24 @@ Statistics get_statistics(const Allocator &allocator, const BufferType &buffer_t
 
 void dump_memory_blocks(const Allocator &allocator, const BufferType &buffer_type, std::ofstream &out);
 
+std::vector<MemoryBlock> get_memory_blocks(const Allocator &allocator, const BufferType &buffer_type);
+
+void relocate_buffer(Allocator &allocator, const BufferType &buffer_type, uint64_t address, uint64_t new_address, uint64_t size_bytes);
+
+void push_arena(Allocator &allocator, const BufferType &buffer_type, uint64_t size_per_bank, bool bottom_up);
+
+void pop_arena(Allocator &allocator, const BufferType &buffer_type);
+
+// Returns false if the arena was retired, see BankManager::release_arena
+bool release_arena(Allocator &allocator, const BufferType &buffer_type);
+
+uint32_t num_arenas(const Allocator &allocator, const BufferType &buffer_type);
+
+// Records every allocate and deallocate on the allocator to file_name until stop_trace is called, see allocator_trace.hpp
+void start_trace(Allocator &allocator, const std::string &file_name);
+
+void stop_trace(Allocator &allocator);
+
 std::optional<uint64_t> lowest_occupied_l1_address(const Allocator &allocator, uint32_t bank_id);
 
 uint64_t base_alloc(const AllocatorConfig & config, BankManager &bank_manager, uint64_t size, uint64_t page_size, bool bottom_up, std::optional<uint32_t> num_shards);
@@ -121,6 +168,8 @@ struct Allocator {
     AllocatorConfig config;
     // Callbacks to invoke during initialization and allocation
     allocator::AllocDescriptor descriptor;
+    // Set while allocations are being traced
+    std::unique_ptr<allocator::TraceRecorder> trace_recorder;
 
     void reset();
     ~Allocator();
@@ -0,0 +1,389 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tt_metal/impl/allocator/allocator_trace.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <sstream>
+
+#include "common/assert.hpp"
+#include "hostdevcommon/common_values.hpp"
+#include "tt_metal/detail/util.hpp"
+#include "tt_metal/impl/allocator/arena.hpp"
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace allocator {
+
+namespace {
+
+thread_local std::string trace_tag = "";
+
+std::string sanitize_tag(const std::string &tag) {
+    if (tag.empty()) {
+        return "-";
+    }
+    std::string sanitized = tag;
+    std::replace_if(sanitized.begin(), sanitized.end(), [](char c) { return std::isspace(static_cast<unsigned char>(c)); }, '_');
+    return sanitized;
+}
+
+int64_t optional_to_int(std::optional<uint64_t> value) {
+    return value.has_value() ? static_cast<int64_t>(value.value()) : -1;
+}
+
+}  // namespace
+
+TraceRecorder::TraceRecorder(const std::string &file_name) : file_name_(file_name), out_(file_name) {
+    TT_FATAL(this->out_.is_open(), "Cannot open allocator trace file {}", file_name);
+}
+
+void TraceRecorder::record_bank(const TraceBankConfig &bank) {
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->out_ << "bank " << bank.buffer_type << " " << bank.num_banks << " " << bank.bank_size_bytes << " " << bank.offset_bytes << " " << bank.interleaved_address_limit << "\n";
+}
+
+void TraceRecorder::record_allocate(const std::string &buffer_type, uint64_t size_bytes, uint64_t page_size_bytes, bool bottom_up, std::optional<uint32_t> num_shards, std::optional<uint64_t> address) {
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->out_ << "alloc " << buffer_type << " " << size_bytes << " " << page_size_bytes << " " << bottom_up << " "
+               << (num_shards.has_value() ? static_cast<int64_t>(num_shards.value()) : -1) << " " << optional_to_int(address) << " "
+               << sanitize_tag(trace_tag) << "\n";
+    if (not address.has_value()) {
+        // Out of memory usually ends the run, make sure the allocation that failed is on disk
+        this->out_.flush();
+    }
+}
+
+void TraceRecorder::record_deallocate(const std::string &buffer_type, uint64_t address) {
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->out_ << "free " << buffer_type << " " << address << "\n";
+}
+
+void TraceRecorder::record_relocate(const std::string &buffer_type, uint64_t address, uint64_t new_address, uint64_t size_bytes) {
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->out_ << "relocate " << buffer_type << " " << address << " " << new_address << " " << size_bytes << "\n";
+}
+
+void TraceRecorder::record_push_arena(const std::string &buffer_type, uint64_t address, uint64_t size_bytes, bool bottom_up) {
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->out_ << "arena " << buffer_type << " " << address << " " << size_bytes << " " << bottom_up << "\n";
+}
+
+void TraceRecorder::record_pop_arena(const std::string &buffer_type) {
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->out_ << "arena_pop " << buffer_type << "\n";
+}
+
+void TraceRecorder::record_retire_arena(const std::string &buffer_type) {
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->out_ << "arena_retire " << buffer_type << "\n";
+}
+
+void TraceRecorder::record_deallocate_all() {
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    this->out_ << "free_all\n";
+    this->out_.flush();
+}
+
+ScopedTraceTag::ScopedTraceTag(const std::string &tag) : previous_tag_(std::move(trace_tag)) {
+    trace_tag = tag;
+}
+
+ScopedTraceTag::~ScopedTraceTag() {
+    trace_tag = std::move(this->previous_tag_);
+}
+
+const std::string &current_trace_tag() {
+    return trace_tag;
+}
+
+AllocatorTrace read_trace(const std::string &file_name) {
+    std::ifstream in(file_name);
+    TT_FATAL(in.is_open(), "Cannot open allocator trace file {}", file_name);
+
+    AllocatorTrace trace;
+    std::string line;
+    uint32_t line_number = 0;
+    while (std::getline(in, line)) {
+        line_number++;
+        if (line.empty()) {
+            continue;
+        }
+        std::istringstream record(line);
+        std::string kind;
+        record >> kind;
+        bool valid = true;
+        if (kind == "bank") {
+            TraceBankConfig bank;
+            valid = static_cast<bool>(record >> bank.buffer_type >> bank.num_banks >> bank.bank_size_bytes >> bank.offset_bytes >> bank.interleaved_address_limit);
+            trace.banks.push_back(bank);
+        } else if (kind == "alloc") {
+            TraceEvent event{.type = TraceEvent::Type::ALLOCATE};
+            int64_t num_shards = -1, address = -1;
+            valid = static_cast<bool>(record >> event.buffer_type >> event.size_bytes >> event.page_size_bytes >> event.bottom_up >> num_shards >> address >> event.tag);
+            if (num_shards >= 0) {
+                event.num_shards = static_cast<uint32_t>(num_shards);
+            }
+            if (address >= 0) {
+                event.address = static_cast<uint64_t>(address);
+            }
+            trace.events.push_back(event);
+        } else if (kind == "free") {
+            TraceEvent event{.type = TraceEvent::Type::DEALLOCATE};
+            uint64_t address;
+            valid = static_cast<bool>(record >> event.buffer_type >> address);
+            event.address = address;
+            trace.events.push_back(event);
+        } else if (kind == "relocate") {
+            TraceEvent event{.type = TraceEvent::Type::RELOCATE};
+            uint64_t address;
+            valid = static_cast<bool>(record >> event.buffer_type >> address >> event.new_address >> event.size_bytes);
+            event.address = address;
+            trace.events.push_back(event);
+        } else if (kind == "arena") {
+            TraceEvent event{.type = TraceEvent::Type::PUSH_ARENA};
+            uint64_t address;
+            valid = static_cast<bool>(record >> event.buffer_type >> address >> event.size_bytes >> event.bottom_up);
+            event.address = address;
+            trace.events.push_back(event);
+        } else if (kind == "arena_pop") {
+            TraceEvent event{.type = TraceEvent::Type::POP_ARENA};
+            valid = static_cast<bool>(record >> event.buffer_type);
+            trace.events.push_back(event);
+        } else if (kind == "arena_retire") {
+            TraceEvent event{.type = TraceEvent::Type::RETIRE_ARENA};
+            valid = static_cast<bool>(record >> event.buffer_type);
+            trace.events.push_back(event);
+        } else if (kind == "free_all") {
+            trace.events.push_back(TraceEvent{.type = TraceEvent::Type::DEALLOCATE_ALL});
+        } else {
+            valid = false;
+        }
+        if (not valid) {
+            TT_THROW("Malformed record on line {} of allocator trace {}: {}", line_number, file_name, line);
+        }
+    }
+    return trace;
+}
+
+std::vector<ReplayStatistics> replay_trace(
+    const AllocatorTrace &trace, const AlgorithmFactory &make_algorithm, const std::vector<TraceBankConfig> &bank_overrides) {
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+    using std::chrono::steady_clock;
+
+    // Buffers allocated from an arena can start at the recorded address of its reservation, so the reservation is kept
+    // out of live_buffers while the arena is pushed
+    struct ReplayedArena {
+        uint64_t recorded_address;
+        std::optional<uint64_t> replayed_address;   // nullopt if the reservation ran out of memory during replay
+        std::optional<Arena> arena;
+    };
+
+    struct ReplayedBank {
+        TraceBankConfig config;
+        std::unique_ptr<Algorithm> algorithm;
+        // Recorded address to replayed address of every live buffer
+        std::unordered_map<uint64_t, uint64_t> live_buffers;
+        std::vector<ReplayedArena> arenas;
+        // Popped with buffers still alive, the reservation is freed with the last of them
+        std::vector<ReplayedArena> retired_arenas;
+        ReplayStatistics stats;
+        uint64_t total_allocate_ns = 0;
+        uint64_t total_deallocate_ns = 0;
+        uint32_t num_deallocations = 0;
+    };
+
+    std::vector<ReplayedBank> banks;
+    for (const auto &recorded_config : trace.banks) {
+        ReplayedBank bank;
+        bank.config = recorded_config;
+        for (const auto &override_config : bank_overrides) {
+            if (override_config.buffer_type == recorded_config.buffer_type) {
+                bank.config = override_config;
+            }
+        }
+        bank.algorithm = make_algorithm(bank.config);
+        bank.stats.buffer_type = bank.config.buffer_type;
+        banks.push_back(std::move(bank));
+    }
+    auto find_bank = [&banks](const std::string &buffer_type) -> ReplayedBank & {
+        for (auto &bank : banks) {
+            if (bank.config.buffer_type == buffer_type) {
+                return bank;
+            }
+        }
+        TT_THROW("Allocator trace has no bank record for buffer type {}", buffer_type);
+    };
+
+    for (const auto &event : trace.events) {
+        switch (event.type) {
+            case TraceEvent::Type::ALLOCATE: {
+                auto &bank = find_bank(event.buffer_type);
+                bank.stats.num_allocations++;
+                if (not event.address.has_value()) {
+                    bank.stats.num_recorded_failed_allocations++;
+                }
+                uint32_t num_banks = event.num_shards.value_or(bank.config.num_banks);
+                uint64_t size_per_bank = detail::SizeBytesPerBank(event.size_bytes, event.page_size_bytes, num_banks);
+                uint64_t address_limit = event.num_shards.has_value() ? 0 : bank.config.interleaved_address_limit;
+
+                std::optional<uint64_t> address;
+                auto begin = steady_clock::now();
+                if (not bank.arenas.empty() and bank.arenas.back().arena.has_value() and bank.arenas.back().arena->bottom_up() == event.bottom_up) {
+                    // Like the bank manager, fall back to the algorithm once the arena is full
+                    address = bank.arenas.back().arena->allocate(size_per_bank);
+                }
+                try {
+                    if (not address.has_value()) {
+                        address = bank.algorithm->allocate(size_per_bank, event.bottom_up, address_limit);
+                    }
+                } catch (const std::exception &) {
+                    // Allocating past the interleaved address limit throws, which the bank manager reports as out of memory
+                    address = std::nullopt;
+                }
+                uint64_t elapsed_ns = duration_cast<nanoseconds>(steady_clock::now() - begin).count();
+                bank.total_allocate_ns += elapsed_ns;
+                bank.stats.max_allocate_ns = std::max(bank.stats.max_allocate_ns, elapsed_ns);
+
+                if (not address.has_value()) {
+                    bank.stats.num_failed_allocations++;
+                    bank.stats.failed_allocations_by_tag[event.tag]++;
+                    break;
+                }
+                if (event.address.has_value()) {
+                    bank.live_buffers[event.address.value()] = address.value();
+                    if (address.value() != event.address.value()) {
+                        bank.stats.num_address_mismatches++;
+                    }
+                }
+                // Allocations that failed when recorded are never freed by the trace, they stay live to the end of replay
+
+                auto allocation_stats = bank.algorithm->get_statistics();
+                if (allocation_stats.total_allocated_bytes > bank.stats.peak_allocated_bytes) {
+                    bank.stats.peak_allocated_bytes = allocation_stats.total_allocated_bytes;
+                    bank.stats.largest_free_block_bytes_at_peak = allocation_stats.largest_free_block_bytes;
+                }
+                if (allocation_stats.total_free_bytes > 0) {
+                    double fragmentation = 1.0 - (double)allocation_stats.largest_free_block_bytes / allocation_stats.total_free_bytes;
+                    bank.stats.max_fragmentation = std::max(bank.stats.max_fragmentation, fragmentation);
+                }
+            } break;
+            case TraceEvent::Type::DEALLOCATE: {
+                auto &bank = find_bank(event.buffer_type);
+                auto live_buffer = bank.live_buffers.find(event.address.value());
+                if (live_buffer == bank.live_buffers.end()) {
+                    // Allocation failed during replay
+                    break;
+                }
+                auto begin = steady_clock::now();
+                auto in_arena = [&live_buffer](const ReplayedArena &replayed_arena) {
+                    return replayed_arena.arena.has_value() and replayed_arena.arena->contains(live_buffer->second);
+                };
+                auto arena = std::find_if(bank.arenas.rbegin(), bank.arenas.rend(), in_arena);
+                auto retired_arena = std::find_if(bank.retired_arenas.begin(), bank.retired_arenas.end(), in_arena);
+                if (arena != bank.arenas.rend()) {
+                    arena->arena->deallocate(live_buffer->second);
+                } else if (retired_arena != bank.retired_arenas.end()) {
+                    retired_arena->arena->deallocate(live_buffer->second);
+                    if (retired_arena->arena->num_live_allocations() == 0) {
+                        bank.algorithm->deallocate(retired_arena->replayed_address.value());
+                        bank.retired_arenas.erase(retired_arena);
+                    }
+                } else {
+                    bank.algorithm->deallocate(live_buffer->second);
+                }
+                bank.total_deallocate_ns += duration_cast<nanoseconds>(steady_clock::now() - begin).count();
+                bank.num_deallocations++;
+                bank.live_buffers.erase(live_buffer);
+            } break;
+            case TraceEvent::Type::RELOCATE: {
+                // Compaction moved the buffer when recorded. Replay keeps it in place and only follows the new address
+                auto &bank = find_bank(event.buffer_type);
+                auto live_buffer = bank.live_buffers.find(event.address.value());
+                if (live_buffer != bank.live_buffers.end()) {
+                    uint64_t replayed_address = live_buffer->second;
+                    bank.live_buffers.erase(live_buffer);
+                    bank.live_buffers[event.new_address] = replayed_address;
+                }
+            } break;
+            case TraceEvent::Type::PUSH_ARENA: {
+                auto &bank = find_bank(event.buffer_type);
+                ReplayedArena replayed_arena{.recorded_address = event.address.value()};
+                auto reservation = bank.live_buffers.find(event.address.value());
+                if (reservation != bank.live_buffers.end()) {
+                    replayed_arena.replayed_address = reservation->second;
+                    // Bank managers allocate at least ADDRESS_ALIGNMENT bytes
+                    replayed_arena.arena.emplace(reservation->second, event.size_bytes, /*min_allocation_size=*/ADDRESS_ALIGNMENT, ADDRESS_ALIGNMENT, event.bottom_up);
+                    bank.live_buffers.erase(reservation);
+                }
+                bank.arenas.push_back(std::move(replayed_arena));
+            } break;
+            case TraceEvent::Type::POP_ARENA:
+            case TraceEvent::Type::RETIRE_ARENA: {
+                auto &bank = find_bank(event.buffer_type);
+                TT_FATAL(not bank.arenas.empty(), "Allocator trace pops a {} arena that was not pushed", event.buffer_type);
+                auto replayed_arena = std::move(bank.arenas.back());
+                bank.arenas.pop_back();
+                if (replayed_arena.arena.has_value() and replayed_arena.arena->num_live_allocations() > 0) {
+                    // Buffers replayed into the arena are still alive, even if the recorded arena was empty when popped.
+                    // The free record of the reservation that may follow is then skipped like that of a failed allocation
+                    bank.retired_arenas.push_back(std::move(replayed_arena));
+                } else if (replayed_arena.replayed_address.has_value()) {
+                    if (event.type == TraceEvent::Type::POP_ARENA) {
+                        // Hand the reservation back to live_buffers for the free record that follows
+                        bank.live_buffers[replayed_arena.recorded_address] = replayed_arena.replayed_address.value();
+                    } else {
+                        bank.algorithm->deallocate(replayed_arena.replayed_address.value());
+                    }
+                }
+            } break;
+            case TraceEvent::Type::DEALLOCATE_ALL: {
+                for (auto &bank : banks) {
+                    for (const auto &[recorded_address, replayed_address] : bank.live_buffers) {
+                        auto in_arena = [replayed_address = replayed_address](const ReplayedArena &replayed_arena) {
+                            return replayed_arena.arena.has_value() and replayed_arena.arena->contains(replayed_address);
+                        };
+                        if (std::none_of(bank.arenas.begin(), bank.arenas.end(), in_arena) and
+                            std::none_of(bank.retired_arenas.begin(), bank.retired_arenas.end(), in_arena)) {
+                            bank.algorithm->deallocate(replayed_address);
+                        }
+                    }
+                    for (const auto *arenas : {&bank.arenas, &bank.retired_arenas}) {
+                        for (const auto &replayed_arena : *arenas) {
+                            if (replayed_arena.replayed_address.has_value()) {
+                                bank.algorithm->deallocate(replayed_arena.replayed_address.value());
+                            }
+                        }
+                    }
+                    bank.live_buffers.clear();
+                    bank.arenas.clear();
+                    bank.retired_arenas.clear();
+                }
+            } break;
+        }
+    }
+
+    std::vector<ReplayStatistics> replay_stats;
+    for (auto &bank : banks) {
+        if (bank.stats.num_allocations > 0) {
+            bank.stats.mean_allocate_ns = (double)bank.total_allocate_ns / bank.stats.num_allocations;
+        }
+        if (bank.num_deallocations > 0) {
+            bank.stats.mean_deallocate_ns = (double)bank.total_deallocate_ns / bank.num_deallocations;
+        }
+        replay_stats.push_back(std::move(bank.stats));
+    }
+    return replay_stats;
+}
+
+}  // namespace allocator
+
+}  // namespace tt_metal
+
+}  // namespace tt
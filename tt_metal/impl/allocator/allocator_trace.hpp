@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "tt_metal/impl/allocator/algorithms/allocator_algorithm.hpp"
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace allocator {
+
+// Allocator traces are text files with one record per line, so they can be grepped and diffed:
+//   bank <buffer type> <num banks> <bank size> <offset> <interleaved address limit>
+//   alloc <buffer type> <size> <page size> <bottom up> <num shards or -1> <address or -1 if out of memory> <tag>
+//   free <buffer type> <address>
+//   relocate <buffer type> <address> <new address> <size per bank>
+//   arena <buffer type> <address> <size per bank> <bottom up>
+//   arena_pop <buffer type>
+//   arena_retire <buffer type>
+//   free_all
+// Addresses are relative to bank. Bank records come first and describe the bank managers the trace was recorded on.
+// An arena record follows the alloc record of the reservation it turns into an arena, and an arena_pop record precedes
+// the free record of that reservation. An arena released while buffers allocated from it are alive is retired instead,
+// and its reservation is freed without a record along with its last buffer.
+
+struct TraceBankConfig {
+    std::string buffer_type;
+    uint32_t num_banks = 0;
+    uint64_t bank_size_bytes = 0;
+    uint64_t offset_bytes = 0;
+    uint64_t interleaved_address_limit = 0;     // 0 if interleaved buffers are not limited
+};
+
+struct TraceEvent {
+    enum class Type {
+        ALLOCATE = 0,
+        DEALLOCATE = 1,
+        RELOCATE = 2,
+        DEALLOCATE_ALL = 3,
+        PUSH_ARENA = 4,
+        POP_ARENA = 5,
+        RETIRE_ARENA = 6,
+    };
+
+    Type type;
+    std::string buffer_type;
+    uint64_t size_bytes = 0;
+    uint64_t page_size_bytes = 0;
+    bool bottom_up = true;
+    std::optional<uint32_t> num_shards = std::nullopt;
+    std::optional<uint64_t> address = std::nullopt;     // nullopt for allocations that ran out of memory
+    uint64_t new_address = 0;
+    std::string tag;
+};
+
+struct AllocatorTrace {
+    std::vector<TraceBankConfig> banks;
+    std::vector<TraceEvent> events;
+};
+
+// Appends allocator trace records to a file. Safe to call from multiple threads.
+class TraceRecorder {
+   public:
+    explicit TraceRecorder(const std::string &file_name);
+
+    const std::string &file_name() const { return file_name_; }
+
+    void record_bank(const TraceBankConfig &bank);
+
+    void record_allocate(const std::string &buffer_type, uint64_t size_bytes, uint64_t page_size_bytes, bool bottom_up, std::optional<uint32_t> num_shards, std::optional<uint64_t> address);
+
+    void record_deallocate(const std::string &buffer_type, uint64_t address);
+
+    void record_relocate(const std::string &buffer_type, uint64_t address, uint64_t new_address, uint64_t size_bytes);
+
+    void record_push_arena(const std::string &buffer_type, uint64_t address, uint64_t size_bytes, bool bottom_up);
+
+    void record_pop_arena(const std::string &buffer_type);
+
+    void record_retire_arena(const std::string &buffer_type);
+
+    void record_deallocate_all();
+
+   private:
+    std::string file_name_;
+    std::ofstream out_;
+    std::mutex mutex_;
+};
+
+// Tags every allocation recorded on this thread while in scope, eg. with the name of the op that allocates its outputs.
+// Scopes nest; the innermost tag wins.
+class ScopedTraceTag {
+   public:
+    explicit ScopedTraceTag(const std::string &tag);
+    ~ScopedTraceTag();
+
+    ScopedTraceTag(const ScopedTraceTag &) = delete;
+    ScopedTraceTag &operator=(const ScopedTraceTag &) = delete;
+
+   private:
+    std::string previous_tag_;
+};
+
+const std::string &current_trace_tag();
+
+AllocatorTrace read_trace(const std::string &file_name);
+
+// Creates the algorithm to replay one bank type with, given the bank config to replay with
+using AlgorithmFactory = std::function<std::unique_ptr<Algorithm>(const TraceBankConfig &)>;
+
+struct ReplayStatistics {
+    std::string buffer_type;
+    uint32_t num_allocations = 0;
+    uint32_t num_failed_allocations = 0;        // allocations that ran out of memory during replay
+    uint32_t num_recorded_failed_allocations = 0;  // allocations that ran out of memory when the trace was recorded
+    uint32_t num_address_mismatches = 0;        // allocations placed somewhere else than when the trace was recorded
+    uint64_t peak_allocated_bytes = 0;          // per bank
+    uint64_t largest_free_block_bytes_at_peak = 0;
+    double max_fragmentation = 0.0;             // 1 - largest free block / total free bytes, sampled after every allocation
+    double mean_allocate_ns = 0.0;
+    uint64_t max_allocate_ns = 0;
+    double mean_deallocate_ns = 0.0;
+    // Allocations that ran out of memory during replay, by tag
+    std::unordered_map<std::string, uint32_t> failed_allocations_by_tag;
+};
+
+// Replays the trace against fresh algorithms, one per bank type. bank_overrides replaces the recorded bank config of
+// a buffer type, eg. to evaluate a different number of L1 banks; sizes per bank are recomputed from the recorded
+// buffer and page sizes.
+std::vector<ReplayStatistics> replay_trace(
+    const AllocatorTrace &trace, const AlgorithmFactory &make_algorithm, const std::vector<TraceBankConfig> &bank_overrides = {});
+
+}  // namespace allocator
+
+}  // namespace tt_metal
+
+}  // namespace tt
@@ -80,6 +80,13 @@ struct Statistics {
     std::vector<uint32_t> largest_free_block_addrs;  // addresses (relative to bank) that can hold the largest_free_block_bytes
 };
 
+// One entry of the block map that dump_blocks reports
+struct MemoryBlock {
+    uint64_t address = 0;   // address relative to bank, the same for every bank
+    uint64_t size = 0;
+    bool allocated = false;
+};
+
 }
 
 }
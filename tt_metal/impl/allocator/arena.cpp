@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tt_metal/impl/allocator/arena.hpp"
+#include "common/assert.hpp"
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace allocator {
+
+Arena::Arena(uint64_t base_address, uint64_t size_bytes, uint64_t min_allocation_size, uint64_t alignment, bool bottom_up)
+    : base_address_(base_address),
+      size_bytes_(size_bytes),
+      min_allocation_size_(min_allocation_size),
+      alignment_(alignment),
+      bottom_up_(bottom_up),
+      used_bytes_(0),
+      num_live_allocations_(0) {
+    TT_ASSERT(base_address % alignment == 0 and size_bytes % alignment == 0, "Arena at {} of {} B should be {} B aligned", base_address, size_bytes, alignment);
+}
+
+std::optional<uint64_t> Arena::allocate(uint64_t size_bytes) {
+    uint64_t alloc_size = size_bytes < this->min_allocation_size_ ? this->min_allocation_size_ : size_bytes;
+    alloc_size = ((alloc_size + this->alignment_ - 1) / this->alignment_) * this->alignment_;
+    if (alloc_size > this->size_bytes_ - this->used_bytes_) {
+        return std::nullopt;
+    }
+    uint64_t address = this->bottom_up_ ? this->base_address_ + this->used_bytes_ : this->base_address_ + this->size_bytes_ - this->used_bytes_ - alloc_size;
+    this->used_bytes_ += alloc_size;
+    this->allocation_index_[address] = this->allocations_.size();
+    this->allocations_.push_back({.address = address, .size = alloc_size, .live = true});
+    this->num_live_allocations_++;
+    return address;
+}
+
+void Arena::deallocate(uint64_t address) {
+    auto index = this->allocation_index_.find(address);
+    TT_FATAL(index != this->allocation_index_.end() and this->allocations_.at(index->second).live, "No live allocation at {} in arena at {}", address, this->base_address_);
+    this->allocations_.at(index->second).live = false;
+    this->num_live_allocations_--;
+    // Pop every freed allocation off the top of the stack, space below a live allocation is reclaimed when it is freed
+    while (not this->allocations_.empty() and not this->allocations_.back().live) {
+        this->used_bytes_ -= this->allocations_.back().size;
+        this->allocation_index_.erase(this->allocations_.back().address);
+        this->allocations_.pop_back();
+    }
+}
+
+}  // namespace allocator
+
+}  // namespace tt_metal
+
+}  // namespace tt
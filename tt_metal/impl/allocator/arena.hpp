@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace allocator {
+
+// Bump allocator over a region of a bank that was reserved from the bank's general allocator, for short lived buffers.
+//  - Allocations take O(1) and grow from one end of the region (the bottom if bottom_up) towards the other
+//  - Space is reclaimed as soon as the most recent allocations are freed, like a stack, and all at once when the
+//    region is handed back to the general allocator
+class Arena {
+   public:
+    Arena(uint64_t base_address, uint64_t size_bytes, uint64_t min_allocation_size, uint64_t alignment, bool bottom_up);
+
+    uint64_t base_address() const { return base_address_; }
+
+    uint64_t size_bytes() const { return size_bytes_; }
+
+    uint64_t used_bytes() const { return used_bytes_; }
+
+    uint32_t num_live_allocations() const { return num_live_allocations_; }
+
+    bool bottom_up() const { return bottom_up_; }
+
+    bool contains(uint64_t address) const { return address >= base_address_ and address < base_address_ + size_bytes_; }
+
+    // Returns nullopt if the rest of the region is too small
+    std::optional<uint64_t> allocate(uint64_t size_bytes);
+
+    void deallocate(uint64_t address);
+
+   private:
+    struct Allocation {
+        uint64_t address;
+        uint64_t size;
+        bool live;
+    };
+
+    uint64_t base_address_;
+    uint64_t size_bytes_;
+    uint64_t min_allocation_size_;
+    uint64_t alignment_;
+    bool bottom_up_;
+    uint64_t used_bytes_;
+    uint32_t num_live_allocations_;
+    // Allocations in the order they were made, the last one is at the top of the stack
+    std::vector<Allocation> allocations_;
+    std::unordered_map<uint64_t, uint32_t> allocation_index_;
+};
+
+}  // namespace allocator
+
+}  // namespace tt_metal
+
+}  // namespace tt
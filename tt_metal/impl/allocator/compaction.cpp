@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tt_metal/impl/allocator/compaction.hpp"
+#include "common/assert.hpp"
+
+#include <algorithm>
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace allocator {
+
+namespace {
+
+uint64_t largest_gap(const std::vector<MemoryBlock> &allocated_blocks, uint64_t start_address, uint64_t end_address) {
+    uint64_t largest = 0;
+    uint64_t cursor = start_address;
+    for (const auto &block : allocated_blocks) {
+        largest = std::max(largest, block.address - cursor);
+        cursor = block.address + block.size;
+    }
+    return std::max(largest, end_address - cursor);
+}
+
+}  // namespace
+
+CompactionPlan plan_compaction(const std::vector<MemoryBlock> &blocks, bool bottom_up, const std::unordered_set<uint64_t> &pinned_addresses) {
+    CompactionPlan plan;
+    if (blocks.empty()) {
+        return plan;
+    }
+    const uint64_t start_address = blocks.front().address;
+    const uint64_t end_address = blocks.back().address + blocks.back().size;
+
+    std::vector<MemoryBlock> allocated_blocks;
+    for (const auto &block : blocks) {
+        if (block.allocated) {
+            allocated_blocks.push_back(block);
+        }
+    }
+    plan.largest_free_block_bytes_before = largest_gap(allocated_blocks, start_address, end_address);
+
+    // Walk blocks from the end allocations grow from. The cursor marks where the next movable block is packed against,
+    // and restarts behind every pinned block.
+    std::vector<MemoryBlock> compacted_blocks;
+    compacted_blocks.reserve(allocated_blocks.size());
+    uint64_t cursor = bottom_up ? start_address : end_address;
+    auto place_block = [&](const MemoryBlock &block) {
+        if (pinned_addresses.find(block.address) != pinned_addresses.end()) {
+            cursor = bottom_up ? block.address + block.size : block.address;
+            compacted_blocks.push_back(block);
+            return;
+        }
+        uint64_t dst_address = bottom_up ? cursor : cursor - block.size;
+        TT_ASSERT(bottom_up ? dst_address <= block.address : dst_address >= block.address);
+        if (dst_address != block.address) {
+            plan.relocations.push_back({.src_address = block.address, .dst_address = dst_address, .size_bytes = block.size});
+            plan.bytes_moved += block.size;
+        }
+        cursor = bottom_up ? dst_address + block.size : dst_address;
+        compacted_blocks.push_back({.address = dst_address, .size = block.size, .allocated = true});
+    };
+    if (bottom_up) {
+        std::for_each(allocated_blocks.begin(), allocated_blocks.end(), place_block);
+    } else {
+        std::for_each(allocated_blocks.rbegin(), allocated_blocks.rend(), place_block);
+        std::reverse(compacted_blocks.begin(), compacted_blocks.end());
+    }
+
+    plan.largest_free_block_bytes_after = largest_gap(compacted_blocks, start_address, end_address);
+    return plan;
+}
+
+}  // namespace allocator
+
+}  // namespace tt_metal
+
+}  // namespace tt
@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+#include "tt_metal/impl/allocator/allocator_types.hpp"
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace allocator {
+
+struct BlockRelocation {
+    uint64_t src_address;   // address relative to bank
+    uint64_t dst_address;   // address relative to bank
+    uint64_t size_bytes;
+};
+
+struct CompactionPlan {
+    // Relocations must be applied in order: a relocation may only overwrite space that is free or that earlier
+    // relocations (or its own source) have vacated
+    std::vector<BlockRelocation> relocations;
+    uint64_t bytes_moved = 0;
+    uint64_t largest_free_block_bytes_before = 0;
+    uint64_t largest_free_block_bytes_after = 0;
+};
+
+// Plans sliding allocated blocks towards the end of the bank that allocations grow from (bottom_up=true for DRAM,
+// false for L1) so that all free space between them coalesces into one block at the other end.
+// Blocks at pinned_addresses are never moved; free space only coalesces between consecutive pinned blocks.
+// `blocks` must be the full block map of a bank as returned by Algorithm::get_blocks.
+CompactionPlan plan_compaction(const std::vector<MemoryBlock> &blocks, bool bottom_up, const std::unordered_set<uint64_t> &pinned_addresses = {});
+
+}  // namespace allocator
+
+}  // namespace tt_metal
+
+}  // namespace tt
@@ -215,6 +215,7 @@ Buffer::Buffer(Buffer &&other) : device_(other.device_), size_(other.size_), add
                                     buffer_layout_(other.buffer_layout_), shard_parameters_(other.shard_parameters_) {
     // Set `other.device_` to be nullptr so destroying other does not deallocate reserved address space that is transferred to `this`
     other.device_ = nullptr;
+    this->register_if_l1();
 }
 
 Buffer &Buffer::operator=(Buffer &&other) {
@@ -228,6 +229,7 @@ Buffer &Buffer::operator=(Buffer &&other) {
         this->shard_parameters_ = other.shard_parameters_;
         // Set `other.device_` to be nullptr so destroying other does not deallocate reserved address space that is transferred to `this`
         other.device_ = nullptr;
+        this->register_if_l1();
     }
     return *this;
 }
@@ -244,7 +246,13 @@ void Buffer::allocate() {
     else{
         this->address_ = allocator::allocate_buffer(*this->device_->allocator_, this->size_, this->page_size_, this->buffer_type_, bottom_up, std::nullopt);
     }
+    this->register_if_l1();
+}
 
+void Buffer::register_if_l1() {
+    if (this->device_ != nullptr and this->size_ != 0 and this->buffer_type_ == BufferType::L1) {
+        this->device_->register_l1_buffer(this);
+    }
 }
 
 uint32_t Buffer::dram_channel_from_bank_id(uint32_t bank_id) const {
@@ -311,6 +319,9 @@ void Buffer::deallocate() {
     if (this->device_ == nullptr or not this->device_->initialized_ or this->size_ == 0) {
         return;
     }
+    if (this->buffer_type_ == BufferType::L1) {
+        this->device_->unregister_l1_buffer(this);
+    }
     this->size_ = 0;
     TT_ASSERT(this->device_->allocator_ != nullptr, "Expected allocator to be initialized!");
     allocator::deallocate_buffer(*this->device_->allocator_, this->address_, this->buffer_type_);
@@ -273,8 +273,12 @@ class Buffer {
    private:
     void allocate();
 
+    void register_if_l1();
+
     void deallocate();
     friend void DeallocateBuffer(Buffer &buffer);
+    // Device updates the address of buffers it relocates when compacting L1
+    friend class Device;
 
     Device *device_;
     uint64_t size_;                 // Size in bytes
@@ -3,8 +3,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "tt_metal/impl/device/device.hpp"
+#include "tt_metal/impl/buffers/buffer.hpp"
 #include "tt_metal/common/core_descriptor.hpp"
 #include "tt_metal/hostdevcommon/common_runtime_address_map.h"
+#include "tt_metal/hostdevcommon/profiler_common.h"
 #include "tt_metal/third_party/tracy/public/tracy/Tracy.hpp"
 #include "tt_metal/detail/tt_metal.hpp"
 #include "impl/debug/dprint_server.hpp"
@@ -120,6 +122,11 @@ void Device::initialize_allocator(const std::vector<uint32_t>& l1_bank_remap) {
     // This is the only allocator scheme supported because kernel APIs assume num L1 banks are power of 2
     static_assert(this->allocator_scheme_ == MemoryAllocator::L1_BANKING);
     this->allocator_ = std::make_unique<L1BankingAllocator>(config);
+
+    static const char *allocator_trace_dir = std::getenv("TT_METAL_ALLOCATOR_TRACE_DIR");
+    if (allocator_trace_dir != nullptr) {
+        this->start_allocator_trace(fmt::format("{}/allocator_trace_device_{}.txt", allocator_trace_dir, this->id_));
+    }
 }
 
 void Device::initialize_build() {
@@ -261,6 +268,13 @@ void Device::clear_l1_state() {
 
         llrt::write_hex_vec_to_core(
             this->id(), physical_core, init_erisc_info_vec, eth_l1_mem::address_map::ERISC_APP_SYNC_INFO_BASE);
+
+        // A ring started by a previous process would otherwise keep counting from where it stopped, the profiler
+        // would drain its stale markers as new ones
+        if (llrt::OptionsG.get_profiler_ring_enabled()) {
+            std::vector<uint32_t> profiler_header(kernel_profiler::MARKER_DATA_START, 0);
+            llrt::write_hex_vec_to_core(this->id(), physical_core, profiler_header, eth_l1_mem::address_map::PRINT_BUFFER_ER);
+        }
     }
 }
 
@@ -331,6 +345,7 @@ bool Device::close() {
         TT_THROW("Cannot close device {} that has not been initialized!", this->id_);
     }
     this->deallocate_buffers();
+    detail::DetachDeviceProfilerRing(this);
     llrt::watcher_detach(this);
     DprintServerDetach(this);
 
@@ -350,6 +365,7 @@ bool Device::close() {
     this->clear_l1_state();
     tt::Cluster::instance().l1_barrier(id_);
     allocator::clear(*this->allocator_);
+    allocator::stop_trace(*this->allocator_);
 
     this->active_devices_.deactivate_device(this->id_);
 
@@ -483,8 +499,127 @@ void Device::dump_memory_blocks(const BufferType &buffer_type, std::ofstream &ou
     return allocator::dump_memory_blocks(*this->allocator_, buffer_type, out);
 }
 
+void Device::start_allocator_trace(const std::string &file_name) {
+    this->check_allocator_is_initialized();
+    allocator::start_trace(*this->allocator_, file_name);
+    log_info(tt::LogMetal, "Recording allocator trace for device {} to {}", this->id_, file_name);
+}
+
+void Device::stop_allocator_trace() {
+    this->check_allocator_is_initialized();
+    allocator::stop_trace(*this->allocator_);
+}
+
+void Device::push_l1_arena(uint64_t size_per_bank, bool bottom_up) {
+    this->check_allocator_is_initialized();
+    allocator::push_arena(*this->allocator_, BufferType::L1, size_per_bank, bottom_up);
+}
+
+void Device::pop_l1_arena() {
+    this->check_allocator_is_initialized();
+    allocator::pop_arena(*this->allocator_, BufferType::L1);
+}
+
+bool Device::release_l1_arena() {
+    this->check_allocator_is_initialized();
+    return allocator::release_arena(*this->allocator_, BufferType::L1);
+}
+
+ScopedL1Arena::ScopedL1Arena(Device *device, uint64_t size_per_bank, bool bottom_up) : device_(device) {
+    this->device_->push_l1_arena(size_per_bank, bottom_up);
+}
+
+ScopedL1Arena::~ScopedL1Arena() {
+    // Buffers from the arena that outlive the scope keep it reserved, but enclosing scopes must find their own arenas
+    try {
+        if (not this->device_->release_l1_arena()) {
+            log_warning(LogDevice, "Retiring the L1 arena of device {}, buffers allocated from it outlive its scope", this->device_->id());
+        }
+    } catch (const std::exception &e) {
+        log_error(LogDevice, "Cannot release the L1 arena of device {}: {}", this->device_->id(), e.what());
+    }
+}
+
+void Device::register_l1_buffer(Buffer *buffer) {
+    this->l1_buffers_[buffer->address()] = buffer;
+}
+
+void Device::unregister_l1_buffer(const Buffer *buffer) {
+    auto it = this->l1_buffers_.find(buffer->address());
+    if (it != this->l1_buffers_.end() and it->second == buffer) {
+        this->l1_buffers_.erase(it);
+    }
+}
+
+allocator::CompactionPlan Device::plan_l1_compaction() const {
+    this->check_allocator_is_initialized();
+    // Arenas are single blocks to the allocator, the buffers inside them cannot be moved independently
+    TT_FATAL(allocator::num_arenas(*this->allocator_, BufferType::L1) == 0, "Cannot compact L1 while an L1 arena is pushed or retired");
+    auto blocks = allocator::get_memory_blocks(*this->allocator_, BufferType::L1);
+    std::unordered_set<uint64_t> pinned_addresses;
+    for (const auto &block : blocks) {
+        if (not block.allocated) {
+            continue;
+        }
+        auto it = this->l1_buffers_.find(block.address);
+        if (it == this->l1_buffers_.end() or it->second->address() != block.address) {
+            pinned_addresses.insert(block.address);
+        }
+    }
+    // L1 buffers are allocated top down
+    return allocator::plan_compaction(blocks, /*bottom_up=*/false, pinned_addresses);
+}
+
+allocator::CompactionPlan Device::compact_l1() {
+    ZoneScoped;
+    auto plan = this->plan_l1_compaction();
+    if (plan.relocations.empty()) {
+        return plan;
+    }
+    detail::Synchronize(this);
+
+    // Every bank holds each buffer at the same address, so the plan applies to all of them. Each bank is staged through
+    // host memory once: read the span the plan touches, apply the moves in order, then write the span back.
+    uint64_t span_start = std::numeric_limits<uint64_t>::max();
+    uint64_t span_end = 0;
+    for (const auto &relocation : plan.relocations) {
+        span_start = std::min({span_start, relocation.src_address, relocation.dst_address});
+        span_end = std::max({span_end, relocation.src_address + relocation.size_bytes, relocation.dst_address + relocation.size_bytes});
+    }
+    tt::Cluster::instance().l1_barrier(this->id_);
+    for (uint32_t bank_id = 0; bank_id < this->num_banks(BufferType::L1); bank_id++) {
+        CoreCoord worker_core = this->worker_core_from_logical_core(this->logical_core_from_bank_id(bank_id));
+        uint64_t bank_span_start = span_start + this->l1_bank_offset_from_bank_id(bank_id);
+        std::vector<uint32_t> span = llrt::read_hex_vec_from_core(this->id_, worker_core, bank_span_start, span_end - span_start);
+        auto span_bytes = reinterpret_cast<uint8_t *>(span.data());
+        for (const auto &relocation : plan.relocations) {
+            std::memmove(span_bytes + (relocation.dst_address - span_start), span_bytes + (relocation.src_address - span_start), relocation.size_bytes);
+        }
+        llrt::write_hex_vec_to_core(this->id_, worker_core, span, bank_span_start);
+    }
+    tt::Cluster::instance().l1_barrier(this->id_);
+
+    std::vector<std::pair<Buffer *, uint64_t>> relocated_buffers;
+    for (const auto &relocation : plan.relocations) {
+        allocator::relocate_buffer(*this->allocator_, BufferType::L1, relocation.src_address, relocation.dst_address, relocation.size_bytes);
+        relocated_buffers.push_back({this->l1_buffers_.at(relocation.src_address), relocation.dst_address});
+    }
+    for (const auto &relocation : plan.relocations) {
+        this->l1_buffers_.erase(relocation.src_address);
+    }
+    for (auto &[buffer, address] : relocated_buffers) {
+        buffer->address_ = address;
+        this->l1_buffers_[address] = buffer;
+    }
+
+    log_info(tt::LogMetal, "Compacted L1 of device {}: moved {} B in {} buffers, largest free block grew from {} B to {} B",
+        this->id_, plan.bytes_moved, plan.relocations.size(), plan.largest_free_block_bytes_before, plan.largest_free_block_bytes_after);
+    return plan;
+}
+
 void Device::deallocate_buffers(){
     allocator::deallocate_buffers(*allocator_);
+    this->l1_buffers_.clear();
 }
 
 float Device::sfpu_eps() const {
@@ -9,6 +9,7 @@
 #include "hostdevcommon/common_values.hpp"
 #include "tt_metal/impl/allocator/basic_allocator.hpp"
 #include "tt_metal/impl/allocator/l1_banking_allocator.hpp"
+#include "tt_metal/impl/allocator/compaction.hpp"
 #include "tt_metal/jit_build/build.hpp"
 #include "llrt/tt_cluster.hpp"
 #include "dev_msgs.h"
@@ -142,6 +143,33 @@ class Device {
 
     void dump_memory_blocks(const BufferType &buffer_type, std::ofstream &out) const;
 
+    // Records every buffer allocate and deallocate on this device to file_name, for offline replay with
+    // tt_metal/tools/allocator_replay. Also enabled for all devices by setting TT_METAL_ALLOCATOR_TRACE_DIR
+    void start_allocator_trace(const std::string &file_name);
+
+    void stop_allocator_trace();
+
+    // Plans sliding L1 buffers towards the top of L1 so that free space between them coalesces into one block below
+    // the lowest buffer. L1 blocks that are not owned by a live Buffer are left in place.
+    allocator::CompactionPlan plan_l1_compaction() const;
+
+    // Waits for the device to go idle, moves L1 buffers as planned by plan_l1_compaction and updates their Buffer objects
+    // to the new addresses. Programs read buffer addresses when runtime args are set, so runtime args holding addresses of
+    // relocated buffers must be set again before relaunching those programs.
+    allocator::CompactionPlan compact_l1();
+
+    // Reserves size_per_bank bytes in every L1 bank as an arena for short lived buffers, eg. intermediates of an op.
+    // Until pop_l1_arena is called, L1 buffers allocated on this device are bump allocated from the arena in O(1) and
+    // fall back to the general allocator once it is full. Arenas nest, and every buffer allocated from an arena must be
+    // deallocated before it is popped. See ScopedL1Arena
+    void push_l1_arena(uint64_t size_per_bank, bool bottom_up = false);
+
+    void pop_l1_arena();
+
+    // Like pop_l1_arena, but if buffers allocated from the arena are still alive it is retired instead of throwing: it
+    // takes no more allocations and is released along with the last of them. Returns false if it was retired
+    bool release_l1_arena();
+
     // Set of logical storage only core coordinates
     const std::set<CoreCoord> &storage_only_cores() const { return this->storage_only_cores_; }
 
@@ -182,6 +210,9 @@ class Device {
     void initialize_command_queue();
     void clear_l1_state();
 
+    void register_l1_buffer(Buffer *buffer);
+    void unregister_l1_buffer(const Buffer *buffer);
+
     std::pair<int, int> build_processor_type_to_index(JitBuildProcessorType t) const;
 
     // Puts device into reset
@@ -197,6 +228,8 @@ class Device {
     static ActiveDevices active_devices_;
     chip_id_t id_;
     std::unique_ptr<Allocator> allocator_ = nullptr;
+    // Live L1 buffers by address, so that compacting L1 can update the Buffer objects it moves
+    std::unordered_map<uint64_t, Buffer *> l1_buffers_;
     bool initialized_ = false;
 
     JitBuildEnv build_env_;
@@ -210,6 +243,19 @@ class Device {
     const uint8_t num_hw_cqs_;
 };
 
+// Keeps an L1 arena pushed on device while in scope, see Device::push_l1_arena
+class ScopedL1Arena {
+   public:
+    ScopedL1Arena(Device *device, uint64_t size_per_bank, bool bottom_up = false);
+    ~ScopedL1Arena();
+
+    ScopedL1Arena(const ScopedL1Arena &) = delete;
+    ScopedL1Arena &operator=(const ScopedL1Arena &) = delete;
+
+   private:
+    Device *device_;
+};
+
 }  // namespace tt_metal
 
 }  // namespace tt
@@ -12,6 +12,8 @@
 #include "tt_metal/impl/buffers/semaphore.hpp"
 #include "tt_metal/impl/debug/dprint_server.hpp"
 #include "tt_metal/impl/dispatch/dispatch_core_manager.hpp"
+#include "tt_metal/llrt/rtoptions.hpp"
+#include "tt_metal/tools/profiler/trace_exporter.hpp"
 #include "tt_metal/third_party/umd/device/tt_xy_pair.h"
 #include "dev_msgs.h"
 #include <algorithm> // for copy() and assign()
@@ -27,15 +29,125 @@ uint32_t get_noc_multicast_encoding(const CoreCoord& top_left, const CoreCoord&
 
 uint32_t get_noc_unicast_encoding(CoreCoord coord) { return NOC_XY_ENCODING(NOC_X(coord.x), NOC_Y(coord.y)); }
 
+uint32_t update_program_page_transfers(
+    uint32_t src,
+    uint32_t num_bytes,
+    uint32_t dst,
+    vector<transfer_info>& transfers,
+    vector<uint32_t>& num_transfers_per_page,
+    uint32_t& num_transfers_within_page,
+    const vector<pair<uint32_t, uint32_t>>& dst_noc_transfer_info,
+    bool linked = false) {
+    constexpr static uint32_t noc_transfer_alignment_in_bytes = 16;
+    while (num_bytes) {
+        uint32_t num_bytes_left_in_page = DeviceCommand::PROGRAM_PAGE_SIZE - (src % DeviceCommand::PROGRAM_PAGE_SIZE);
+        uint32_t num_bytes_in_transfer = std::min(num_bytes_left_in_page, num_bytes);
+        src = align(src + num_bytes_in_transfer, noc_transfer_alignment_in_bytes);
+
+        uint32_t transfer_instruction_idx = 1;
+        for (const auto& [dst_noc_encoding, num_receivers] : dst_noc_transfer_info) {
+            bool last = transfer_instruction_idx == dst_noc_transfer_info.size();
+            transfer_info transfer_instruction = {.size_in_bytes = num_bytes_in_transfer, .dst = dst, .dst_noc_encoding = dst_noc_encoding, .num_receivers = num_receivers, .last_transfer_in_group = last, .linked = linked};
+            transfers.push_back(transfer_instruction);
+            num_transfers_within_page++;
+            transfer_instruction_idx++;
+        }
+
+        dst += num_bytes_in_transfer;
+        num_bytes -= num_bytes_in_transfer;
+
+        if ((src % DeviceCommand::PROGRAM_PAGE_SIZE) == 0) {
+            num_transfers_per_page.push_back(num_transfers_within_page);
+            num_transfers_within_page = 0;
+        }
+    }
+
+    return src;
+}
+
+void ConstructRuntimeArgTransfers(const Device* device, const Program& program, ProgramMap& program_map) {
+    static const map<RISCV, uint32_t> processor_to_l1_arg_base_addr = {
+        {RISCV::BRISC, BRISC_L1_ARG_BASE},
+        {RISCV::NCRISC, NCRISC_L1_ARG_BASE},
+        {RISCV::COMPUTE, TRISC_L1_ARG_BASE},
+    };
+
+    program_map.runtime_arg_page_transfers.clear();
+    program_map.num_transfers_in_runtime_arg_pages.clear();
+    program_map.runtime_args_layout_versions.clear();
+    uint32_t num_transfers_within_page = 0;
+    uint32_t src = 0;
+    for (size_t kernel_id = 0; kernel_id < program.num_kernels(); kernel_id++) {
+        Kernel* kernel = detail::GetKernel(program, kernel_id);
+        uint32_t dst = processor_to_l1_arg_base_addr.at(kernel->processor());
+        program_map.runtime_args_layout_versions.push_back(kernel->runtime_args_layout_version());
+        for (const auto &core_coord : kernel->cores_with_runtime_args()) {
+            CoreCoord physical_core = device->worker_core_from_logical_core(core_coord);
+            const auto & runtime_args = kernel->runtime_args(core_coord);
+            uint32_t num_bytes = runtime_args.size() * sizeof(uint32_t);
+            uint32_t dst_noc = get_noc_unicast_encoding(physical_core);
+
+            // Only one receiver per set of runtime arguments
+            src = update_program_page_transfers(
+                src, num_bytes, dst, program_map.runtime_arg_page_transfers, program_map.num_transfers_in_runtime_arg_pages, num_transfers_within_page, {{dst_noc, 1}});
+        }
+    }
+
+    // Cleanup step of separating runtime arg pages from program pages
+    if (num_transfers_within_page) {
+        program_map.num_transfers_in_runtime_arg_pages.push_back(num_transfers_within_page);
+    }
+}
+
+bool RuntimeArgTransfersMatch(const Program& program, const ProgramMap& program_map) {
+    if (program_map.runtime_args_layout_versions.size() != program.num_kernels()) {
+        return false;
+    }
+    for (size_t kernel_id = 0; kernel_id < program.num_kernels(); kernel_id++) {
+        if (program_map.runtime_args_layout_versions[kernel_id] != detail::GetKernel(program, kernel_id)->runtime_args_layout_version()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+vector<PageRun> ConstructPageRuns(const vector<uint32_t>& dev_page_to_host_page) {
+    vector<PageRun> page_runs;
+    for (uint32_t dev_page = 0; dev_page < dev_page_to_host_page.size(); dev_page++) {
+        uint32_t host_page = dev_page_to_host_page[dev_page];
+        TT_ASSERT(host_page < dev_page_to_host_page.size());
+        if (not page_runs.empty() and page_runs.back().host_page + page_runs.back().num_pages == host_page) {
+            page_runs.back().num_pages++;
+        } else {
+            page_runs.push_back({.dev_page = dev_page, .host_page = host_page, .num_pages = 1});
+        }
+    }
+    return page_runs;
+}
+
+// Calls f(dev_page, host_page, num_pages) for the part of each run that falls within num_pages pages from first_dev_page
+template <typename F>
+void ForEachPageRun(const vector<PageRun>& page_runs, uint32_t first_dev_page, uint32_t num_pages, F&& f) {
+    uint32_t end_dev_page = first_dev_page + num_pages;
+    auto run = std::upper_bound(page_runs.begin(), page_runs.end(), first_dev_page, [](uint32_t dev_page, const PageRun& run) {
+        return dev_page < run.dev_page;
+    });
+    TT_ASSERT(run != page_runs.begin());
+    for (run--; run != page_runs.end() and run->dev_page < end_dev_page; run++) {
+        uint32_t begin = std::max(first_dev_page, run->dev_page);
+        uint32_t end = std::min(end_dev_page, run->dev_page + run->num_pages);
+        f(begin, run->host_page + (begin - run->dev_page), end - begin);
+    }
+}
+
 ProgramMap ConstructProgramMap(const Device* device, Program& program) {
     /*
         TODO(agrebenisan): Move this logic to compile program
     */
-    vector<transfer_info> runtime_arg_page_transfers;
+    ProgramMap program_map;
     vector<transfer_info> cb_config_page_transfers;
     vector<transfer_info> program_page_transfers;
     vector<transfer_info> go_signal_page_transfers;
-    vector<uint32_t> num_transfers_in_runtime_arg_pages; // Corresponds to the number of transfers within host data pages across all host data pages
     vector<uint32_t> num_transfers_in_cb_config_pages;
     vector<uint32_t> num_transfers_in_program_pages;
     vector<uint32_t> num_transfers_in_go_signal_pages;
@@ -43,40 +155,6 @@ ProgramMap ConstructProgramMap(const Device* device, Program& program) {
 
     uint32_t src = 0;
     constexpr static uint32_t noc_transfer_alignment_in_bytes = 16;
-    auto update_program_page_transfers = [&num_transfers_within_page](
-                                             uint32_t src,
-                                             uint32_t num_bytes,
-                                             uint32_t dst,
-                                             vector<transfer_info>& transfers,
-                                             vector<uint32_t>& num_transfers_per_page,
-                                             const vector<pair<uint32_t, uint32_t>>& dst_noc_transfer_info,
-                                             bool linked = false) -> uint32_t {
-        while (num_bytes) {
-            uint32_t num_bytes_left_in_page = DeviceCommand::PROGRAM_PAGE_SIZE - (src % DeviceCommand::PROGRAM_PAGE_SIZE);
-            uint32_t num_bytes_in_transfer = std::min(num_bytes_left_in_page, num_bytes);
-            src = align(src + num_bytes_in_transfer, noc_transfer_alignment_in_bytes);
-
-            uint32_t transfer_instruction_idx = 1;
-            for (const auto& [dst_noc_encoding, num_receivers] : dst_noc_transfer_info) {
-                bool last = transfer_instruction_idx == dst_noc_transfer_info.size();
-                transfer_info transfer_instruction = {.size_in_bytes = num_bytes_in_transfer, .dst = dst, .dst_noc_encoding = dst_noc_encoding, .num_receivers = num_receivers, .last_transfer_in_group = last, .linked = linked};
-                transfers.push_back(transfer_instruction);
-                num_transfers_within_page++;
-                transfer_instruction_idx++;
-            }
-
-            dst += num_bytes_in_transfer;
-            num_bytes -= num_bytes_in_transfer;
-
-            if ((src % DeviceCommand::PROGRAM_PAGE_SIZE) == 0) {
-                num_transfers_per_page.push_back(num_transfers_within_page);
-                num_transfers_within_page = 0;
-            }
-        }
-
-        return src;
-    };
-
     auto extract_dst_noc_multicast_info = [&device](const set<CoreRange>& ranges) -> vector<pair<uint32_t, uint32_t>> {
         // This API extracts all the pairs of noc multicast encodings given a set of core ranges
         vector<pair<uint32_t, uint32_t>> dst_noc_multicast_info;
@@ -92,35 +170,10 @@ ProgramMap ConstructProgramMap(const Device* device, Program& program) {
         return dst_noc_multicast_info;
     };
 
-    static const map<RISCV, uint32_t> processor_to_l1_arg_base_addr = {
-        {RISCV::BRISC, BRISC_L1_ARG_BASE},
-        {RISCV::NCRISC, NCRISC_L1_ARG_BASE},
-        {RISCV::COMPUTE, TRISC_L1_ARG_BASE},
-    };
-
     // Step 1: Get transfer info for runtime args (soon to just be host data). We
     // want to send host data first because of the higher latency to pull
-    // in host data.
-    for (size_t kernel_id = 0; kernel_id < program.num_kernels(); kernel_id++) {
-        Kernel* kernel = detail::GetKernel(program, kernel_id);
-        uint32_t dst = processor_to_l1_arg_base_addr.at(kernel->processor());
-        for (const auto &core_coord : kernel->cores_with_runtime_args()) {
-            CoreCoord physical_core = device->worker_core_from_logical_core(core_coord);
-            const auto & runtime_args = kernel->runtime_args(core_coord);
-            uint32_t num_bytes = runtime_args.size() * sizeof(uint32_t);
-            uint32_t dst_noc = get_noc_unicast_encoding(physical_core);
-
-            // Only one receiver per set of runtime arguments
-            src = update_program_page_transfers(
-                src, num_bytes, dst, runtime_arg_page_transfers, num_transfers_in_runtime_arg_pages, {{dst_noc, 1}});
-        }
-    }
-
-    // Cleanup step of separating runtime arg pages from program pages
-    if (num_transfers_within_page) {
-        num_transfers_in_runtime_arg_pages.push_back(num_transfers_within_page);
-        num_transfers_within_page = 0;
-    }
+    // in host data. These are rebuilt on their own when the runtime args change.
+    ConstructRuntimeArgTransfers(device, program, program_map);
 
     src = 0; // Resetting since in a new page
     // Step 2: Continue constructing pages for circular buffer configs
@@ -134,6 +187,7 @@ ProgramMap ConstructProgramMap(const Device* device, Program& program) {
                 CIRCULAR_BUFFER_CONFIG_BASE + buffer_index * UINT32_WORDS_PER_CIRCULAR_BUFFER_CONFIG * sizeof(uint32_t),
                 cb_config_page_transfers,
                 num_transfers_in_cb_config_pages,
+                num_transfers_within_page,
                 dst_noc_multicast_info);
         }
     }
@@ -196,7 +250,7 @@ ProgramMap ConstructProgramMap(const Device* device, Program& program) {
                     }
 
                     src = update_program_page_transfers(
-                        src, num_bytes, dst, program_page_transfers, num_transfers_in_program_pages, dst_noc_multicast_info, linked);
+                        src, num_bytes, dst, program_page_transfers, num_transfers_in_program_pages, num_transfers_within_page, dst_noc_multicast_info, linked);
                     k++;
                 });
                 sub_kernel_index++;
@@ -215,6 +269,7 @@ ProgramMap ConstructProgramMap(const Device* device, Program& program) {
             semaphore.address(),
             program_page_transfers,
             num_transfers_in_program_pages,
+            num_transfers_within_page,
             dst_noc_multicast_info);
     }
 
@@ -238,6 +293,7 @@ ProgramMap ConstructProgramMap(const Device* device, Program& program) {
             GET_MAILBOX_ADDRESS_HOST(launch),
             go_signal_page_transfers,
             num_transfers_in_go_signal_pages,
+            num_transfers_within_page,
             dst_noc_multicast_info
         );
     }
@@ -295,18 +351,15 @@ ProgramMap ConstructProgramMap(const Device* device, Program& program) {
         num_workers = program.logical_cores().at(CoreType::WORKER).size();
     }
 
-    return {
-        .num_workers = num_workers,
-        .program_pages = std::move(program_pages),
-        .program_page_transfers = std::move(program_page_transfers),
-        .runtime_arg_page_transfers = std::move(runtime_arg_page_transfers),
-        .cb_config_page_transfers = std::move(cb_config_page_transfers),
-        .go_signal_page_transfers = std::move(go_signal_page_transfers),
-        .num_transfers_in_program_pages = std::move(num_transfers_in_program_pages),
-        .num_transfers_in_runtime_arg_pages = std::move(num_transfers_in_runtime_arg_pages),
-        .num_transfers_in_cb_config_pages = std::move(num_transfers_in_cb_config_pages),
-        .num_transfers_in_go_signal_pages = std::move(num_transfers_in_go_signal_pages),
-    };
+    program_map.num_workers = num_workers;
+    program_map.program_pages = std::move(program_pages);
+    program_map.program_page_transfers = std::move(program_page_transfers);
+    program_map.cb_config_page_transfers = std::move(cb_config_page_transfers);
+    program_map.go_signal_page_transfers = std::move(go_signal_page_transfers);
+    program_map.num_transfers_in_program_pages = std::move(num_transfers_in_program_pages);
+    program_map.num_transfers_in_cb_config_pages = std::move(num_transfers_in_cb_config_pages);
+    program_map.num_transfers_in_go_signal_pages = std::move(num_transfers_in_go_signal_pages);
+    return program_map;
 }
 
 // EnqueueReadBufferCommandSection
@@ -406,13 +459,16 @@ const DeviceCommand EnqueueReadBufferCommand::assemble_device_command(uint32_t d
 
 void EnqueueReadBufferCommand::process() {
     uint32_t write_ptr = this->manager.get_issue_queue_write_ptr(this->command_queue_id);
-    this->read_buffer_addr = this->manager.get_completion_queue_read_ptr(this->command_queue_id);
+    // Earlier reads may still be waiting to be copied out, the data goes after theirs
+    this->read_buffer_addr = this->manager.get_completion_queue_reserve_ptr(this->command_queue_id);
 
     const DeviceCommand cmd = this->assemble_device_command(this->read_buffer_addr);
 
     this->manager.issue_queue_reserve_back(DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND, this->command_queue_id);
     this->manager.cq_write(cmd.get_desc().data(), DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND, write_ptr);
-    this->manager.issue_queue_push_back(DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND, LAZY_COMMAND_QUEUE_MODE, this->command_queue_id);
+    // Never lazy, the completion reader waits on the device for this data
+    this->manager.issue_queue_push_back(DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND, false, this->command_queue_id);
+    this->manager.completion_queue_reserve_back(this->pages_to_read * align(this->buffer.page_size(), 32), this->command_queue_id);
 }
 
 EnqueueCommandType EnqueueReadBufferCommand::type() { return this->type_; }
@@ -425,8 +481,9 @@ EnqueueWriteBufferCommand::EnqueueWriteBufferCommand(
     const void* src,
     SystemMemoryManager& manager,
     uint32_t dst_page_index,
-    std::optional<uint32_t> pages_to_write) :
-    command_queue_id(command_queue_id), manager(manager), src(src), buffer(buffer), dst_page_index(dst_page_index), pages_to_write(pages_to_write.has_value() ? pages_to_write.value() : buffer.num_pages()) {
+    std::optional<uint32_t> pages_to_write,
+    const vector<PageRun>* page_runs) :
+    command_queue_id(command_queue_id), manager(manager), src(src), buffer(buffer), dst_page_index(dst_page_index), pages_to_write(pages_to_write.has_value() ? pages_to_write.value() : buffer.num_pages()), page_runs(page_runs) {
     TT_ASSERT(
         buffer.buffer_type() == BufferType::DRAM or buffer.buffer_type() == BufferType::L1,
         "Trying to write to an invalid buffer");
@@ -527,18 +584,32 @@ void EnqueueWriteBufferCommand::process() {
     this->manager.issue_queue_reserve_back(cmd_size, this->command_queue_id);
 
     this->manager.cq_write(cmd.get_desc().data(), DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND, write_ptr);
-    uint32_t unpadded_src_offset = this->dst_page_index * this->buffer.page_size();
-
-    if (this->buffer.page_size() % 32 != 0 and this->buffer.page_size() != this->buffer.size()) {
-        // If page size is not 32B-aligned, we cannot do a contiguous write
-        uint32_t src_address_offset = unpadded_src_offset;
-        uint32_t padded_page_size = align(this->buffer.page_size(), 32);
-        for (uint32_t sysmem_address_offset = 0; sysmem_address_offset < data_size_in_bytes; sysmem_address_offset += padded_page_size) {
-            this->manager.cq_write((char*)this->src + src_address_offset, this->buffer.page_size(), system_memory_temporary_storage_address + sysmem_address_offset);
-            src_address_offset += this->buffer.page_size();
+
+    // If page size is not 32B-aligned, we cannot do a contiguous write
+    uint32_t page_size = this->buffer.page_size();
+    bool pages_padded = page_size % 32 != 0 and page_size != this->buffer.size();
+    uint32_t padded_page_size = pages_padded ? align(page_size, 32) : page_size;
+    auto write_pages = [&](const char* page_src, uint32_t num_pages, uint32_t sysmem_address) {
+        if (pages_padded) {
+            for (uint32_t page = 0; page < num_pages; page++) {
+                this->manager.cq_write(page_src + page * page_size, page_size, sysmem_address + page * padded_page_size);
+            }
+        } else {
+            this->manager.cq_write(page_src, num_pages * page_size, sysmem_address);
         }
+    };
+
+    if (this->page_runs != nullptr) {
+        // Gather the pages in device order from the whole buffer's data
+        ForEachPageRun(*this->page_runs, this->dst_page_index, this->pages_to_write, [&](uint32_t dev_page, uint32_t host_page, uint32_t num_pages) {
+            write_pages(
+                (const char*)this->src + host_page * page_size,
+                num_pages,
+                system_memory_temporary_storage_address + (dev_page - this->dst_page_index) * padded_page_size);
+        });
     } else {
-        this->manager.cq_write((char*)this->src + unpadded_src_offset, data_size_in_bytes, system_memory_temporary_storage_address);
+        // src points at the data for dst_page_index, the caller is responsible for offsetting it
+        write_pages((const char*)this->src, this->pages_to_write, system_memory_temporary_storage_address);
     }
 
     this->manager.issue_queue_push_back(cmd_size, LAZY_COMMAND_QUEUE_MODE, this->command_queue_id);
@@ -564,6 +635,18 @@ EnqueueProgramCommand::EnqueueProgramCommand(
 }
 
 const DeviceCommand EnqueueProgramCommand::assemble_device_command(uint32_t host_data_src) {
+    if (this->program_to_dev_map.device_command.has_value()) {
+        DeviceCommand command = this->program_to_dev_map.device_command.value();
+        uint32_t num_host_data_pages = this->program_to_dev_map.num_transfers_in_runtime_arg_pages.size() + this->program_to_dev_map.num_transfers_in_cb_config_pages.size();
+        if (num_host_data_pages) {
+            command.update_buffer_transfer_src(0, host_data_src);
+        }
+        if (this->stall) {
+            command.set_stall();
+        }
+        return command;
+    }
+
     DeviceCommand command;
     command.set_num_workers(this->program_to_dev_map.num_workers);
 
@@ -661,6 +744,10 @@ const DeviceCommand EnqueueProgramCommand::assemble_device_command(uint32_t host
     command.set_producer_cb_num_pages(producer_cb_num_pages);
     command.set_consumer_cb_num_pages(consumer_cb_num_pages);
 
+    // This needs to be quite small, since programs are small
+    command.set_producer_consumer_transfer_num_pages(4);
+    this->program_to_dev_map.device_command = command;
+
     // Should only ever be set if we are
     // enqueueing a program immediately
     // after writing it to a buffer
@@ -668,9 +755,6 @@ const DeviceCommand EnqueueProgramCommand::assemble_device_command(uint32_t host
         command.set_stall();
     }
 
-    // This needs to be quite small, since programs are small
-    command.set_producer_consumer_transfer_num_pages(4);
-
     return command;
 }
 
@@ -691,6 +775,16 @@ void EnqueueProgramCommand::process() {
     constexpr static uint32_t padding_alignment = 16;
     for (size_t kernel_id = 0; kernel_id < this->program.num_kernels(); kernel_id++) {
         Kernel* kernel = detail::GetKernel(program, kernel_id);
+        if (kernel->runtime_args_packed()) {
+            // The kernel stores its args the way they're packed here, copy all of its cores at once
+            const vector<uint32_t>& runtime_args_data = kernel->runtime_args_data();
+            this->manager.cq_write(runtime_args_data.data(), runtime_args_data.size() * sizeof(uint32_t), system_memory_temporary_storage_address);
+            system_memory_temporary_storage_address += runtime_args_data.size() * sizeof(uint32_t);
+            if (tracing) {
+                trace_host_data.insert(trace_host_data.end(), runtime_args_data.begin(), runtime_args_data.end());
+            }
+            continue;
+        }
         for (const auto& c: kernel->cores_with_runtime_args()) {
             const auto & core_runtime_args = kernel->runtime_args(c);
             this->manager.cq_write(core_runtime_args.data(), core_runtime_args.size() * sizeof(uint32_t), system_memory_temporary_storage_address);
@@ -771,10 +865,9 @@ void EnqueueWrapCommand::process() {
     this->manager.issue_queue_reserve_back(wrap_packet_size_bytes, this->command_queue_id);
     this->manager.cq_write(cmd.get_desc().data(), wrap_packet_size_bytes, write_ptr);
     if (this->wrap_region == DeviceCommand::WrapRegion::COMPLETION) {
-        // Wrap the read pointers for completion queue because device will start writing data at head of completion queue and there are no more reads to be done at current completion queue write pointer
-        // If we don't wrap the read then the subsequent read buffer command may attempt to read past the total command queue size
-        // because the read buffer command will see updated write pointer to compute num pages to read but the local read pointer is pointing to tail of completion queue
-        this->manager.wrap_completion_queue_rd_ptr(this->command_queue_id);
+        // Device will start writing data at head of completion queue, so the next read buffer command has to target it.
+        // The read pointer is wrapped by the completion reader once it has copied out the data before the wrap.
+        this->manager.wrap_completion_queue_reserve_ptr(this->command_queue_id);
         this->manager.issue_queue_push_back(wrap_packet_size_bytes, LAZY_COMMAND_QUEUE_MODE, this->command_queue_id);
     } else {
         this->manager.wrap_issue_queue_wr_ptr(this->command_queue_id);
@@ -797,9 +890,143 @@ CommandQueue::CommandQueue(Device* device, uint32_t id): manager(*device->manage
 
     this->issue_queue_reader_core = CoreCoord(issue_q_reader_location.x, issue_q_reader_location.y);
     this->completion_queue_writer_core = CoreCoord(completion_q_writer_location.x, completion_q_writer_location.y);
+
+    this->async_mode = llrt::OptionsG.get_async_command_queue_enabled();
+    if (this->async_mode) {
+        this->work_queue = std::make_unique<LockFreeSPSCQueue<CommandQueueWork>>(WORK_QUEUE_CAPACITY);
+        this->worker_thread = std::thread(&CommandQueue::worker_loop, this);
+    }
+}
+
+CommandQueue::~CommandQueue() {
+    if (this->async_mode) {
+        // Work already pushed runs before the worker sees the stop
+        CommandQueueWork stop;
+        stop.type = CommandQueueWorkType::STOP;
+        this->work_queue->push(std::move(stop));
+        this->worker_thread.join();
+    }
+    // The worker is done issuing reads, the reader copies out what's left of them and stops
+    if (this->completion_reader_thread.joinable()) {
+        CompletionReadWork stop;
+        stop.type = CompletionReadWorkType::STOP;
+        this->completion_read_queue->push(std::move(stop));
+        this->completion_reader_thread.join();
+    }
 }
 
-CommandQueue::~CommandQueue() {}
+void CommandQueue::run_work(CommandQueueWork work) {
+    if (not this->async_mode) {
+        this->execute_work(work);
+        return;
+    }
+
+    // The caller may reuse the source of a write and change or free a program it still owns as soon as this returns
+    bool wait = work.blocking;
+    if (not work.blocking) {
+        switch (work.type) {
+            case CommandQueueWorkType::ENQUEUE_WRITE_BUFFER:
+            case CommandQueueWorkType::ENQUEUE_WRITE_BUFFER_PAGES: {
+                uint32_t num_pages = work.type == CommandQueueWorkType::ENQUEUE_WRITE_BUFFER ? work.buffer->num_pages() : work.num_pages;
+                const char* src = static_cast<const char*>(work.src);
+                work.owned_src.assign(src, src + size_t(num_pages) * work.buffer->page_size());
+                work.src = work.owned_src.data();
+                break;
+            }
+            case CommandQueueWorkType::ENQUEUE_PROGRAM:
+                wait = work.owned_program == nullptr;
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::shared_future<void> completion;
+    if (wait) {
+        work.completion = std::make_shared<std::promise<void>>();
+        completion = work.completion->get_future().share();
+    }
+    this->work_queue->push(std::move(work));
+    if (completion.valid()) {
+        completion.get();
+    }
+}
+
+void CommandQueue::execute_work(const CommandQueueWork& work) {
+    switch (work.type) {
+        case CommandQueueWorkType::ENQUEUE_READ_BUFFER:
+            this->enqueue_read_buffer(*work.buffer, work.dst, work.blocking);
+            break;
+        case CommandQueueWorkType::ENQUEUE_WRITE_BUFFER:
+            this->enqueue_write_buffer(*work.buffer, work.src, work.blocking);
+            break;
+        case CommandQueueWorkType::ENQUEUE_WRITE_BUFFER_PAGES:
+            this->enqueue_write_buffer_pages(*work.buffer, work.src, work.page_index, work.num_pages, work.blocking);
+            break;
+        case CommandQueueWorkType::ENQUEUE_PROGRAM:
+            this->enqueue_program(*work.program, work.trace, work.blocking);
+            break;
+        case CommandQueueWorkType::FINISH:
+            this->finish();
+            break;
+        case CommandQueueWorkType::RECORD_EVENT:
+            break;
+        default:
+            TT_THROW("Invalid command queue work");
+    }
+}
+
+void CommandQueue::worker_loop() {
+    // Takes whatever is queued in one go, so a burst of enqueues costs the caller one wake up of the worker at most
+    std::array<CommandQueueWork, WORKER_BATCH_SIZE> batch;
+    while (true) {
+        size_t num_works = this->work_queue->pop_batch(batch.data(), batch.size());
+        for (size_t i = 0; i < num_works; i++) {
+            CommandQueueWork work = std::move(batch[i]);
+            if (work.type == CommandQueueWorkType::STOP) {
+                return;
+            }
+            ZoneScopedN("CommandQueue_worker");
+            if (not this->worker_exception) {
+                try {
+                    this->execute_work(work);
+                } catch (...) {
+                    this->worker_exception = std::current_exception();
+                    log_error(tt::LogDispatch, "Command queue {} worker failed, later commands on it won't run", this->id);
+                }
+            }
+            if (work.completion) {
+                if (this->worker_exception) {
+                    work.completion->set_exception(this->worker_exception);
+                } else if (work.type == CommandQueueWorkType::RECORD_EVENT and this->completion_reads_pending()) {
+                    // Reads enqueued before the event are done once the reader has copied them out
+                    CompletionReadWork event;
+                    event.type = CompletionReadWorkType::EVENT;
+                    event.completion = std::move(work.completion);
+                    this->push_completion_read(std::move(event));
+                } else {
+                    work.completion->set_value();
+                }
+            }
+        }
+    }
+}
+
+Event CommandQueue::record_event() {
+    if (not this->async_mode) {
+        return this->record_completion_event();
+    }
+    CommandQueueWork work;
+    work.type = CommandQueueWorkType::RECORD_EVENT;
+    work.completion = std::make_shared<std::promise<void>>();
+    Event event(work.completion->get_future().share());
+    this->work_queue->push(std::move(work));
+    return event;
+}
+
+void CommandQueue::wait_for_worker() {
+    EventSynchronize(this->record_event());
+}
 
 void CommandQueue::enqueue_command(Command& command, bool blocking) {
     // For the time-being, doing the actual work of enqueing in
@@ -813,103 +1040,179 @@ void CommandQueue::enqueue_command(Command& command, bool blocking) {
 }
 
 
-//TODO: Currently converting page ordering from interleaved to sharded and then doing contiguous read/write
-// Look into modifying command to do read/write of a page at a time to avoid doing copy
-void convert_interleaved_to_sharded_on_host(const void * host, const int num_pages,
-                                        const int page_size,
-                                        const std::vector<uint32_t>& page_map,
-                                        bool read=false) {
-
-    const uint32_t size_in_bytes = num_pages * page_size;
+void CommandQueue::push_completion_read(CompletionReadWork work) {
+    if (not this->completion_reader_thread.joinable()) {
+        this->completion_read_queue = std::make_unique<LockFreeSPSCQueue<CompletionReadWork>>(COMPLETION_READ_QUEUE_CAPACITY);
+        this->completion_reader_thread = std::thread(&CommandQueue::completion_reader_loop, this);
+    }
+    if (work.type == CompletionReadWorkType::READ_PAGES or work.type == CompletionReadWorkType::WRAP) {
+        this->num_completion_reads_issued++;
+    }
+    this->completion_read_queue->push(std::move(work));
+}
 
-    void * temp = malloc(size_in_bytes);
-    memcpy(temp, host, size_in_bytes);
+void CommandQueue::completion_reader_loop() {
+    while (true) {
+        CompletionReadWork work = this->completion_read_queue->pop();
+        if (work.type == CompletionReadWorkType::STOP) {
+            return;
+        }
+        if (work.type == CompletionReadWorkType::EVENT) {
+            if (this->completion_reader_exception) {
+                work.completion->set_exception(this->completion_reader_exception);
+            } else {
+                work.completion->set_value();
+            }
+            continue;
+        }
+        if (this->completion_reader_exception) {
+            continue;
+        }
 
-    const void * dst = host;
-    std::set<uint32_t> pages_seen;
-    for (uint32_t host_page_id = 0; host_page_id < num_pages; host_page_id++) {
-        auto dev_page_id = page_map[host_page_id];
+        ZoneScopedN("CommandQueue_completion_reader");
+        try {
+            if (work.type == CompletionReadWorkType::WRAP) {
+                // Data before the wrap has been copied out, follow the device to the head of the completion region
+                this->manager.completion_queue_wait_wrap(this->id);
+                this->manager.wrap_completion_queue_rd_ptr(this->id);
+                this->manager.send_completion_queue_read_ptr(this->id);
+            } else {
+                this->read_completion_pages(work);
+            }
+            this->num_completion_reads_done.fetch_add(1, std::memory_order_release);
+        } catch (...) {
+            this->completion_reader_exception = std::current_exception();
+            log_error(tt::LogDispatch, "Command queue {} completion reader failed, later reads on it won't complete", this->id);
+        }
+    }
+}
 
-        TT_ASSERT(dev_page_id < num_pages and dev_page_id >= 0);
-        if (read) {
-            memcpy((char* )dst + dev_page_id*page_size,
-                (char *)temp + host_page_id*page_size,
-                page_size
-                );
+void CommandQueue::read_completion_pages(const CompletionReadWork& work) {
+    chip_id_t mmio_device_id = tt::Cluster::instance().get_associated_mmio_device(this->device->id());
+    uint16_t channel = tt::Cluster::instance().get_assigned_channel_for_device(this->device->id());
+    const Buffer& buffer = *work.buffer;
+    uint32_t page_size = buffer.page_size();
+    uint32_t padded_page_size = align(page_size, 32);
+
+    this->manager.completion_queue_wait_front(this->id); // wait for device to write data
+
+    uint32_t bytes_read = work.num_pages * padded_page_size;
+    if (work.page_runs != nullptr) {
+        // Scatter the pages from device order into host order
+        ForEachPageRun(*work.page_runs, work.first_page, work.num_pages, [&](uint32_t dev_page, uint32_t host_page, uint32_t num_pages) {
+            char* dst = (char*)work.dst + host_page * page_size;
+            uint32_t read_addr = work.read_addr + (dev_page - work.first_page) * padded_page_size;
+            if (page_size != padded_page_size) {
+                for (uint32_t page = 0; page < num_pages; page++) {
+                    tt::Cluster::instance().read_sysmem(dst + page * page_size, page_size, read_addr + page * padded_page_size, mmio_device_id, channel);
+                }
+            } else {
+                tt::Cluster::instance().read_sysmem(dst, num_pages * page_size, read_addr, mmio_device_id, channel);
+            }
+        });
+    } else if (page_size != padded_page_size) {
+        // Pages are padded to 32B in the completion region. Copy as many padded pages as fit in what's left of dst in
+        // one go and close the gaps in place, pages are only moved towards the start so each move reads data that
+        // hasn't been overwritten yet. The last pages of the buffer have no room for their padding and are copied one
+        // at a time.
+        char* dst = (char*)work.dst + work.first_page * page_size;
+        uint32_t dst_room = (buffer.num_pages() - work.first_page) * page_size;
+        uint32_t num_bulk_pages = std::min(work.num_pages, dst_room / padded_page_size);
+        tt::Cluster::instance().read_sysmem(dst, num_bulk_pages * padded_page_size, work.read_addr, mmio_device_id, channel);
+        for (uint32_t page = 1; page < num_bulk_pages; page++) {
+            std::memmove(dst + page * page_size, dst + page * padded_page_size, page_size);
         }
-        else {
-            memcpy((char* )dst + host_page_id*page_size,
-                (char *)temp + dev_page_id*page_size,
-                page_size
-                );
+        for (uint32_t page = num_bulk_pages; page < work.num_pages; page++) {
+            tt::Cluster::instance().read_sysmem(dst + page * page_size, page_size, work.read_addr + page * padded_page_size, mmio_device_id, channel);
         }
+    } else {
+        char* dst = (char*)work.dst + work.first_page * page_size;
+        tt::Cluster::instance().read_sysmem(dst, bytes_read, work.read_addr, mmio_device_id, channel);
     }
-    free(temp);
+    this->manager.completion_queue_pop_front(bytes_read, this->id);
+}
+
+bool CommandQueue::completion_reads_pending() const {
+    return this->num_completion_reads_issued != this->num_completion_reads_done.load(std::memory_order_acquire);
+}
+
+Event CommandQueue::record_completion_event() {
+    if (not this->completion_reads_pending()) {
+        return Event();
+    }
+    CompletionReadWork work;
+    work.type = CompletionReadWorkType::EVENT;
+    work.completion = std::make_shared<std::promise<void>>();
+    Event event(work.completion->get_future().share());
+    this->push_completion_read(std::move(work));
+    return event;
+}
+
+void CommandQueue::wait_for_completion_reader() {
+    EventSynchronize(this->record_completion_event());
 }
 
 // Read buffer command is enqueued in the issue region and device writes requested buffer data into the completion region
 void CommandQueue::enqueue_read_buffer(Buffer& buffer, void* dst, bool blocking) {
     ZoneScopedN("CommandQueue_read_buffer");
-    TT_FATAL(blocking, "EnqueueReadBuffer only has support for blocking mode currently");
-
-    chip_id_t mmio_device_id = tt::Cluster::instance().get_associated_mmio_device(this->device->id());
-    uint16_t channel = tt::Cluster::instance().get_assigned_channel_for_device(this->device->id());
+    TraceScope trace_scope("EnqueueReadBuffer", "command_queue", this->device->id());
     uint32_t read_buffer_command_size = DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND;
 
     uint32_t padded_page_size = align(buffer.page_size(), 32);
+    TT_FATAL(padded_page_size <= this->manager.get_completion_queue_size(this->id), "Page of {} B doesn't fit in the completion region", padded_page_size);
     uint32_t total_pages_to_read = buffer.num_pages();
-    uint32_t unpadded_dst_offset = 0;
     uint32_t src_page_index = 0;
+    std::shared_ptr<const vector<PageRun>> page_runs;
+    if (buffer.buffer_layout() == TensorMemoryLayout::WIDTH_SHARDED or
+        buffer.buffer_layout() == TensorMemoryLayout::BLOCK_SHARDED) {
+        page_runs = std::make_shared<const vector<PageRun>>(ConstructPageRuns(buffer.dev_page_to_host_page_mapping()));
+    }
     while (total_pages_to_read > 0) {
         if ((this->manager.get_issue_queue_write_ptr(this->id)) + read_buffer_command_size >= this->manager.get_issue_queue_limit(this->id)) {
-            this->wrap(DeviceCommand::WrapRegion::ISSUE, blocking);
+            this->wrap(DeviceCommand::WrapRegion::ISSUE, false);
         }
 
+        // The device writes each chunk where the previous one ended, it waits on the completion reader if that
+        // space hasn't been copied out yet
         const uint32_t command_completion_limit = this->manager.get_completion_queue_limit(this->id);
-        uint32_t num_pages_available = (command_completion_limit - get_cq_completion_wr_ptr<false>(this->device->id(), this->id, this->size_B)) / padded_page_size;
+        uint32_t num_pages_available = (command_completion_limit - this->manager.get_completion_queue_reserve_ptr(this->id)) / padded_page_size;
         uint32_t pages_to_read = std::min(total_pages_to_read, num_pages_available);
         if (pages_to_read == 0) {
             // Wrap the completion region because a single page won't fit in available space
-            // Wrap needs to be blocking because host needs updated write pointer to compute how many pages can be read
-            this->wrap(DeviceCommand::WrapRegion::COMPLETION, true);
-            num_pages_available = (command_completion_limit - get_cq_completion_wr_ptr<false>(this->device->id(), this->id, this->size_B)) / padded_page_size;
+            this->wrap(DeviceCommand::WrapRegion::COMPLETION, false);
+            num_pages_available = (command_completion_limit - this->manager.get_completion_queue_reserve_ptr(this->id)) / padded_page_size;
             pages_to_read = std::min(total_pages_to_read, num_pages_available);
+            if ((this->manager.get_issue_queue_write_ptr(this->id)) + read_buffer_command_size >= this->manager.get_issue_queue_limit(this->id)) {
+                this->wrap(DeviceCommand::WrapRegion::ISSUE, false);
+            }
         }
 
         tt::log_debug(tt::LogDispatch, "EnqueueReadBuffer for channel {}", this->id);
         EnqueueReadBufferCommand command(this->id, this->device, buffer, dst, this->manager, src_page_index, pages_to_read);
-        this->enqueue_command(command, blocking);
-        this->manager.completion_queue_wait_front(this->id); // wait for device to write data
-
-        uint32_t bytes_read = pages_to_read * padded_page_size;
-        if ((buffer.page_size() % 32) != 0) {
-            // If page size is not 32B-aligned, we cannot do a contiguous copy
-            uint32_t dst_address_offset = unpadded_dst_offset;
-            for (uint32_t sysmem_address_offset = 0; sysmem_address_offset < bytes_read; sysmem_address_offset += padded_page_size) {
-                tt::Cluster::instance().read_sysmem((char*)dst + dst_address_offset, buffer.page_size(), command.read_buffer_addr + sysmem_address_offset, mmio_device_id, channel);
-                dst_address_offset += buffer.page_size();
-            }
-        } else {
-            tt::Cluster::instance().read_sysmem((char*)dst + unpadded_dst_offset, bytes_read, command.read_buffer_addr, mmio_device_id, channel);
-        }
+        this->enqueue_command(command, false);
+
+        CompletionReadWork work;
+        work.type = CompletionReadWorkType::READ_PAGES;
+        work.buffer = &buffer;
+        work.dst = dst;
+        work.first_page = src_page_index;
+        work.read_addr = command.read_buffer_addr;
+        work.num_pages = pages_to_read;
+        work.page_runs = page_runs;
+        this->push_completion_read(std::move(work));
 
-        this->manager.completion_queue_pop_front(bytes_read, this->id);
         total_pages_to_read -= pages_to_read;
         src_page_index += pages_to_read;
-        unpadded_dst_offset += pages_to_read * buffer.page_size();
     }
 
-    if (buffer.buffer_layout() == TensorMemoryLayout::WIDTH_SHARDED or
-        buffer.buffer_layout() == TensorMemoryLayout::BLOCK_SHARDED) {
-        convert_interleaved_to_sharded_on_host(dst, buffer.num_pages(),
-                                        buffer.page_size(),
-                                        buffer.dev_page_to_host_page_mapping(),
-                                        true);
+    if (blocking) {
+        this->wait_for_completion_reader();
     }
 }
 
 void CommandQueue::enqueue_write_buffer(Buffer& buffer, const void* src, bool blocking) {
     ZoneScopedN("CommandQueue_write_buffer");
+    TraceScope trace_scope("EnqueueWriteBuffer", "command_queue", this->device->id());
 
     // TODO(agrebenisan): Fix these asserts after implementing multi-core CQ
     // TODO (abhullar): Use eth mem l1 size when issue queue interface kernel is on ethernet core
@@ -919,15 +1222,30 @@ void CommandQueue::enqueue_write_buffer(Buffer& buffer, const void* src, bool bl
 
     if (buffer.buffer_layout() == TensorMemoryLayout::WIDTH_SHARDED or
         buffer.buffer_layout() == TensorMemoryLayout::BLOCK_SHARDED) {
-        convert_interleaved_to_sharded_on_host(src, buffer.num_pages(),
-                                    buffer.page_size(),
-                                    buffer.dev_page_to_host_page_mapping());
+        // Pages are gathered into device order as they're written to the issue queue, src is left as it is
+        vector<PageRun> page_runs = ConstructPageRuns(buffer.dev_page_to_host_page_mapping());
+        this->write_buffer_pages(buffer, src, 0, buffer.num_pages(), blocking, &page_runs);
+        return;
     }
 
+    this->write_buffer_pages(buffer, src, 0, buffer.num_pages(), blocking);
+}
+
+void CommandQueue::enqueue_write_buffer_pages(Buffer& buffer, const void* src, uint32_t dst_page_index, uint32_t num_pages, bool blocking) {
+    ZoneScopedN("CommandQueue_write_buffer_pages");
+
+    TT_ASSERT(
+        buffer.page_size() < MEM_L1_SIZE - get_data_section_l1_address(false),
+        "Buffer pages must fit within the command queue data section");
+
+    this->write_buffer_pages(buffer, src, dst_page_index, num_pages, blocking);
+}
+
+void CommandQueue::write_buffer_pages(Buffer& buffer, const void* src, uint32_t dst_page_index, uint32_t num_pages, bool blocking, const vector<PageRun>* page_runs) {
     uint32_t padded_page_size = align(buffer.page_size(), 32);
-    uint32_t total_pages_to_write = buffer.num_pages();
+    uint32_t total_pages_to_write = num_pages;
     const uint32_t command_issue_limit = this->manager.get_issue_queue_limit(this->id);
-    uint32_t dst_page_index = 0;
+    const char* page_src = static_cast<const char*>(src);
     while (total_pages_to_write > 0) {
         int32_t num_pages_available = (int32_t(command_issue_limit - this->manager.get_issue_queue_write_ptr(this->id)) - int32_t(DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND)) / int32_t(padded_page_size);
         // If not even a single device command fits, we hit this edgecase
@@ -942,17 +1260,19 @@ void CommandQueue::enqueue_write_buffer(Buffer& buffer, const void* src, bool bl
         }
 
         tt::log_debug(tt::LogDispatch, "EnqueueWriteBuffer for channel {}", this->id);
-        EnqueueWriteBufferCommand command(this->id, this->device, buffer, src, this->manager, dst_page_index, pages_to_write);
+        // With page runs the command gathers its pages from anywhere in src
+        EnqueueWriteBufferCommand command(this->id, this->device, buffer, page_runs != nullptr ? src : page_src, this->manager, dst_page_index, pages_to_write, page_runs);
         this->enqueue_command(command, blocking);
 
         total_pages_to_write -= pages_to_write;
         dst_page_index += pages_to_write;
+        page_src += pages_to_write * buffer.page_size();
     }
 }
 
 void CommandQueue::enqueue_program(Program& program, std::optional<std::reference_wrapper<Trace>> trace, bool blocking) {
     ZoneScopedN("CommandQueue_enqueue_program");
-    TT_FATAL(not blocking, "EnqueueProgram only has support for non-blocking mode currently");
+    TraceScope trace_scope("EnqueueProgram", "command_queue", this->device->id());
 
     // Need to relay the program into DRAM if this is the first time
     // we are seeing it
@@ -982,6 +1302,13 @@ void CommandQueue::enqueue_program(Program& program, std::optional<std::referenc
 
         map<uint64_t, ProgramMap>& program_to_dev_map = this->program_to_dev_map(device->id());
         program_to_dev_map.emplace(program_id, std::move(program_to_device_map));
+    } else {
+        // Only the runtime args can change on a cached program, binaries, CBs and semaphores are fixed once compiled
+        ProgramMap& program_to_device_map = this->program_to_dev_map(this->device->id()).at(program_id);
+        if (not RuntimeArgTransfersMatch(program, program_to_device_map)) {
+            ConstructRuntimeArgTransfers(this->device, program, program_to_device_map);
+            program_to_device_map.device_command.reset();
+        }
     }
 
     tt::log_debug(tt::LogDispatch, "EnqueueProgram for channel {}", this->id);
@@ -1034,6 +1361,7 @@ void CommandQueue::wait_finish() {
 
 void CommandQueue::finish() {
     ZoneScopedN("CommandQueue_finish");
+    TraceScope trace_scope("Finish", "command_queue", this->device->id());
     if ((this->manager.get_issue_queue_write_ptr(this->id)) + DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND >=
         this->manager.get_issue_queue_limit(this->id)) {
         this->wrap(DeviceCommand::WrapRegion::ISSUE, false);
@@ -1043,6 +1371,9 @@ void CommandQueue::finish() {
     FinishCommand command(this->id, this->device, this->manager);
     this->enqueue_command(command, false);
     this->wait_finish();
+    this->evicted_program_buffers.clear();
+    // The device has written the data of every read, the reader may still be copying it out
+    this->wait_for_completion_reader();
 }
 
 void CommandQueue::wrap(DeviceCommand::WrapRegion wrap_region, bool blocking) {
@@ -1050,6 +1381,11 @@ void CommandQueue::wrap(DeviceCommand::WrapRegion wrap_region, bool blocking) {
     tt::log_debug(tt::LogDispatch, "EnqueueWrap for channel {}", this->id);
     EnqueueWrapCommand command(this->id, this->device, this->manager, wrap_region);
     this->enqueue_command(command, blocking);
+    if (wrap_region == DeviceCommand::WrapRegion::COMPLETION) {
+        CompletionReadWork work;
+        work.type = CompletionReadWorkType::WRAP;
+        this->push_completion_read(std::move(work));
+    }
 }
 
 void CommandQueue::reset() {
@@ -1112,58 +1448,140 @@ void EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, vector<uint32_t>& dst,
     // TODO(agrebenisan): Move to deprecated
     ZoneScoped;
     tt_metal::detail::DispatchStateCheck(true);
-    TT_FATAL(blocking, "Non-blocking EnqueueReadBuffer not yet supported");
 
     // Only resizing here to keep with the original implementation. Notice how in the void*
     // version of this API, I assume the user mallocs themselves
     dst.resize(buffer.page_size() * buffer.num_pages() / sizeof(uint32_t));
-    cq.enqueue_read_buffer(buffer, dst.data(), blocking);
+    EnqueueReadBuffer(cq, buffer, static_cast<void*>(dst.data()), blocking);
 }
 
 void EnqueueWriteBuffer(CommandQueue& cq, Buffer& buffer, vector<uint32_t>& src, bool blocking) {
     // TODO(agrebenisan): Move to deprecated
     ZoneScoped;
     tt_metal::detail::DispatchStateCheck(true);
-    cq.enqueue_write_buffer(buffer, src.data(), blocking);
+    EnqueueWriteBuffer(cq, buffer, static_cast<const void*>(src.data()), blocking);
 }
 
 void EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, void* dst, bool blocking) {
     ZoneScoped;
     tt_metal::detail::DispatchStateCheck(true);
-    cq.enqueue_read_buffer(buffer, dst, blocking);
+    CommandQueueWork work;
+    work.type = CommandQueueWorkType::ENQUEUE_READ_BUFFER;
+    work.buffer = &buffer;
+    work.dst = dst;
+    work.blocking = blocking;
+    cq.run_work(std::move(work));
 }
 
 void EnqueueWriteBuffer(CommandQueue& cq, Buffer& buffer, const void* src, bool blocking) {
     ZoneScoped;
     tt_metal::detail::DispatchStateCheck(true);
-    cq.enqueue_write_buffer(buffer, src, blocking);
+    CommandQueueWork work;
+    work.type = CommandQueueWorkType::ENQUEUE_WRITE_BUFFER;
+    work.buffer = &buffer;
+    work.src = src;
+    work.blocking = blocking;
+    cq.run_work(std::move(work));
 }
 
-void EnqueueProgram(CommandQueue& cq, Program& program, bool blocking, std::optional<std::reference_wrapper<Trace>> trace) {
+void EnqueueWriteBufferPages(CommandQueue& cq, Buffer& buffer, const void* src, uint32_t dst_page_index, uint32_t num_pages, bool blocking) {
     ZoneScoped;
-    TT_ASSERT(cq.id == 0, "EnqueueProgram only supported on first command queue on device for time being.");
+    tt_metal::detail::DispatchStateCheck(true);
+    // Sharded buffers are reordered on host as a whole, so they can only be written in one go
+    TT_FATAL(not is_sharded(buffer.buffer_layout()), "Writing a range of pages is only supported for interleaved buffers");
+    TT_FATAL(
+        dst_page_index + num_pages <= buffer.num_pages(),
+        "Cannot write pages [{}, {}) to a buffer with {} pages", dst_page_index, dst_page_index + num_pages, buffer.num_pages());
+    CommandQueueWork work;
+    work.type = CommandQueueWorkType::ENQUEUE_WRITE_BUFFER_PAGES;
+    work.buffer = &buffer;
+    work.src = src;
+    work.page_index = dst_page_index;
+    work.num_pages = num_pages;
+    work.blocking = blocking;
+    cq.run_work(std::move(work));
+}
+
+void CommandQueue::run_program_work(Program& program, std::shared_ptr<Program> owned_program, bool blocking, std::optional<std::reference_wrapper<Trace>> trace) {
+    TT_ASSERT(this->id == 0, "EnqueueProgram only supported on first command queue on device for time being.");
+    TT_FATAL(not blocking, "EnqueueProgram only has support for non-blocking mode currently");
     detail::DispatchStateCheck(true);
 
-    detail::CompileProgram(cq.device, program);
+    detail::CompileProgram(this->device, program);
 
     program.allocate_circular_buffers();
-    detail::ValidateCircularBufferRegion(program, cq.device);
+    detail::ValidateCircularBufferRegion(program, this->device);
+
+    CommandQueueWork work;
+    work.type = CommandQueueWorkType::ENQUEUE_PROGRAM;
+    work.program = &program;
+    work.owned_program = std::move(owned_program);
+    work.trace = trace;
+    work.blocking = blocking;
+    this->run_work(std::move(work));
+}
 
-    cq.enqueue_program(program, trace, blocking);
+void EnqueueProgram(CommandQueue& cq, Program& program, bool blocking, std::optional<std::reference_wrapper<Trace>> trace) {
+    ZoneScoped;
+    cq.run_program_work(program, nullptr, blocking, trace);
+}
+
+void EnqueueProgram(CommandQueue& cq, std::shared_ptr<Program> program, bool blocking, std::optional<std::reference_wrapper<Trace>> trace) {
+    ZoneScoped;
+    TT_ASSERT(program != nullptr);
+    Program& program_ref = *program;
+    cq.run_program_work(program_ref, std::move(program), blocking, trace);
 }
 
 void Finish(CommandQueue& cq) {
     ZoneScoped;
     tt_metal::detail::DispatchStateCheck(true);
-    cq.finish();
+    CommandQueueWork work;
+    work.type = CommandQueueWorkType::FINISH;
+    work.blocking = true;
+    cq.run_work(std::move(work));
+}
+
+Event EnqueueRecordEvent(CommandQueue& cq) {
+    ZoneScoped;
+    tt_metal::detail::DispatchStateCheck(true);
+    return cq.record_event();
+}
+
+void EventSynchronize(const Event& event) {
+    ZoneScoped;
+    if (event.future.valid()) {
+        event.future.get();
+    }
+}
+
+bool EventQuery(const Event& event) {
+    return not event.future.valid() or event.future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
 }
 
 void ClearProgramCache(CommandQueue& cq) {
     detail::DispatchStateCheck(true);
+    cq.wait_for_worker();
     cq.program_to_buffer(cq.device->id()).clear();
     cq.program_to_dev_map(cq.device->id()).clear();
 }
 
+void EvictProgram(CommandQueue& cq, const Program& program) {
+    detail::DispatchStateCheck(true);
+    cq.wait_for_worker();
+    auto& program_to_buffer = cq.program_to_buffer(cq.device->id());
+    if (program_to_buffer.count(program.get_id()) == 0) {
+        return;
+    }
+    // The device may still be reading the program's binaries out of its buffer, which is freed by the next finish
+    cq.evicted_program_buffers.push_back(std::move(program_to_buffer.at(program.get_id())));
+    program_to_buffer.erase(program.get_id());
+    cq.program_to_dev_map(cq.device->id()).erase(program.get_id());
+    if (cq.evicted_program_buffers.size() >= CommandQueue::MAX_EVICTED_PROGRAM_BUFFERS) {
+        cq.finish();
+    }
+}
+
 Trace BeginTrace(CommandQueue& command_queue) {
     Finish(command_queue); // Ensures that nothing being executed in command queue prior to beginning our trace
     // Resets the command queue state
@@ -1194,6 +1612,7 @@ void EndTrace(Trace& trace) {
 }
 
 void EnqueueTrace(Trace& trace, bool blocking) {
+    trace.command_queue.wait_for_worker();
     // Run the trace
     trace.command_queue.manager.issue_queue_push_back(trace.num_bytes, false, trace.command_queue.id);
 
@@ -5,13 +5,19 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <exception>
+#include <future>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <utility>
 #include <fstream>
 
 #include "tt_metal/impl/dispatch/command_queue_interface.hpp"
+#include "tt_metal/impl/dispatch/lock_free_queue.hpp"
 #include "jit_build/build.hpp"
 #include "tt_metal/common/base.hpp"
 #include "tt_metal/common/tt_backend_api_types.hpp"
@@ -47,8 +53,26 @@ struct ProgramMap {
     vector<uint32_t> num_transfers_in_runtime_arg_pages;
     vector<uint32_t> num_transfers_in_cb_config_pages;
     vector<uint32_t> num_transfers_in_go_signal_pages;
+    // Runtime args layout version of each kernel when the runtime arg transfers were built. The transfers are
+    // rebuilt when these no longer match the program, the rest of the map is kept.
+    vector<uint32_t> runtime_args_layout_versions;
+    // Assembled on the first enqueue without a stall, later enqueues only patch in the host data address
+    std::optional<DeviceCommand> device_command;
 };
 
+void ConstructRuntimeArgTransfers(const Device* device, const Program& program, ProgramMap& program_map);
+bool RuntimeArgTransfersMatch(const Program& program, const ProgramMap& program_map);
+
+// Pages that are consecutive both in the order the device moves them and in host memory. Width and block sharded
+// buffers are gathered from and scattered into host memory run by run, straight to and from system memory.
+struct PageRun {
+    uint32_t dev_page;
+    uint32_t host_page;
+    uint32_t num_pages;
+};
+
+vector<PageRun> ConstructPageRuns(const vector<uint32_t>& dev_page_to_host_page);
+
 // Only contains the types of commands which are enqueued onto the device
 enum class EnqueueCommandType { ENQUEUE_READ_BUFFER, ENQUEUE_WRITE_BUFFER, ENQUEUE_PROGRAM, FINISH, WRAP, INVALID };
 
@@ -111,6 +135,8 @@ class EnqueueWriteBufferCommand : public Command {
     const void* src;
     uint32_t dst_page_index;
     uint32_t pages_to_write;
+    // When set, src is the start of the buffer's data in host order and pages are gathered from it run by run
+    const vector<PageRun>* page_runs;
     static constexpr EnqueueCommandType type_ = EnqueueCommandType::ENQUEUE_WRITE_BUFFER;
     uint32_t command_queue_id;
    public:
@@ -121,7 +147,8 @@ class EnqueueWriteBufferCommand : public Command {
         const void* src,
         SystemMemoryManager& manager,
         uint32_t dst_page_index = 0,
-        std::optional<uint32_t> pages_to_write = std::nullopt);
+        std::optional<uint32_t> pages_to_write = std::nullopt,
+        const vector<PageRun>* page_runs = nullptr);
 
     const DeviceCommand assemble_device_command(uint32_t src_address);
 
@@ -188,6 +215,61 @@ class EnqueueWrapCommand : public Command {
     EnqueueCommandType type();
 };
 
+// Host side work of an enqueue call, the command queue's worker thread runs it in async mode
+enum class CommandQueueWorkType { ENQUEUE_READ_BUFFER, ENQUEUE_WRITE_BUFFER, ENQUEUE_WRITE_BUFFER_PAGES, ENQUEUE_PROGRAM, FINISH, RECORD_EVENT, STOP, INVALID };
+
+struct CommandQueueWork {
+    CommandQueueWorkType type = CommandQueueWorkType::INVALID;
+    Buffer* buffer = nullptr;
+    const void* src = nullptr;
+    // Copy of a non-blocking write's source in async mode, src points into it
+    std::vector<char> owned_src;
+    void* dst = nullptr;
+    uint32_t page_index = 0;
+    uint32_t num_pages = 0;
+    Program* program = nullptr;
+    // Set when the caller handed the program over, otherwise the caller waits for the worker to be done with it
+    std::shared_ptr<Program> owned_program;
+    std::optional<std::reference_wrapper<Trace>> trace = {};
+    bool blocking = false;
+    // Fulfilled once the work is done, or with the error it raised
+    std::shared_ptr<std::promise<void>> completion;
+};
+
+// Copying a read's data out of the completion region, done on the command queue's completion reader thread so the
+// issuing thread can keep enqueuing commands while the device writes the data
+enum class CompletionReadWorkType { READ_PAGES, WRAP, EVENT, STOP, INVALID };
+
+struct CompletionReadWork {
+    CompletionReadWorkType type = CompletionReadWorkType::INVALID;
+    Buffer* buffer = nullptr;
+    void* dst = nullptr;
+    // Chunk of pages that one read buffer command has the device write at read_addr, starting with page first_page
+    uint32_t first_page = 0;
+    uint32_t read_addr = 0;
+    uint32_t num_pages = 0;
+    // When set, pages are scattered into dst run by run instead of in device order
+    std::shared_ptr<const vector<PageRun>> page_runs;
+    // Fulfilled once the reader is past an event, or with the error it raised
+    std::shared_ptr<std::promise<void>> completion;
+};
+
+// Completes once the host side of every command enqueued before it is done: sources of writes can be reused, reads
+// have landed in their destination and the device has been handed everything else. A default constructed event is
+// already complete.
+class Event {
+   public:
+    Event() = default;
+
+   private:
+    explicit Event(std::shared_future<void> future) : future(std::move(future)) {}
+    std::shared_future<void> future;
+
+    friend class CommandQueue;
+    friend void EventSynchronize(const Event& event);
+    friend bool EventQuery(const Event& event);
+};
+
 // Fwd declares
 namespace detail{
     CommandQueue &GetCommandQueue(Device *device);
@@ -227,6 +309,12 @@ class CommandQueue {
     ~CommandQueue();
 
    private:
+    static constexpr uint32_t WORK_QUEUE_CAPACITY = 1024;
+    static constexpr uint32_t WORKER_BATCH_SIZE = 32;
+    static constexpr uint32_t COMPLETION_READ_QUEUE_CAPACITY = 1024;
+    // Evicting a program finishes the queue once this many evicted program buffers are waiting to be freed
+    static constexpr uint32_t MAX_EVICTED_PROGRAM_BUFFERS = 64;
+
     uint32_t id;
     uint32_t size_B;
 
@@ -237,6 +325,25 @@ class CommandQueue {
 
     Device* device;
 
+    // In async mode enqueue calls only push work onto this ring, the worker thread pops it and does the host side of
+    // the command: program map construction, device command assembly and the writes into system memory. Only one
+    // thread may enqueue into a command queue.
+    bool async_mode;
+    std::unique_ptr<LockFreeSPSCQueue<CommandQueueWork>> work_queue;
+    std::thread worker_thread;
+    // First error raised on the worker, later work fails with it without running
+    std::exception_ptr worker_exception;
+
+    // Read buffer commands are issued without waiting on the device, the completion reader thread waits for each
+    // chunk of data and copies it into the destination. The reader is started by the first read. Only the thread
+    // issuing commands pushes onto the ring and counts the chunks handed to the reader.
+    std::unique_ptr<LockFreeSPSCQueue<CompletionReadWork>> completion_read_queue;
+    std::thread completion_reader_thread;
+    uint64_t num_completion_reads_issued = 0;
+    // Counts only reads that succeeded, after an error the reader stays behind and fails every later event
+    std::atomic<uint64_t> num_completion_reads_done{0};
+    std::exception_ptr completion_reader_exception;
+
     map<uint64_t, unique_ptr<Buffer>>& program_to_buffer(const chip_id_t chip_id) {
         static map<chip_id_t, map<uint64_t, unique_ptr<Buffer>>> chip_to_program_to_buffer;
         if (chip_to_program_to_buffer.count(chip_id)) {
@@ -247,6 +354,9 @@ class CommandQueue {
         return chip_to_program_to_buffer[chip_id];
     }
 
+    // Buffers of evicted programs, kept until a finish shows that the device is done reading them
+    vector<unique_ptr<Buffer>> evicted_program_buffers;
+
     map<uint64_t, ProgramMap>& program_to_dev_map(const chip_id_t chip_id) {
         static map<chip_id_t, map<uint64_t, ProgramMap>> chip_to_program_to_dev_map;
         if (chip_to_program_to_dev_map.count(chip_id)) {
@@ -257,12 +367,34 @@ class CommandQueue {
         return chip_to_program_to_dev_map[chip_id];
     };
 
+    // Runs the work on the caller's thread, or in async mode hands it to the worker. The caller waits for the worker
+    // if the work is blocking or if it reads a program the caller still owns.
+    void run_work(CommandQueueWork work);
+    void run_program_work(Program& program, std::shared_ptr<Program> owned_program, bool blocking, std::optional<std::reference_wrapper<Trace>> trace);
+    void execute_work(const CommandQueueWork& work);
+    void worker_loop();
+    Event record_event();
+    // Returns once the worker is idle, after which the caller may touch the queue's state directly
+    void wait_for_worker();
+
+    void push_completion_read(CompletionReadWork work);
+    void completion_reader_loop();
+    void read_completion_pages(const CompletionReadWork& work);
+    bool completion_reads_pending() const;
+    // Completes once the reader has copied out every read issued so far
+    Event record_completion_event();
+    void wait_for_completion_reader();
+
     void enqueue_command(Command& command, bool blocking);
 
     void enqueue_read_buffer(Buffer& buffer, void* dst, bool blocking);
 
     void enqueue_write_buffer(Buffer& buffer, const void* src, bool blocking);
 
+    void enqueue_write_buffer_pages(Buffer& buffer, const void* src, uint32_t dst_page_index, uint32_t num_pages, bool blocking);
+
+    void write_buffer_pages(Buffer& buffer, const void* src, uint32_t dst_page_index, uint32_t num_pages, bool blocking, const vector<PageRun>* page_runs = nullptr);
+
     void enqueue_program(Program& program, std::optional<std::reference_wrapper<Trace>> trace, bool blocking);
 
     void wait_finish();
@@ -279,9 +411,13 @@ class CommandQueue {
     friend void EnqueueWriteBuffer(CommandQueue& cq, Buffer& buffer, vector<uint32_t>& src, bool blocking);
     friend void EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, void* dst, bool blocking);
     friend void EnqueueWriteBuffer(CommandQueue& cq, Buffer& buffer, const void* src, bool blocking);
+    friend void EnqueueWriteBufferPages(CommandQueue& cq, Buffer& buffer, const void* src, uint32_t dst_page_index, uint32_t num_pages, bool blocking);
     friend void EnqueueProgram(CommandQueue& cq, Program& program, bool blocking, std::optional<std::reference_wrapper<Trace>> trace);
+    friend void EnqueueProgram(CommandQueue& cq, std::shared_ptr<Program> program, bool blocking, std::optional<std::reference_wrapper<Trace>> trace);
     friend void Finish(CommandQueue& cq);
+    friend Event EnqueueRecordEvent(CommandQueue& cq);
     friend void ClearProgramCache(CommandQueue& cq);
+    friend void EvictProgram(CommandQueue& cq, const Program& program);
     friend CommandQueue &detail::GetCommandQueue(Device *device);
 
     // Trace APIs
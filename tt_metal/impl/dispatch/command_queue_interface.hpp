@@ -101,6 +101,8 @@ struct SystemMemoryCQInterface {
 
         this->completion_fifo_rd_ptr = this->issue_fifo_limit;
         this->completion_fifo_rd_toggle = 0;
+        this->completion_fifo_reserve_ptr = this->issue_fifo_limit;
+        this->completion_fifo_reserve_toggle = 0;
     }
 
     // Percentage of the command queue that is dedicated for issuing commands. Issue queue size is rounded to be 32B aligned and remaining space is dedicated for completion queue
@@ -119,6 +121,13 @@ struct SystemMemoryCQInterface {
     const uint32_t completion_fifo_limit;  // Last possible FIFO address
     uint32_t completion_fifo_rd_ptr;
     bool completion_fifo_rd_toggle;
+    // Where the device will write the data of the next read command. Owned by the thread issuing commands and runs
+    // ahead of the read pointer while the data of earlier reads is still being copied out.
+    uint32_t completion_fifo_reserve_ptr;
+    bool completion_fifo_reserve_toggle;
+
+    // The issue limit can be moved for traces, the completion region stays where the dispatch kernels were told it is
+    uint32_t completion_fifo_start() const { return this->completion_fifo_limit - this->completion_fifo_size; }
 };
 
 class SystemMemoryManager {
@@ -170,8 +179,10 @@ class SystemMemoryManager {
         SystemMemoryCQInterface& cq_interface = this->cq_interfaces[cq_id];
         cq_interface.issue_fifo_wr_ptr = (CQ_START + cq_interface.offset) >> 4;  // In 16B words
         cq_interface.issue_fifo_wr_toggle = 0;
-        cq_interface.completion_fifo_rd_ptr = cq_interface.issue_fifo_limit;
+        cq_interface.completion_fifo_rd_ptr = cq_interface.completion_fifo_start();
         cq_interface.completion_fifo_rd_toggle = 0;
+        cq_interface.completion_fifo_reserve_ptr = cq_interface.completion_fifo_start();
+        cq_interface.completion_fifo_reserve_toggle = 0;
     }
 
     void set_custom_issue_limit_for_trace(const uint8_t cq_id, const uint32_t new_limit) {
@@ -203,6 +214,28 @@ class SystemMemoryManager {
         return this->cq_interfaces[cq_id].completion_fifo_rd_ptr << 4;
     }
 
+    uint32_t get_completion_queue_reserve_ptr(const uint8_t cq_id) const {
+        return this->cq_interfaces[cq_id].completion_fifo_reserve_ptr << 4;
+    }
+
+    // Accounts for the data of a read command that was just issued, mirrors how the device advances its write pointer
+    void completion_queue_reserve_back(uint32_t data_size_B, const uint8_t cq_id) {
+        uint32_t data_size_16B = align(data_size_B, 32) >> 4;
+
+        SystemMemoryCQInterface& cq_interface = this->cq_interfaces[cq_id];
+        cq_interface.completion_fifo_reserve_ptr += data_size_16B;
+        if (cq_interface.completion_fifo_reserve_ptr >= cq_interface.completion_fifo_limit) {
+            cq_interface.completion_fifo_reserve_ptr = cq_interface.completion_fifo_start();
+            cq_interface.completion_fifo_reserve_toggle = not cq_interface.completion_fifo_reserve_toggle;
+        }
+    }
+
+    void wrap_completion_queue_reserve_ptr(const uint8_t cq_id) {
+        SystemMemoryCQInterface& cq_interface = this->cq_interfaces[cq_id];
+        cq_interface.completion_fifo_reserve_ptr = cq_interface.completion_fifo_start();
+        cq_interface.completion_fifo_reserve_toggle = not cq_interface.completion_fifo_reserve_toggle;
+    }
+
     void issue_queue_reserve_back(uint32_t cmd_size_B, const uint8_t cq_id) const {
         uint32_t cmd_size_16B = align(cmd_size_B, 32) >> 4;
 
@@ -297,17 +330,26 @@ class SystemMemoryManager {
 
     void wrap_completion_queue_rd_ptr(const uint8_t cq_id) {
         SystemMemoryCQInterface& cq_interface = this->cq_interfaces[cq_id];
-        cq_interface.completion_fifo_rd_ptr = cq_interface.issue_fifo_limit;
+        cq_interface.completion_fifo_rd_ptr = cq_interface.completion_fifo_start();
         cq_interface.completion_fifo_rd_toggle = not cq_interface.completion_fifo_rd_toggle;
     }
 
+    // Waits for the device to process a completion wrap command, so the read pointer can follow it to the start
+    void completion_queue_wait_wrap(const uint8_t cq_id) {
+        const SystemMemoryCQInterface& cq_interface = this->cq_interfaces[cq_id];
+        bool write_toggle;
+        do {
+            write_toggle = get_cq_completion_wr_ptr<true>(this->device_id, cq_id, this->cq_size) >> 31;
+        } while (write_toggle == cq_interface.completion_fifo_rd_toggle);
+    }
+
     void completion_queue_pop_front(uint32_t data_read_B, const uint8_t cq_id) {
         uint32_t data_read_16B = align(data_read_B, 32) >> 4;
 
         SystemMemoryCQInterface& cq_interface = this->cq_interfaces[cq_id];
         cq_interface.completion_fifo_rd_ptr += data_read_16B;
         if (cq_interface.completion_fifo_rd_ptr >= cq_interface.completion_fifo_limit) {
-            cq_interface.completion_fifo_rd_ptr = cq_interface.command_issue_region_size >> 4;
+            cq_interface.completion_fifo_rd_ptr = cq_interface.completion_fifo_start();
             cq_interface.completion_fifo_rd_toggle = not cq_interface.completion_fifo_rd_toggle;
         }
 
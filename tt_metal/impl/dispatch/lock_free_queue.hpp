@@ -0,0 +1,346 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/assert.hpp"
+
+namespace tt::tt_metal {
+
+// Keeps the producer and consumer indices on separate cache lines so they don't bounce between the two sides
+constexpr size_t LOCK_FREE_QUEUE_CACHE_LINE_SIZE = 64;
+
+enum class LockFreeQueueWaitMode {
+    // Spin and then yield for as long as it takes, lowest latency but an idle waiter keeps a core busy
+    SPIN,
+    // Spin and yield for a while, then sleep until the other side makes progress
+    SPIN_THEN_PARK,
+};
+
+// Where a thread waits for a lock-free queue to become non-empty or non-full. The side that makes progress calls
+// notify, which is a fence and a load unless someone is parked.
+class alignas(LOCK_FREE_QUEUE_CACHE_LINE_SIZE) LockFreeQueueWaiter {
+   public:
+    explicit LockFreeQueueWaiter(LockFreeQueueWaitMode mode) : mode(mode) {}
+
+    template <class Ready>
+    void wait(Ready&& ready) {
+        for (uint32_t i = 0; i < NUM_SPINS; i++) {
+            if (ready()) {
+                return;
+            }
+        }
+        for (uint32_t i = 0; i < NUM_YIELDS or this->mode == LockFreeQueueWaitMode::SPIN; i++) {
+            if (ready()) {
+                return;
+            }
+            std::this_thread::yield();
+        }
+
+        std::unique_lock<std::mutex> lock(this->m);
+        // The increment orders before ready's loads, pairing with the fence in notify so that either this sees the
+        // progress or notify sees the parked thread
+        this->num_parked.fetch_add(1, std::memory_order_seq_cst);
+        this->condition.wait(lock, ready);
+        this->num_parked.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void notify() {
+        if (this->mode == LockFreeQueueWaitMode::SPIN) {
+            return;
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (this->num_parked.load(std::memory_order_relaxed) > 0) {
+            // Taking the lock waits out a thread that has registered but not gone to sleep yet
+            std::lock_guard<std::mutex> lock(this->m);
+            this->condition.notify_all();
+        }
+    }
+
+   private:
+    static constexpr uint32_t NUM_SPINS = 64;
+    static constexpr uint32_t NUM_YIELDS = 1024;
+
+    LockFreeQueueWaitMode mode;
+    std::atomic<uint32_t> num_parked{0};
+    std::mutex m;
+    std::condition_variable condition;
+};
+
+inline uint64_t lock_free_queue_num_slots(uint32_t capacity) {
+    TT_FATAL(capacity > 0, "Lock-free queue needs a capacity of at least 1");
+    uint64_t num_slots = 1;
+    while (num_slots < capacity) {
+        num_slots <<= 1;
+    }
+    return num_slots;
+}
+
+// Bounded ring for one producer thread and one consumer thread, neither side takes a lock. Capacity is rounded up to
+// a power of two. Each side caches the other side's index and only reloads it when the ring looks full or empty.
+// Batch calls publish their elements with a single index update.
+template <class T>
+class LockFreeSPSCQueue {
+   public:
+    explicit LockFreeSPSCQueue(uint32_t capacity, LockFreeQueueWaitMode wait_mode = LockFreeQueueWaitMode::SPIN_THEN_PARK) :
+        slots(lock_free_queue_num_slots(capacity)), mask(slots.size() - 1), not_empty(wait_mode), not_full(wait_mode) {}
+
+    LockFreeSPSCQueue(const LockFreeSPSCQueue&) = delete;
+    LockFreeSPSCQueue& operator=(const LockFreeSPSCQueue&) = delete;
+
+    // Producer side
+    bool try_push(T& e) { return this->try_push_batch(&e, 1) == 1; }
+
+    void push(T e) { this->push_batch(&e, 1); }
+
+    // Moves out up to n elements, returns how many were pushed
+    size_t try_push_batch(T* elements, size_t n) {
+        uint64_t tail = this->tail.load(std::memory_order_relaxed);
+        if (this->cached_head + this->slots.size() - tail < n) {
+            this->cached_head = this->head.load(std::memory_order_acquire);
+        }
+        size_t num_pushed = std::min<uint64_t>(n, this->cached_head + this->slots.size() - tail);
+        if (num_pushed == 0) {
+            return 0;
+        }
+        for (size_t i = 0; i < num_pushed; i++) {
+            this->slots[(tail + i) & this->mask] = std::move(elements[i]);
+        }
+        this->tail.store(tail + num_pushed, std::memory_order_release);
+        this->not_empty.notify();
+        return num_pushed;
+    }
+
+    void push_batch(T* elements, size_t n) {
+        while (n > 0) {
+            size_t num_pushed = this->try_push_batch(elements, n);
+            if (num_pushed == 0) {
+                this->not_full.wait([this] { return not this->full(); });
+            }
+            elements += num_pushed;
+            n -= num_pushed;
+        }
+    }
+
+    // Consumer side
+    bool try_pop(T& e) { return this->try_pop_batch(&e, 1) == 1; }
+
+    T pop() {
+        T e;
+        this->pop_batch(&e, 1);
+        return e;
+    }
+
+    // Moves out up to max_elements, returns how many were popped
+    size_t try_pop_batch(T* elements, size_t max_elements) {
+        uint64_t head = this->head.load(std::memory_order_relaxed);
+        if (this->cached_tail - head < max_elements) {
+            this->cached_tail = this->tail.load(std::memory_order_acquire);
+        }
+        size_t num_popped = std::min<uint64_t>(max_elements, this->cached_tail - head);
+        if (num_popped == 0) {
+            return 0;
+        }
+        for (size_t i = 0; i < num_popped; i++) {
+            elements[i] = std::move(this->slots[(head + i) & this->mask]);
+        }
+        this->head.store(head + num_popped, std::memory_order_release);
+        this->not_full.notify();
+        return num_popped;
+    }
+
+    // Waits for at least one element
+    size_t pop_batch(T* elements, size_t max_elements) {
+        size_t num_popped;
+        while ((num_popped = this->try_pop_batch(elements, max_elements)) == 0) {
+            this->not_empty.wait([this] { return not this->empty(); });
+        }
+        return num_popped;
+    }
+
+    // Only a snapshot when the other side is running
+    size_t size() const { return this->tail.load(std::memory_order_acquire) - this->head.load(std::memory_order_acquire); }
+    bool empty() const { return this->size() == 0; }
+    bool full() const { return this->size() == this->slots.size(); }
+    size_t capacity() const { return this->slots.size(); }
+
+   private:
+    std::vector<T> slots;
+    uint64_t mask;
+
+    // Next slot to pop, written by the consumer
+    alignas(LOCK_FREE_QUEUE_CACHE_LINE_SIZE) std::atomic<uint64_t> head{0};
+    uint64_t cached_tail = 0;
+    // Next slot to push, written by the producer
+    alignas(LOCK_FREE_QUEUE_CACHE_LINE_SIZE) std::atomic<uint64_t> tail{0};
+    uint64_t cached_head = 0;
+
+    LockFreeQueueWaiter not_empty;
+    LockFreeQueueWaiter not_full;
+};
+
+// Bounded ring for any number of producer threads and one consumer thread. Producers claim slots by advancing the
+// tail with a CAS, and each slot carries a sequence number that tells whether it is free for the position being
+// pushed or holds the element the consumer is waiting for, so a producer that stalls between claiming and filling
+// its slot only holds up the consumer at that slot.
+template <class T>
+class LockFreeMPSCQueue {
+   public:
+    explicit LockFreeMPSCQueue(uint32_t capacity, LockFreeQueueWaitMode wait_mode = LockFreeQueueWaitMode::SPIN_THEN_PARK) :
+        slots(new Slot[lock_free_queue_num_slots(capacity)]),
+        num_slots(lock_free_queue_num_slots(capacity)),
+        mask(num_slots - 1),
+        not_empty(wait_mode),
+        not_full(wait_mode) {
+        for (uint64_t i = 0; i < this->num_slots; i++) {
+            this->slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    LockFreeMPSCQueue(const LockFreeMPSCQueue&) = delete;
+    LockFreeMPSCQueue& operator=(const LockFreeMPSCQueue&) = delete;
+
+    // Producer side, any thread
+    bool try_push(T& e) {
+        uint64_t tail = this->tail.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &this->slots[tail & this->mask];
+            int64_t diff = int64_t(slot->sequence.load(std::memory_order_acquire)) - int64_t(tail);
+            if (diff == 0) {
+                if (this->tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // Slot still holds the element from the previous lap
+                return false;
+            } else {
+                tail = this->tail.load(std::memory_order_relaxed);
+            }
+        }
+        slot->value = std::move(e);
+        slot->sequence.store(tail + 1, std::memory_order_release);
+        this->not_empty.notify();
+        return true;
+    }
+
+    void push(T e) {
+        while (not this->try_push(e)) {
+            this->not_full.wait([this] { return not this->full(); });
+        }
+    }
+
+    // Claims up to n consecutive slots with one CAS and moves the elements into them, returns how many were pushed
+    size_t try_push_batch(T* elements, size_t n) {
+        uint64_t tail = this->tail.load(std::memory_order_relaxed);
+        size_t num_pushed;
+        while (true) {
+            // The consumer frees slots in order, so everything below head + num_slots is free once it's claimed
+            uint64_t limit = this->head.load(std::memory_order_acquire) + this->num_slots;
+            num_pushed = limit > tail ? std::min<uint64_t>(n, limit - tail) : 0;
+            if (num_pushed == 0) {
+                return 0;
+            }
+            if (this->tail.compare_exchange_weak(tail, tail + num_pushed, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        for (size_t i = 0; i < num_pushed; i++) {
+            Slot& slot = this->slots[(tail + i) & this->mask];
+            slot.value = std::move(elements[i]);
+            slot.sequence.store(tail + i + 1, std::memory_order_release);
+        }
+        this->not_empty.notify();
+        return num_pushed;
+    }
+
+    void push_batch(T* elements, size_t n) {
+        while (n > 0) {
+            size_t num_pushed = this->try_push_batch(elements, n);
+            if (num_pushed == 0) {
+                this->not_full.wait([this] { return not this->full(); });
+            }
+            elements += num_pushed;
+            n -= num_pushed;
+        }
+    }
+
+    // Consumer side, one thread
+    bool try_pop(T& e) { return this->try_pop_batch(&e, 1) == 1; }
+
+    T pop() {
+        T e;
+        this->pop_batch(&e, 1);
+        return e;
+    }
+
+    // Moves out up to max_elements, stopping at the first slot that hasn't been filled yet
+    size_t try_pop_batch(T* elements, size_t max_elements) {
+        uint64_t head = this->head.load(std::memory_order_relaxed);
+        size_t num_popped = 0;
+        while (num_popped < max_elements) {
+            Slot& slot = this->slots[(head + num_popped) & this->mask];
+            if (slot.sequence.load(std::memory_order_acquire) != head + num_popped + 1) {
+                break;
+            }
+            elements[num_popped] = std::move(slot.value);
+            slot.sequence.store(head + num_popped + this->num_slots, std::memory_order_release);
+            num_popped++;
+        }
+        if (num_popped > 0) {
+            this->head.store(head + num_popped, std::memory_order_release);
+            this->not_full.notify();
+        }
+        return num_popped;
+    }
+
+    // Waits for at least one element
+    size_t pop_batch(T* elements, size_t max_elements) {
+        size_t num_popped;
+        while ((num_popped = this->try_pop_batch(elements, max_elements)) == 0) {
+            this->not_empty.wait([this] { return this->front_ready(); });
+        }
+        return num_popped;
+    }
+
+    // Only a snapshot when producers are running, counts slots that are claimed but not filled yet
+    size_t size() const { return this->tail.load(std::memory_order_acquire) - this->head.load(std::memory_order_acquire); }
+    bool empty() const { return this->size() == 0; }
+    bool full() const { return this->size() >= this->num_slots; }
+    size_t capacity() const { return this->num_slots; }
+
+   private:
+    struct alignas(LOCK_FREE_QUEUE_CACHE_LINE_SIZE) Slot {
+        std::atomic<uint64_t> sequence;
+        T value;
+    };
+
+    bool front_ready() const {
+        uint64_t head = this->head.load(std::memory_order_relaxed);
+        return this->slots[head & this->mask].sequence.load(std::memory_order_acquire) == head + 1;
+    }
+
+    std::unique_ptr<Slot[]> slots;
+    uint64_t num_slots;
+    uint64_t mask;
+
+    // Next slot to pop, written by the consumer
+    alignas(LOCK_FREE_QUEUE_CACHE_LINE_SIZE) std::atomic<uint64_t> head{0};
+    // Next slot to claim, advanced by producers
+    alignas(LOCK_FREE_QUEUE_CACHE_LINE_SIZE) std::atomic<uint64_t> tail{0};
+
+    LockFreeQueueWaiter not_empty;
+    LockFreeQueueWaiter not_full;
+};
+
+}  // namespace tt::tt_metal
@@ -2,10 +2,15 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#pragma once
+
+#include <condition_variable>
 #include <mutex>
 #include <thread>
 #include <queue>
 
+// Mutex based queue, see lock_free_queue.hpp for the bounded rings the dispatch path uses
+
 template <class T>
 class TSQueue {
     public:
@@ -75,4 +80,7 @@ void TSQueue<T>::pop() {
 }
 
 template <class T>
-size_t TSQueue<T>::size() { return this->q.size(); }
+size_t TSQueue<T>::size() {
+    std::unique_lock<std::mutex> lock(this->m);
+    return this->q.size();
+}
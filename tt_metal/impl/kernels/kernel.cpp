@@ -8,6 +8,8 @@
 #include "llrt/llrt.hpp"
 
 #include <fmt/ranges.h>
+#include <algorithm>
+#include <cstring>
 #include <set>
 #include <unordered_set>
 
@@ -24,7 +26,11 @@ Kernel::Kernel(const std::string &kernel_path_file_name, const CoreRangeSet &cor
     kernel_path_file_name_(kernel_path_file_name),
     core_range_set_(core_range_set),
     binary_size16_(0),
-    compile_time_args_(compile_args), defines_(defines) {
+    compile_time_args_(compile_args),
+    runtime_args_stride_(0),
+    runtime_args_packed_(true),
+    runtime_args_layout_version_(0),
+    defines_(defines) {
     size_t max_x = 0, max_y = 0;
     for (auto core_range : this->core_range_set_.ranges()) {
         auto start = core_range.start;
@@ -38,7 +44,7 @@ Kernel::Kernel(const std::string &kernel_path_file_name, const CoreRangeSet &cor
             }
         }
     }
-    this->core_to_runtime_args_ = { max_x+1, std::vector< std::vector<uint32_t > > (max_y+1, std::vector<uint32_t>() ) };
+    this->core_to_runtime_args_ = { max_x+1, std::vector<RuntimeArgsData>(max_y+1) };
 }
 
 std::string Kernel::name() const {
@@ -144,12 +150,12 @@ std::string Kernel::compute_hash() const {
 
 void Kernel::update_runtime_arg( const CoreCoord &logical_core, size_t idx, uint32_t value){
     ZoneScoped;
-    auto & v = this->core_to_runtime_args_[logical_core.x][logical_core.y];
+    auto & v = this->runtime_args(logical_core);
     TT_ASSERT( idx < v.size(), "Runtime arg offset {} for Core {} out of bounds", idx, logical_core.str());
     v[idx] = value;
 }
 
-std::vector<uint32_t>& Kernel::runtime_args(const CoreCoord &logical_core) {
+RuntimeArgsData& Kernel::runtime_args(const CoreCoord &logical_core) {
     // TODO (abhullar): Should this check only be enabled in debug mode?
     TT_FATAL( logical_core.x < this->core_to_runtime_args_.size() && logical_core.y < this->core_to_runtime_args_[logical_core.x].size(), "Cannot get runtime args for kernel {} that is not placed on core {}", this->name(), logical_core.str());
     return this->core_to_runtime_args_[logical_core.x][logical_core.y];
@@ -184,24 +190,84 @@ std::pair<uint64_t, uint64_t> ComputeKernel::get_runtime_args_range() const {
     return arg_base_to_result_base;
 }
 
-void Kernel::set_runtime_args(const CoreCoord &logical_core, const std::vector<uint32_t> &runtime_args) {
-    auto validate_runtime_args_size = [&]() {
-        uint32_t runtime_args_size = runtime_args.size() * sizeof(uint32_t);
-        auto[l1_arg_base, result_base] = this->get_runtime_args_range();
-        if (l1_arg_base + runtime_args_size >= result_base) {
-            TT_THROW(std::to_string(runtime_args_size / 1024) + "KB runtime args targeting kernel " + this->name() + " on " + logical_core.str() + " are too large.\
-                Cannot be written as they will run into memory region reserved for result. Max allowable size is " + std::to_string((result_base - l1_arg_base)/1024) + " KB.");
-        }
-    };
+void Kernel::validate_runtime_args_size(const CoreCoord &logical_core, uint32_t num_runtime_args) const {
+    uint32_t runtime_args_size = num_runtime_args * sizeof(uint32_t);
+    auto[l1_arg_base, result_base] = this->get_runtime_args_range();
+    if (l1_arg_base + runtime_args_size >= result_base) {
+        TT_THROW(std::to_string(runtime_args_size / 1024) + "KB runtime args targeting kernel " + this->name() + " on " + logical_core.str() + " are too large.\
+            Cannot be written as they will run into memory region reserved for result. Max allowable size is " + std::to_string((result_base - l1_arg_base)/1024) + " KB.");
+    }
+}
 
+void Kernel::allocate_runtime_args(const std::vector<CoreCoord> &logical_cores, uint32_t num_runtime_args) {
     // TODO (abhullar): If we don't include this check then user can write runtime args to a core that the kernel is not placed on.
     //                  Should this check only be enabled in debug mode?
     // TT_FATAL(this->is_on_logical_core(logical_core), "Cannot set runtime args for core {} since kernel {} is not placed on it!", logical_core.str(), this->name());
-    validate_runtime_args_size();
-    auto &set_rt_args = this->core_to_runtime_args_[logical_core.x][logical_core.y];
-    TT_ASSERT(set_rt_args.empty() or set_rt_args.size() == runtime_args.size(), "Illegal Runtime Args: Number of runtime args cannot be modified!");
-    set_rt_args = runtime_args;
-    this->core_with_runtime_args_.insert( logical_core );
+    size_t num_slots = this->core_with_runtime_args_.size();
+    bool layout_changed = false;
+    for (const auto &logical_core : logical_cores) {
+        auto &rt_args = this->runtime_args(logical_core);
+        if (not rt_args.allocated_) {
+            rt_args.allocated_ = true;
+            this->core_with_runtime_args_.push_back(logical_core);
+        } else if (rt_args.size_ == num_runtime_args) {
+            continue;
+        }
+        TT_ASSERT(rt_args.size_ == 0 or rt_args.size_ == num_runtime_args, "Illegal Runtime Args: Number of runtime args cannot be modified!");
+        rt_args.size_ = num_runtime_args;
+        layout_changed = true;
+    }
+    if (not layout_changed) {
+        return;
+    }
+
+    // Slots are 16B aligned, the alignment the dispatcher packs the args of consecutive cores at
+    uint32_t stride = std::max(this->runtime_args_stride_, align(num_runtime_args, 16 / sizeof(uint32_t)));
+    if (stride == this->runtime_args_stride_) {
+        this->runtime_args_data_.resize(this->core_with_runtime_args_.size() * stride, 0);
+    } else {
+        std::vector<uint32_t> runtime_args_data(this->core_with_runtime_args_.size() * stride, 0);
+        for (size_t slot = 0; slot < num_slots; slot++) {
+            std::copy_n(this->runtime_args_data_.begin() + slot * this->runtime_args_stride_, this->runtime_args_stride_, runtime_args_data.begin() + slot * stride);
+        }
+        this->runtime_args_data_ = std::move(runtime_args_data);
+        this->runtime_args_stride_ = stride;
+    }
+
+    this->runtime_args_packed_ = true;
+    for (size_t slot = 0; slot < this->core_with_runtime_args_.size(); slot++) {
+        auto &rt_args = this->runtime_args(this->core_with_runtime_args_[slot]);
+        rt_args.data_ = this->runtime_args_data_.data() + slot * stride;
+        this->runtime_args_packed_ &= align(rt_args.size_, 16 / sizeof(uint32_t)) == stride;
+    }
+    this->runtime_args_layout_version_++;
+}
+
+void Kernel::set_runtime_args(const CoreCoord &logical_core, const std::vector<uint32_t> &runtime_args) {
+    this->set_runtime_args(std::vector<CoreCoord>{logical_core}, runtime_args.data(), runtime_args.size(), 0);
+}
+
+void Kernel::set_runtime_args(const std::vector<CoreCoord> &logical_cores, const uint32_t *runtime_args, uint32_t num_runtime_args, uint32_t stride) {
+    if (logical_cores.empty()) {
+        return;
+    }
+    this->validate_runtime_args_size(logical_cores.front(), num_runtime_args);
+    // The source may be runtime args of this kernel, which allocating can move. Copy it out of the way first
+    std::vector<uint32_t> source_copy;
+    const uint32_t *data_begin = this->runtime_args_data_.data();
+    const uint32_t *data_end = data_begin + this->runtime_args_data_.size();
+    if (num_runtime_args != 0 and runtime_args >= data_begin and runtime_args < data_end) {
+        source_copy.assign(runtime_args, runtime_args + (logical_cores.size() - 1) * stride + num_runtime_args);
+        runtime_args = source_copy.data();
+    }
+    this->allocate_runtime_args(logical_cores, num_runtime_args);
+    if (num_runtime_args == 0) {
+        return;
+    }
+    for (size_t i = 0; i < logical_cores.size(); i++) {
+        // The source may still be a core's own runtime args if they were not moved
+        std::memmove(this->runtime_args(logical_cores[i]).data(), runtime_args + i * stride, num_runtime_args * sizeof(uint32_t));
+    }
 }
 
 void DataMovementKernel::set_build_options(JitBuildOptions& build_options) const {
@@ -12,6 +12,7 @@
 #include <memory>
 
 #include "jit_build/build.hpp"
+#include "common/assert.hpp"
 #include "common/base_types.hpp"
 #include "tt_metal/impl/device/device.hpp"
 #include "tt_metal/impl/kernels/kernel_types.hpp"
@@ -23,6 +24,37 @@ namespace tt_metal {
 
 using Config = std::variant<DataMovementConfig, experimental::EthernetConfig, ComputeConfig>;
 
+// Runtime args of one core, a view into the kernel's runtime arg storage. The view held by the kernel is kept up
+// to date, copies of it are invalidated once another core of the kernel gets runtime args.
+class RuntimeArgsData {
+   public:
+    uint32_t &operator[](size_t idx) {
+        TT_ASSERT(idx < this->size_, "Runtime arg offset {} out of bounds, {} runtime args", idx, this->size_);
+        return this->data_[idx];
+    }
+    const uint32_t &operator[](size_t idx) const {
+        TT_ASSERT(idx < this->size_, "Runtime arg offset {} out of bounds, {} runtime args", idx, this->size_);
+        return this->data_[idx];
+    }
+    uint32_t &at(size_t idx) {
+        TT_FATAL(idx < this->size_, "Runtime arg offset {} out of bounds, {} runtime args", idx, this->size_);
+        return this->data_[idx];
+    }
+    size_t size() const { return this->size_; }
+    uint32_t *data() { return this->data_; }
+    const uint32_t *data() const { return this->data_; }
+    uint32_t *begin() { return this->data_; }
+    uint32_t *end() { return this->data_ + this->size_; }
+    const uint32_t *begin() const { return this->data_; }
+    const uint32_t *end() const { return this->data_ + this->size_; }
+
+   private:
+    friend class Kernel;
+    uint32_t *data_ = nullptr;
+    size_t size_ = 0;
+    bool allocated_ = false;
+};
+
 class Kernel : public JitBuildSettings {
    public:
     Kernel(const std::string &kernel_path_file_name, const CoreRangeSet &core_range_set, const std::vector<uint32_t> &compile_args, const std::map<std::string, std::string>&defines);
@@ -45,11 +77,21 @@ class Kernel : public JitBuildSettings {
 
     std::vector<uint32_t> compile_time_args() const { return compile_time_args_; }
 
-    const std::unordered_set<CoreCoord>& cores_with_runtime_args() const { return core_with_runtime_args_; }
+    // In the order their runtime args are stored
+    const std::vector<CoreCoord>& cores_with_runtime_args() const { return core_with_runtime_args_; }
 
     void update_runtime_arg( const CoreCoord &logical_core, size_t idx, uint32_t value);
 
-    std::vector<uint32_t> & runtime_args(const CoreCoord &logical_core);
+    RuntimeArgsData & runtime_args(const CoreCoord &logical_core);
+
+    // Runtime args of every core in cores_with_runtime_args() order, runtime_args_stride() words apart
+    const std::vector<uint32_t> &runtime_args_data() const { return runtime_args_data_; }
+    uint32_t runtime_args_stride() const { return runtime_args_stride_; }
+    // True when every core's runtime args fill its stride once padded to 16B, so runtime_args_data() can be copied
+    // as is wherever the args of consecutive cores are packed at 16B alignment
+    bool runtime_args_packed() const { return runtime_args_packed_; }
+    // Changes whenever a core gets runtime args for the first time or the layout of runtime_args_data() changes
+    uint32_t runtime_args_layout_version() const { return runtime_args_layout_version_; }
 
     std::map<std::string, std::string> defines() const { return defines_; }
 
@@ -68,6 +110,9 @@ class Kernel : public JitBuildSettings {
     virtual void read_binaries(Device *device) = 0;
 
     void set_runtime_args(const CoreCoord &logical_core, const std::vector<uint32_t> &runtime_args);
+    // Sets num_runtime_args args on each core, the args of logical_cores[i] start at runtime_args + i * stride. A
+    // stride of 0 gives every core the same args.
+    void set_runtime_args(const std::vector<CoreCoord> &logical_cores, const uint32_t *runtime_args, uint32_t num_runtime_args, uint32_t stride);
 
     int get_watcher_kernel_id() { return watcher_kernel_id_; }
 
@@ -89,8 +134,12 @@ class Kernel : public JitBuildSettings {
     std::unordered_map<chip_id_t, std::vector<ll_api::memory>> binaries_;
     uint16_t binary_size16_;
     std::vector<uint32_t> compile_time_args_;
-    std::vector< std::vector< std::vector<uint32_t>> > core_to_runtime_args_;
-    std::unordered_set<CoreCoord> core_with_runtime_args_;
+    std::vector<uint32_t> runtime_args_data_;           // One slot of runtime_args_stride_ words per core
+    uint32_t runtime_args_stride_;                      // Most runtime args of any core, rounded up to 16B
+    bool runtime_args_packed_;
+    uint32_t runtime_args_layout_version_;
+    std::vector< std::vector<RuntimeArgsData> > core_to_runtime_args_;
+    std::vector<CoreCoord> core_with_runtime_args_;
     std::map<std::string, std::string> defines_;        // preprocessor defines. this is to be able to generate generic instances.
     std::set<CoreCoord> logical_cores_;
 
@@ -99,6 +148,11 @@ class Kernel : public JitBuildSettings {
     virtual std::string config_hash() const = 0;
 
     virtual std::pair<uint64_t, uint64_t> get_runtime_args_range() const = 0;
+
+   private:
+    void validate_runtime_args_size(const CoreCoord &logical_core, uint32_t num_runtime_args) const;
+    // Gives each core a slot for its runtime args if it has none, growing the stride as needed
+    void allocate_runtime_args(const std::vector<CoreCoord> &logical_cores, uint32_t num_runtime_args);
 };
 
 class DataMovementKernel : public Kernel {
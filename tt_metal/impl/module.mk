@@ -10,7 +10,11 @@ TT_METAL_IMPL_SRCS = \
 	tt_metal/impl/buffers/semaphore.cpp \
 	tt_metal/impl/kernels/kernel.cpp \
 	tt_metal/impl/allocator/algorithms/free_list.cpp \
+	tt_metal/impl/allocator/algorithms/indexed_free_list.cpp \
 	tt_metal/impl/allocator/allocator.cpp \
+	tt_metal/impl/allocator/allocator_trace.cpp \
+	tt_metal/impl/allocator/arena.cpp \
+	tt_metal/impl/allocator/compaction.cpp \
 	tt_metal/impl/allocator/basic_allocator.cpp \
 	tt_metal/impl/allocator/l1_banking_allocator.cpp \
 	tt_metal/impl/program/program.cpp \
@@ -0,0 +1,276 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "jit_build/binary_cache.hpp"
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include "common/assert.hpp"
+#include "common/logger.hpp"
+
+namespace fs = std::filesystem;
+
+namespace tt::tt_metal {
+
+namespace {
+
+constexpr std::array<uint32_t, 64> SHA256_ROUND_CONSTANTS = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+inline uint32_t rotr(uint32_t x, uint32_t n) { return (x >> n) | (x << (32 - n)); }
+
+// Per thread and process suffix for files that are renamed into place
+std::string unique_suffix() {
+    return "." + std::to_string(getpid()) + "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp";
+}
+
+// flock on the cache's root lock file, shared to read or publish entries and exclusive to evict them
+class RootLock {
+  public:
+    RootLock(const std::string &root, int operation) {
+        this->fd_ = open((root + "/cache.lock").c_str(), O_RDWR | O_CREAT, 0666);
+        TT_FATAL(this->fd_ >= 0, "Cannot open kernel binary cache lock under {}", root);
+        flock(this->fd_, operation);
+    }
+    ~RootLock() {
+        flock(this->fd_, LOCK_UN);
+        close(this->fd_);
+    }
+
+  private:
+    int fd_;
+};
+
+}  // namespace
+
+JitBuildDigest::JitBuildDigest() :
+    state_({0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19}),
+    buffer_size_(0),
+    total_size_(0) {}
+
+void JitBuildDigest::process_block(const uint8_t *block) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++) {
+        w[i] = (uint32_t(block[4 * i]) << 24) | (uint32_t(block[4 * i + 1]) << 16) | (uint32_t(block[4 * i + 2]) << 8) | uint32_t(block[4 * i + 3]);
+    }
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = state_[0], b = state_[1], c = state_[2], d = state_[3], e = state_[4], f = state_[5], g = state_[6], h = state_[7];
+    for (int i = 0; i < 64; i++) {
+        uint32_t s1 = rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+        uint32_t ch = (e & f) ^ (~e & g);
+        uint32_t t1 = h + s1 + ch + SHA256_ROUND_CONSTANTS[i] + w[i];
+        uint32_t s0 = rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+        uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+        uint32_t t2 = s0 + maj;
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    state_[0] += a; state_[1] += b; state_[2] += c; state_[3] += d;
+    state_[4] += e; state_[5] += f; state_[6] += g; state_[7] += h;
+}
+
+void JitBuildDigest::update(const void *data, size_t size) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    total_size_ += size;
+    while (size > 0) {
+        size_t n = std::min(size, buffer_.size() - buffer_size_);
+        std::memcpy(buffer_.data() + buffer_size_, bytes, n);
+        buffer_size_ += n;
+        bytes += n;
+        size -= n;
+        if (buffer_size_ == buffer_.size()) {
+            process_block(buffer_.data());
+            buffer_size_ = 0;
+        }
+    }
+}
+
+void JitBuildDigest::update(const std::string &str) {
+    uint64_t size = str.size();
+    update(&size, sizeof(size));
+    update(str.data(), str.size());
+}
+
+void JitBuildDigest::update_file(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (not file.is_open()) {
+        update(std::string("<missing>"));
+        return;
+    }
+    std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    update(contents);
+}
+
+std::string JitBuildDigest::hex_digest() {
+    uint64_t total_bits = total_size_ * 8;
+    uint8_t padding[72] = {0x80};
+    size_t padding_size = (buffer_size_ < 56 ? 56 : 120) - buffer_size_;
+    update(padding, padding_size);
+    uint8_t length[8];
+    for (int i = 0; i < 8; i++) {
+        length[i] = static_cast<uint8_t>(total_bits >> (56 - 8 * i));
+    }
+    update(length, sizeof(length));
+
+    static const char *hex_chars = "0123456789abcdef";
+    std::string hex;
+    for (uint32_t word : state_) {
+        for (int shift = 28; shift >= 0; shift -= 4) {
+            hex += hex_chars[(word >> shift) & 0xf];
+        }
+    }
+    return hex;
+}
+
+JitBinaryCache::EntryLock::EntryLock(const std::string &path) {
+    this->fd_ = open(path.c_str(), O_RDWR | O_CREAT, 0666);
+    TT_FATAL(this->fd_ >= 0, "Cannot open kernel binary cache lock {}", path);
+    flock(this->fd_, LOCK_EX);
+}
+
+JitBinaryCache::EntryLock::~EntryLock() {
+    flock(this->fd_, LOCK_UN);
+    close(this->fd_);
+}
+
+JitBinaryCache::JitBinaryCache(const std::string &root, uint64_t max_size_bytes) :
+    root_(root), max_size_bytes_(max_size_bytes) {
+    fs::create_directories(root_ + "/entries");
+    fs::create_directories(root_ + "/tmp");
+    fs::create_directories(root_ + "/locks");
+}
+
+std::unique_ptr<JitBinaryCache::EntryLock> JitBinaryCache::lock_entry(const std::string &digest) const {
+    return std::make_unique<EntryLock>(root_ + "/locks/" + digest + ".lock");
+}
+
+bool JitBinaryCache::fetch(const std::string &digest, const std::string &out_dir, const std::vector<std::string> &file_names) const {
+    RootLock lock(root_, LOCK_SH);
+    fs::path entry = root_ + "/entries/" + digest;
+    try {
+        for (const auto &file_name : file_names) {
+            if (not fs::exists(entry / file_name)) {
+                return false;
+            }
+        }
+        fs::create_directories(out_dir);
+        std::string suffix = unique_suffix();
+        for (const auto &file_name : file_names) {
+            // Another process may be loading the same output directory, don't let it see a partial file
+            fs::path temp_path = fs::path(out_dir) / (file_name + suffix);
+            fs::copy_file(entry / file_name, temp_path, fs::copy_options::overwrite_existing);
+            fs::rename(temp_path, fs::path(out_dir) / file_name);
+        }
+        fs::last_write_time(entry, fs::file_time_type::clock::now());
+    } catch (const fs::filesystem_error &e) {
+        log_warning(tt::LogBuildKernels, "Cannot fetch {} from the kernel binary cache: {}", digest, e.what());
+        return false;
+    }
+    return true;
+}
+
+void JitBinaryCache::publish(const std::string &digest, const std::string &out_dir, const std::vector<std::string> &file_names) const {
+    {
+        RootLock lock(root_, LOCK_SH);
+        fs::path entry = root_ + "/entries/" + digest;
+        fs::path temp_entry = root_ + "/tmp/" + digest + unique_suffix();
+        try {
+            if (fs::exists(entry)) {
+                return;
+            }
+            fs::remove_all(temp_entry);
+            fs::create_directories(temp_entry);
+            for (const auto &file_name : file_names) {
+                fs::copy_file(fs::path(out_dir) / file_name, temp_entry / file_name);
+            }
+            // Renaming the whole directory makes the entry appear with all of its files at once
+            std::error_code ec;
+            fs::rename(temp_entry, entry, ec);
+            if (ec) {
+                // Published by someone else in the meantime
+                fs::remove_all(temp_entry);
+            }
+        } catch (const fs::filesystem_error &e) {
+            log_warning(tt::LogBuildKernels, "Cannot publish {} to the kernel binary cache: {}", digest, e.what());
+            std::error_code ec;
+            fs::remove_all(temp_entry, ec);
+            return;
+        }
+    }
+    if (this->size_bytes() > max_size_bytes_) {
+        this->evict();
+    }
+}
+
+uint64_t JitBinaryCache::size_bytes() const {
+    uint64_t size = 0;
+    std::error_code ec;
+    for (auto it = fs::recursive_directory_iterator(root_ + "/entries", ec); it != fs::recursive_directory_iterator(); it.increment(ec)) {
+        if (ec) {
+            break;
+        }
+        if (it->is_regular_file(ec)) {
+            size += it->file_size(ec);
+        }
+    }
+    return size;
+}
+
+void JitBinaryCache::evict() const {
+    RootLock lock(root_, LOCK_EX);
+    struct Entry {
+        fs::path path;
+        fs::file_time_type last_used;
+        uint64_t size;
+    };
+    std::vector<Entry> entries;
+    uint64_t total_size = 0;
+    std::error_code ec;
+    for (const auto &dir : fs::directory_iterator(root_ + "/entries", ec)) {
+        Entry entry = {.path = dir.path(), .last_used = fs::last_write_time(dir.path(), ec), .size = 0};
+        for (const auto &file : fs::directory_iterator(dir.path(), ec)) {
+            entry.size += file.file_size(ec);
+        }
+        total_size += entry.size;
+        entries.push_back(entry);
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) { return a.last_used < b.last_used; });
+    for (const auto &entry : entries) {
+        if (total_size <= max_size_bytes_) {
+            break;
+        }
+        log_debug(tt::LogBuildKernels, "Evicting {} from the kernel binary cache", entry.path.string());
+        fs::remove_all(entry.path, ec);
+        total_size -= entry.size;
+    }
+}
+
+}  // namespace tt::tt_metal
@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tt::tt_metal {
+
+// SHA-256 of everything passed in, keys the binary cache so it must not change between processes or builds of metal
+class JitBuildDigest {
+  public:
+    JitBuildDigest();
+
+    void update(const void *data, size_t size);
+    // Length prefixed, so consecutive strings can't run into each other
+    void update(const std::string &str);
+    // Hashes the file's contents, or a marker if it can't be read
+    void update_file(const std::string &path);
+
+    // Finishes the digest, nothing can be added after
+    std::string hex_digest();
+
+  private:
+    void process_block(const uint8_t *block);
+
+    std::array<uint32_t, 8> state_;
+    std::array<uint8_t, 64> buffer_;
+    size_t buffer_size_;
+    uint64_t total_size_;
+};
+
+// Binaries of kernel builds keyed by a digest of everything that goes into the build, shared by every device and
+// process on the host. Entries are built in a private directory and renamed into place so they appear whole, and
+// the least recently used entries are evicted once the cache grows past its size cap.
+//
+// Layout under the root:
+//   entries/<digest>/<files>   published binaries, the directory's mtime is bumped on every hit
+//   tmp/                       entries being published
+//   locks/<digest>.lock        flock held while an entry is looked up and built
+//   cache.lock                 flock held shared to read or publish entries, exclusive to evict
+class JitBinaryCache {
+  public:
+    // Exclusive lock on one digest across every thread and process, released when destroyed
+    class EntryLock {
+      public:
+        explicit EntryLock(const std::string &path);
+        ~EntryLock();
+        EntryLock(const EntryLock &) = delete;
+        EntryLock &operator=(const EntryLock &) = delete;
+
+      private:
+        int fd_;
+    };
+
+    JitBinaryCache(const std::string &root, uint64_t max_size_bytes);
+
+    const std::string &get_root() const { return root_; }
+    uint64_t get_max_size_bytes() const { return max_size_bytes_; }
+
+    // Blocks while another thread or process holds the lock, typically while it builds the entry
+    std::unique_ptr<EntryLock> lock_entry(const std::string &digest) const;
+
+    // Copies the entry's files into out_dir, returns false if there is no entry for the digest
+    bool fetch(const std::string &digest, const std::string &out_dir, const std::vector<std::string> &file_names) const;
+
+    // Adds the files in out_dir as the entry for the digest, unless there already is one, then evicts down to the cap
+    void publish(const std::string &digest, const std::string &out_dir, const std::vector<std::string> &file_names) const;
+
+    uint64_t size_bytes() const;
+
+  private:
+    void evict() const;
+
+    std::string root_;
+    uint64_t max_size_bytes_;
+};
+
+}  // namespace tt::tt_metal
@@ -4,10 +4,17 @@
 
 #include <chrono>
 #include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <regex>
+#include <sstream>
 #include <thread>
+#include <unistd.h>
+#include <set>
 #include <string>
 
 #include "jit_build/build.hpp"
+#include "jit_build/binary_cache.hpp"
 #include "jit_build/genfiles.hpp"
 #include "dev_mem_map.h"
 #include "hostdevcommon/common_runtime_address_map.h"
@@ -31,6 +38,112 @@ JitBuildEnv::JitBuildEnv()
 {
 }
 
+JitBuildScheduler& JitBuildEnv::get_build_scheduler()
+{
+    // Shared by every device so the cap applies to the whole process
+    static JitBuildScheduler scheduler(llrt::OptionsG.get_jit_build_jobs());
+    return scheduler;
+}
+
+JitBinaryCache* JitBuildEnv::get_binary_cache()
+{
+    static std::unique_ptr<JitBinaryCache> cache = llrt::OptionsG.get_kernel_binary_cache_dir().empty() ?
+        nullptr :
+        std::make_unique<JitBinaryCache>(llrt::OptionsG.get_kernel_binary_cache_dir(), llrt::OptionsG.get_kernel_binary_cache_size_mb() << 20);
+    return cache.get();
+}
+
+// Digest of the toolchain, and of the firmware sources and linker scripts in the tree that kernels build against.
+// The headers and sources compiled into a kernel are covered by hashing the files its sources include
+static string get_binary_cache_tree_digest(const string& root, const string& gpp)
+{
+    JitBuildDigest digest;
+    string gpp_path = gpp.substr(0, gpp.find_last_not_of(' ') + 1);
+    string version;
+    if (FILE* pipe = popen((gpp_path + " --version 2>&1").c_str(), "r")) {
+        char buf[256];
+        while (fgets(buf, sizeof(buf), pipe) != nullptr) {
+            version += buf;
+        }
+        pclose(pipe);
+    }
+    digest.update(version);
+    // A rebuilt toolchain may keep its version
+    std::error_code ec;
+    uint64_t gpp_size = fs::file_size(gpp_path, ec);
+    int64_t gpp_mtime = fs::last_write_time(gpp_path, ec).time_since_epoch().count();
+    digest.update(&gpp_size, sizeof(gpp_size));
+    digest.update(&gpp_mtime, sizeof(gpp_mtime));
+
+    vector<string> files;
+    for (const char* dir : {"tt_metal/hw", "tt_metal/include", "tt_metal/third_party/sfpi/include"}) {
+        for (auto it = fs::recursive_directory_iterator(root + dir, ec); it != fs::recursive_directory_iterator(); it.increment(ec)) {
+            if (ec) {
+                break;
+            }
+            if (it->is_regular_file(ec)) {
+                files.push_back(it->path().string());
+            }
+        }
+    }
+    std::sort(files.begin(), files.end());
+    for (const string& file : files) {
+        digest.update(file);
+        digest.update_file(file);
+    }
+    return digest.hex_digest();
+}
+
+// A source or header as the binary cache digest sees it: its contents and the files it names in #include directives
+struct JitBuildScannedFile {
+    fs::file_time_type mtime;
+    uintmax_t size;
+    string digest;
+    vector<std::pair<bool, string>> includes;  // Whether the name was quoted, and the name
+};
+
+// Scanned files are kept for the life of the process and rescanned when they change, so warm builds only stat them
+static std::shared_ptr<const JitBuildScannedFile> scan_build_file(const fs::path& path)
+{
+    static std::mutex mutex;
+    static std::unordered_map<string, std::shared_ptr<const JitBuildScannedFile>> scanned;
+
+    std::error_code ec;
+    auto mtime = fs::last_write_time(path, ec);
+    auto size = fs::file_size(path, ec);
+    if (ec) {
+        return nullptr;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = scanned.find(path.string());
+        if (it != scanned.end() and it->second->mtime == mtime and it->second->size == size) {
+            return it->second;
+        }
+    }
+
+    auto file = std::make_shared<JitBuildScannedFile>();
+    file->mtime = mtime;
+    file->size = size;
+    JitBuildDigest digest;
+    digest.update_file(path.string());
+    file->digest = digest.hex_digest();
+    // Every directive is followed, including those in inactive #if blocks, so the set only errs on the large side
+    static const std::regex include_re(R"(^\s*#\s*include\s*([<"])([^>"]+)[>"])");
+    std::ifstream in(path);
+    string line;
+    std::smatch match;
+    while (std::getline(in, line)) {
+        if (line.find("include") != string::npos and std::regex_search(line, match, include_re)) {
+            file->includes.push_back({match[1] == "\"", match[2]});
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    scanned[path.string()] = file;
+    return file;
+}
+
 void JitBuildEnv::init(uint32_t device_id, tt::ARCH arch)
 {
     // Paths
@@ -42,6 +155,7 @@ void JitBuildEnv::init(uint32_t device_id, tt::ARCH arch)
 
     this->out_firmware_root_ = this->out_root_ + to_string(device_id) + "/firmware/";
     this->out_kernel_root_ = this->out_root_ + to_string(device_id) + "/kernels/";
+    this->out_pch_root_ = this->out_root_ + to_string(device_id) + "/pch/";
 
     // Tools
     this->gpp_ = this->root_ + "tt_metal/third_party/sfpi/compiler/bin/riscv32-unknown-elf-g++ ";
@@ -84,6 +198,9 @@ void JitBuildEnv::init(uint32_t device_id, tt::ARCH arch)
 
     if (tt::tt_metal::getDeviceProfilerState()) {
         this->defines_ += "-DPROFILE_KERNEL=1 ";
+        if (tt::llrt::OptionsG.get_profiler_ring_enabled()) {
+            this->defines_ += "-DPROFILE_KERNEL_RING=1 ";
+        }
     }
 
     if (tt::llrt::OptionsG.get_watcher_enabled()) {
@@ -118,6 +235,10 @@ void JitBuildEnv::init(uint32_t device_id, tt::ARCH arch)
 
     this->lflags_ = common_flags;
     this->lflags_ += "-fno-exceptions -Wl,-z,max-page-size=16 -Wl,-z,common-page-size=16 -nostartfiles ";
+
+    if (get_binary_cache() != nullptr) {
+        this->binary_cache_tree_digest_ = get_binary_cache_tree_digest(this->root_, this->gpp_);
+    }
 }
 
 JitBuildState::JitBuildState(const JitBuildEnv& env, int which, bool is_fw) : env_(env), core_id_(which), is_fw_(is_fw)
@@ -146,6 +267,9 @@ void JitBuildState::finish_init()
     for (string& src : this->srcs_) {
         src = env_.root_ + src;
     }
+    if (!this->pch_src_.empty()) {
+        this->pch_src_ = env_.root_ + this->pch_src_;
+    }
 
     // Create list of object files for link
     for (const string& obj : this->objs_) {
@@ -154,7 +278,8 @@ void JitBuildState::finish_init()
 
     // Note the preceding slash which defies convention as this gets appended to
     // the kernel name used as a path which doesn't have a slash
-    this->target_full_path_ = "/" + this->target_name_ + "/" + this->target_name_ + ".hex";
+    this->target_full_path_ = "/" + this->target_name_ + "/" + this->target_name_ +
+        (tt::llrt::OptionsG.get_hex_binaries_enabled() ? ".hex" : ".elf");
 }
 
 JitBuildDataMovement::JitBuildDataMovement(const JitBuildEnv& env, int which, bool is_fw) : JitBuildState(env, which, is_fw)
@@ -193,6 +318,8 @@ JitBuildDataMovement::JitBuildDataMovement(const JitBuildEnv& env, int which, bo
         } else {
             this->srcs_.push_back("tt_metal/hw/toolchain/tmu-crt0k.S");
             this->srcs_.push_back("tt_metal/hw/firmware/src/brisck.cc");
+            this->pch_src_ = "tt_metal/hw/firmware/src/brisck.cc";
+            this->pch_header_ = "tt_metal/hw/firmware/src/brisck_pch.h";
         }
 
         this->lflags_ +=
@@ -212,6 +339,8 @@ JitBuildDataMovement::JitBuildDataMovement(const JitBuildEnv& env, int which, bo
         } else {
             this->srcs_.push_back("tt_metal/hw/toolchain/tmu-crt0k.S");
             this->srcs_.push_back("tt_metal/hw/firmware/src/ncrisck.cc");
+            this->pch_src_ = "tt_metal/hw/firmware/src/ncrisck.cc";
+            this->pch_header_ = "tt_metal/hw/firmware/src/ncrisck_pch.h";
         }
 
         this->lflags_ +=
@@ -253,6 +382,8 @@ JitBuildCompute::JitBuildCompute(const JitBuildEnv& env, int which, bool is_fw)
     } else {
         this->srcs_.push_back("tt_metal/hw/firmware/src/trisck.cc");
         this->srcs_.push_back("tt_metal/hw/toolchain/tmu-crt0k.S");
+        this->pch_src_ = "tt_metal/hw/firmware/src/trisck.cc";
+        this->pch_header_ = "tt_metal/hw/firmware/src/trisck_pch.h";
     }
 
     this->lflags_ = env_.lflags_ + "-O3 ";
@@ -390,32 +521,22 @@ void JitBuildEthernet::pre_compile(const string& kernel_in_path, const string& o
 
 void JitBuildState::compile_one(const string& log_file,
                                 const string& out_dir,
-                                const JitBuildSettings *settings,
+                                const string& defines,
                                 const string& src,
-                                const string& obj) const
+                                const string& obj,
+                                const string& pch_header) const
 {
-    fs::create_directories(out_dir);
-
-    // Add kernel specific defines
-    string defines = this->defines_;
-    if (settings != nullptr) {
-        if (process_defines_at_compile) {
-            settings->process_defines([&defines] (const string& define, const string& value) {
-                defines += "-D" + define + "=" + value + " ";
-            });
-        }
-
-        settings->process_compile_time_args([&defines] (int i, uint32_t value) {
-            defines += "-DKERNEL_COMPILE_TIME_ARG_" + to_string(i) + "=" + to_string(value) + " ";
-        });
-    }
-
     string cmd;
     cmd = "cd " + out_dir + " && ";
     cmd += env_.gpp_;
     cmd += this->cflags_;
     cmd += defines;
     cmd += this->includes_;
+    if (!pch_header.empty()) {
+        // g++ uses the .gch next to the header when it was built with compatible flags, else reads the header and
+        // warns in the build log
+        cmd += "-Winvalid-pch -include " + pch_header + " ";
+    }
     cmd += "-c -o " + obj + " " + src;
 
     log_debug(tt::LogBuildKernels, "    g++ compile cmd: {}", cmd);
@@ -424,19 +545,80 @@ void JitBuildState::compile_one(const string& log_file,
     }
 }
 
-void JitBuildState::compile(const string& log_file, const string& out_dir, const JitBuildSettings *settings) const
+// The precompiled header only includes headers that don't depend on the kernel, and is built with the build state's
+// defines alone. g++ accepts it for any kernel whose defines the headers never mention, so one is shared by every
+// kernel of the state. It is keyed on the state's defines since processes may share the output directory with
+// different options (eg. the watcher) enabled
+string JitBuildState::pch_header_path() const
 {
-    // Compile each of the srcs to an obj in parallel
-    std::vector<std::thread> threads;
-    threads.resize(this->srcs_.size());;
-    for (int i = 0; i < this->srcs_.size(); i++) {
-        threads[i] = thread(&JitBuildState::compile_one, &*this,
-                            ref(log_file), ref(out_dir), settings, ref(this->srcs_[i]), ref(this->objs_[i]));
+    JitBuildDigest digest;
+    digest.update(this->defines_);
+    return env_.out_pch_root_ + this->target_name_ + "/" + digest.hex_digest().substr(0, 16) + "/" +
+        fs::path(this->pch_header_).filename().string();
+}
+
+// The precompiled header is built on the first kernel build of each build state in the process, so it is never
+// stale, and shared by every kernel compiled after
+JitBuildJobHandle JitBuildState::submit_pch() const
+{
+    std::unique_lock<std::mutex> lock(this->pch_mutex_);
+    if (this->pch_job_ != nullptr) {
+        return this->pch_job_;
+    }
+
+    // Other processes may be compiling with the same header, only replace it once complete
+    string header = pch_header_path();
+    fs::create_directories(fs::path(header).parent_path());
+    string temp_header = header + "." + to_string(getpid()) + ".tmp";
+    fs::copy(env_.root_ + this->pch_header_, temp_header, fs::copy_options::overwrite_existing);
+    fs::rename(temp_header, header);
+    this->pch_job_ = JitBuildEnv::get_build_scheduler().submit(
+        header + ".gch", this->target_name_ + " pch", JitBuildStage::COMPILE, [this, header] () { build_pch(header); });
+    return this->pch_job_;
+}
+
+void JitBuildState::build_pch(const string& header) const
+{
+    string out_dir = fs::path(header).parent_path().string() + "/";
+    string log_file = out_dir + "build.log";
+    // Other processes may be compiling with the same header, only replace it once complete
+    string temp_gch = header + ".gch." + to_string(getpid()) + ".tmp";
+
+    string cmd;
+    cmd = "cd " + out_dir + " && ";
+    cmd += env_.gpp_;
+    cmd += this->cflags_;
+    cmd += this->defines_;
+    cmd += this->includes_;
+    cmd += "-x c++-header " + header + " -o " + temp_gch + " && mv -f " + temp_gch + " " + header + ".gch";
+
+    log_debug(tt::LogBuildKernels, "    g++ pch cmd: {}", cmd);
+    if (!tt::utils::run_command(cmd, log_file, false)) {
+        // Kernels still build without it, only slower
+        log_warning(tt::LogBuildKernels, "{} precompiled header failed to build, see {}", this->target_name_, log_file);
+        std::error_code ec;
+        fs::remove(header + ".gch", ec);
+        fs::remove(temp_gch, ec);
     }
+}
 
-    for (auto& th: threads) {
-        th.join();
+string JitBuildState::compile_defines(const JitBuildSettings *settings) const
+{
+    // Add kernel specific defines
+    string defines = this->defines_;
+    if (settings != nullptr) {
+        if (process_defines_at_compile) {
+            settings->process_defines([&defines] (const string& define, const string& value) {
+                defines += "-D" + define + "=" + value + " ";
+            });
+        }
+
+        settings->process_compile_time_args([&defines] (int i, uint32_t value) {
+            defines += "-DKERNEL_COMPILE_TIME_ARG_" + to_string(i) + "=" + to_string(value) + " ";
+        });
     }
+
+    return defines;
 }
 
 void JitBuildState::link(const string& log_file, const string& out_dir) const
@@ -507,24 +689,193 @@ void JitBuildState::weaken(const string& log_file, const string& out_dir) const
     }
 }
 
-void JitBuildState::build(const JitBuildSettings *settings) const
+string JitBuildState::binary_cache_digest(const string& out_dir, const string& defines) const
+{
+    JitBuildDigest digest;
+    digest.update(env_.binary_cache_tree_digest_);
+    digest.update(this->target_name_);
+    digest.update(this->cflags_);
+    digest.update(defines);
+    digest.update(this->includes_);
+    digest.update(this->lflags_);
+    digest.update(string(tt::llrt::OptionsG.get_hex_binaries_enabled() ? "hex" : "elf"));
+    // Hashing every file the sources include, resolved like g++ resolves them, covers the kernel source included by
+    // the generated chlkc_*.cpp and the headers under tt_eager/ and tt_metal/kernels/. Files are identified by the
+    // name they are included by, full paths are device dependent. Headers outside the include paths come with the
+    // toolchain, which is part of the tree digest
+    vector<fs::path> include_dirs;
+    std::istringstream include_flags(this->includes_);
+    for (string flag; include_flags >> flag;) {
+        if (flag.rfind("-I", 0) == 0) {
+            string dir = flag.size() > 2 ? flag.substr(2) : "";
+            if (dir.empty() and !(include_flags >> dir)) {
+                break;
+            }
+            include_dirs.push_back(fs::path(out_dir) / dir);
+        }
+    }
+    std::set<string> visited;
+    vector<fs::path> pending;
+    for (const string& src : this->srcs_) {
+        digest.update(src.substr(env_.root_.size()));
+        pending.push_back(src);
+    }
+    while (!pending.empty()) {
+        fs::path path = pending.back().lexically_normal();
+        pending.pop_back();
+        if (!visited.insert(path.string()).second) {
+            continue;
+        }
+        auto file = scan_build_file(path);
+        if (file == nullptr) {
+            digest.update(string("missing"));
+            continue;
+        }
+        digest.update(file->digest);
+        for (const auto& [quoted, name] : file->includes) {
+            digest.update(name);
+            std::error_code ec;
+            if (quoted and fs::exists(path.parent_path() / name, ec)) {
+                pending.push_back(path.parent_path() / name);
+                continue;
+            }
+            for (const auto& dir : include_dirs) {
+                if (fs::exists(dir / name, ec)) {
+                    pending.push_back(dir / name);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Generated sources and headers (including the device's harvesting dependent ones), the kernel's own are in the
+    // parent of the target's directory. Device and kernel hash dependent paths are left out so that identical builds
+    // for different devices match
+    static const std::set<string> build_outputs = {".o", ".elf", ".hex", ".tmp", ".map", ".log"};
+    for (const string& dir : {out_dir, out_dir + "../"}) {
+        vector<fs::path> files;
+        std::error_code ec;
+        for (const auto& entry : fs::directory_iterator(dir, ec)) {
+            if (entry.is_regular_file(ec) and build_outputs.find(entry.path().extension().string()) == build_outputs.end()) {
+                files.push_back(entry.path());
+            }
+        }
+        std::sort(files.begin(), files.end());
+        for (const auto& file : files) {
+            digest.update(file.filename().string());
+            digest.update_file(file.string());
+        }
+    }
+
+    // Kernels are linked against the firmware's symbols
+    if (!this->is_fw_) {
+        digest.update_file(env_.out_firmware_root_ + this->target_name_ + "/" + this->target_name_ + "_weakened.elf");
+    }
+
+    return digest.hex_digest();
+}
+
+vector<JitBuildJobHandle> JitBuildState::submit_build(const JitBuildSettings *settings) const
 {
     string out_dir = (settings == nullptr) ?
         this->out_path_ + this->target_name_ + "/" :
         this->out_path_ + settings->get_full_kernel_name() + this->target_name_ + "/";
 
+    fs::create_directories(out_dir);
+
+    string defines = compile_defines(settings);
+
+    // Kernel binaries may already have been built by another device or process. The entry stays locked until this
+    // build publishes it, so others building the same binaries wait for it rather than build them again
+    JitBinaryCache* cache = JitBuildEnv::get_binary_cache();
+    std::shared_ptr<JitBinaryCache::EntryLock> cache_lock;
+    string digest;
+    vector<string> cached_files = {this->target_name_ + ".elf"};
+    if (tt::llrt::OptionsG.get_hex_binaries_enabled()) {
+        cached_files.push_back(this->target_name_ + ".hex");
+    }
+    if (cache != nullptr and settings != nullptr) {
+        digest = binary_cache_digest(out_dir, defines);
+        cache_lock = cache->lock_entry(digest);
+        if (cache->fetch(digest, out_dir, cached_files)) {
+            log_debug(tt::LogBuildKernels, "    {} {} found in the kernel binary cache", settings->get_full_kernel_name(), this->target_name_);
+            return {};
+        }
+    }
+
+    // An identical build still in flight writes the same files, including its log, so it is handed out rather than
+    // submitted again
+    return JitBuildEnv::get_build_scheduler().submit_build(out_dir + this->target_name_, [&] () { return submit_jobs(out_dir, defines, cache_lock, digest, cached_files); });
+}
+
+vector<JitBuildJobHandle> JitBuildState::submit_jobs(
+    const string& out_dir,
+    const string& defines,
+    const std::shared_ptr<JitBinaryCache::EntryLock>& cache_lock,
+    const string& digest,
+    const vector<string>& cached_files) const
+{
+    // Jobs are keyed by the file they produce and only capture values, a job may be shared with another build
+    // and outlive this call
+    JitBuildScheduler& scheduler = JitBuildEnv::get_build_scheduler();
+    JitBinaryCache* cache = JitBuildEnv::get_binary_cache();
     string log_file = out_dir + "build.log";
     if (fs::exists(log_file)) {
         std::remove(log_file.c_str());
     }
 
-    compile(log_file, out_dir, settings);
-    link(log_file, out_dir);
-    elf_to_hex8(log_file, out_dir);
-    hex8_to_hex32(log_file, out_dir);
+    JitBuildJobHandle pch;
+    string pch_header;
+    if (!this->pch_src_.empty() and tt::llrt::OptionsG.get_kernel_pch_enabled()) {
+        pch_header = pch_header_path();
+        pch = submit_pch();
+    }
+
+    vector<JitBuildJobHandle> compiled;
+    for (size_t i = 0; i < this->srcs_.size(); i++) {
+        vector<JitBuildJobHandle> deps;
+        string src_pch_header;
+        if (pch != nullptr and this->srcs_[i] == this->pch_src_) {
+            deps.push_back(pch);
+            src_pch_header = pch_header;
+        }
+        compiled.push_back(scheduler.submit(
+            out_dir + this->objs_[i], this->target_name_ + " compile " + this->objs_[i], JitBuildStage::COMPILE,
+            [this, log_file, out_dir, defines, src_pch_header, i] () { compile_one(log_file, out_dir, defines, this->srcs_[i], this->objs_[i], src_pch_header); }, deps));
+    }
+
+    JitBuildJobHandle linked = scheduler.submit(
+        out_dir + this->target_name_ + ".elf", this->target_name_ + " link", JitBuildStage::LINK,
+        [this, log_file, out_dir] () { link(log_file, out_dir); }, compiled);
+
+    vector<JitBuildJobHandle> done = {linked};
+    // The loader reads the ELF directly, only produce hex files when asked to
+    if (tt::llrt::OptionsG.get_hex_binaries_enabled()) {
+        JitBuildJobHandle hex8 = scheduler.submit(
+            out_dir + this->target_name_ + ".hex.tmp", this->target_name_ + " objcopy", JitBuildStage::EXTRACT,
+            [this, log_file, out_dir] () { elf_to_hex8(log_file, out_dir); }, {linked});
+        done.push_back(scheduler.submit(
+            out_dir + this->target_name_ + ".hex", this->target_name_ + " hex8tohex32", JitBuildStage::EXTRACT,
+            [this, log_file, out_dir] () { hex8_to_hex32(log_file, out_dir); }, {hex8}));
+    }
     if (this->is_fw_) {
-        weaken(log_file, out_dir);
+        done.push_back(scheduler.submit(
+            out_dir + this->target_name_ + "_weakened.elf", this->target_name_ + " weaken", JitBuildStage::EXTRACT,
+            [this, log_file, out_dir] () { weaken(log_file, out_dir); }, {linked}));
+    }
+    if (cache_lock != nullptr) {
+        // The lock is released with the job's work, whether or not the build succeeded
+        done = {scheduler.submit(
+            "", this->target_name_ + " publish", JitBuildStage::EXTRACT,
+            [cache, cache_lock, digest, out_dir, cached_files] () { cache->publish(digest, out_dir, cached_files); }, done)};
     }
+
+    return done;
+}
+
+void JitBuildState::build(const JitBuildSettings *settings) const
+{
+    JitBuildEnv::get_build_scheduler().wait(submit_build(settings));
 }
 
 void jit_build(const JitBuildState& build,
@@ -546,22 +897,17 @@ void jit_build_set(const JitBuildStateSet& build_set,
 {
     ZoneScoped;
 
-    std::vector<std::thread> threads;
-    threads.resize(build_set.size());
+    vector<JitBuildJobHandle> jobs;
     for (int i = 0; i < build_set.size(); i++) {
         const JitBuildState& build = *(build_set[i]);
-        std::function<void()> lambda = [&build, &kernel_in_path, &settings] () {
-            if (settings != nullptr) {
-                build.pre_compile(kernel_in_path, settings->get_full_kernel_name());
-            }
-            build.build(settings);
-        };
-        threads[i] = thread(lambda);
+        if (settings != nullptr) {
+            build.pre_compile(kernel_in_path, settings->get_full_kernel_name());
+        }
+        vector<JitBuildJobHandle> build_jobs = build.submit_build(settings);
+        jobs.insert(jobs.end(), build_jobs.begin(), build_jobs.end());
     }
 
-    for (auto& th: threads) {
-        th.join();
-    }
+    JitBuildEnv::get_build_scheduler().wait(jobs);
 }
 
 void jit_build_subset(const JitBuildStateSubset& build_subset,
@@ -570,22 +916,17 @@ void jit_build_subset(const JitBuildStateSubset& build_subset,
 {
     ZoneScoped;
 
-    std::vector<std::thread> threads;
-    threads.resize(build_subset.size);
+    vector<JitBuildJobHandle> jobs;
     for (int i = 0; i < build_subset.size; i++) {
         const JitBuildState& build = *(build_subset.build_ptr[i]);
-        std::function<void()> lambda = [&build, &kernel_in_path, &settings] () {
-            if (settings != nullptr) {
-                build.pre_compile(kernel_in_path, settings->get_full_kernel_name());
-            }
-            build.build(settings);
-        };
-        threads[i] = thread(lambda);
+        if (settings != nullptr) {
+            build.pre_compile(kernel_in_path, settings->get_full_kernel_name());
+        }
+        vector<JitBuildJobHandle> build_jobs = build.submit_build(settings);
+        jobs.insert(jobs.end(), build_jobs.begin(), build_jobs.end());
     }
 
-    for (auto& th: threads) {
-        th.join();
-    }
+    JitBuildEnv::get_build_scheduler().wait(jobs);
 }
 
 } // namespace tt_metal
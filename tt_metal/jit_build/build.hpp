@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #pragma once
+#include <mutex>
 #include <thread>
 #include <string>
 #include <utility>
@@ -10,6 +11,8 @@
 #include "common/tt_backend_api_types.hpp"
 #include "common/utils.hpp"
 #include "common/core_coord.h"
+#include "jit_build/binary_cache.hpp"
+#include "jit_build/build_scheduler.hpp"
 #include "jit_build/data_format.hpp"
 #include "jit_build/settings.hpp"
 #include "hostdevcommon/common_values.hpp"
@@ -45,6 +48,11 @@ class JitBuildEnv {
     const string& get_out_firmware_root_path() const { return out_firmware_root_; }
     const string& get_out_kernel_root_path() const { return out_kernel_root_; }
 
+    // Process wide, runs the build jobs of every device, TT_METAL_JIT_BUILD_JOBS caps how many run at once
+    static JitBuildScheduler& get_build_scheduler();
+    // Process wide, nullptr unless TT_METAL_KERNEL_BINARY_CACHE_DIR is set
+    static JitBinaryCache* get_binary_cache();
+
   private:
     tt::ARCH arch_;
     string arch_name_;
@@ -55,6 +63,7 @@ class JitBuildEnv {
     string out_root_;
     string out_firmware_root_;
     string out_kernel_root_;
+    string out_pch_root_;
 
     // Tools
     string gpp_;
@@ -66,6 +75,9 @@ class JitBuildEnv {
     string defines_;
     string includes_;
     string lflags_;
+
+    // Toolchain and tree part of the binary cache digest
+    string binary_cache_tree_digest_;
 };
 
 // All the state used for a build in an abstract base class
@@ -92,8 +104,25 @@ class JitBuildState {
 
     string link_objs_;
 
-    void compile(const string& log_file, const string& out_path, const JitBuildSettings *settings) const;
-    void compile_one(const string& log_file, const string& out_path, const JitBuildSettings *settings, const string& src, const string &obj) const;
+    // Kernel builds precompile pch_header_ for pch_src_, the source that includes the kernel
+    string pch_src_;
+    string pch_header_;
+    mutable std::mutex pch_mutex_;
+    mutable JitBuildJobHandle pch_job_;
+
+    string pch_header_path() const;
+    JitBuildJobHandle submit_pch() const;
+    void build_pch(const string& header) const;
+    string compile_defines(const JitBuildSettings *settings) const;
+    string binary_cache_digest(const string& out_dir, const string& defines) const;
+    vector<JitBuildJobHandle> submit_jobs(
+        const string& out_dir,
+        const string& defines,
+        const std::shared_ptr<JitBinaryCache::EntryLock>& cache_lock,
+        const string& digest,
+        const vector<string>& cached_files) const;
+    // pch_header is empty to compile without the precompiled header
+    void compile_one(const string& log_file, const string& out_path, const string& defines, const string& src, const string &obj, const string& pch_header) const;
     void link(const string& log_file, const string& out_path) const;
     void elf_to_hex8(const string& log_file, const string& out_path) const;
     void hex8_to_hex32(const string& log_file, const string& out_path) const;
@@ -105,6 +134,8 @@ class JitBuildState {
     void finish_init();
 
     virtual void pre_compile(const string& kernel_in_path, const string& op_out_path) const;
+    // Queues the build's jobs on the build scheduler, the build is done once the returned jobs are
+    vector<JitBuildJobHandle> submit_build(const JitBuildSettings *settings) const;
     void build(const JitBuildSettings *settings) const;
 
     const string& get_out_path() const { return this->out_path_; };
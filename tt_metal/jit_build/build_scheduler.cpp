@@ -0,0 +1,216 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "jit_build/build_scheduler.hpp"
+
+#include <algorithm>
+
+#include "common/assert.hpp"
+#include "common/logger.hpp"
+
+namespace tt::tt_metal {
+
+JitBuildScheduler::JitBuildScheduler(uint32_t max_jobs) {
+    this->set_max_jobs(max_jobs);
+}
+
+JitBuildScheduler::~JitBuildScheduler() {
+    {
+        std::unique_lock<std::mutex> lock(this->mutex_);
+        this->stop_ = true;
+    }
+    this->work_cv_.notify_all();
+    for (auto& worker : this->workers_) {
+        worker.join();
+    }
+}
+
+JitBuildJobHandle JitBuildScheduler::submit(
+    const std::string& key,
+    const std::string& name,
+    JitBuildStage stage,
+    std::function<void()> work,
+    const std::vector<JitBuildJobHandle>& deps) {
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    if (not key.empty()) {
+        auto in_flight = this->in_flight_jobs_.find(key);
+        if (in_flight != this->in_flight_jobs_.end()) {
+            this->stats_.num_jobs_deduplicated++;
+            return in_flight->second;
+        }
+    }
+
+    auto job = std::make_shared<JitBuildJob>();
+    job->key_ = key;
+    job->name_ = name;
+    job->stage_ = stage;
+    job->work_ = std::move(work);
+    job->submit_time_ = std::chrono::steady_clock::now();
+    if (not key.empty()) {
+        this->in_flight_jobs_.emplace(key, job);
+    }
+
+    std::exception_ptr dep_error;
+    for (const auto& dep : deps) {
+        if (dep->status_ != JitBuildJob::Status::DONE) {
+            job->num_pending_deps_++;
+            dep->dependents_.push_back(job);
+        } else if (dep->error_ and not dep_error) {
+            dep_error = dep->error_;
+        }
+    }
+    if (dep_error) {
+        job->start_time_ = job->submit_time_;
+        this->finish(job, dep_error);
+    } else if (job->num_pending_deps_ == 0) {
+        this->make_ready(job);
+    }
+    return job;
+}
+
+std::vector<JitBuildJobHandle> JitBuildScheduler::submit_build(
+    const std::string& key, const std::function<std::vector<JitBuildJobHandle>()>& submit_jobs) {
+    std::unique_lock<std::mutex> builds_lock(this->builds_mutex_);
+    auto build = this->builds_.find(key);
+    if (build != this->builds_.end() and this->is_in_flight(build->second)) {
+        std::unique_lock<std::mutex> lock(this->mutex_);
+        this->stats_.num_builds_deduplicated++;
+        return build->second;
+    }
+
+    if (this->builds_.size() >= this->max_builds_before_prune_) {
+        for (auto it = this->builds_.begin(); it != this->builds_.end();) {
+            it = this->is_in_flight(it->second) ? std::next(it) : this->builds_.erase(it);
+        }
+        this->max_builds_before_prune_ = std::max<size_t>(64, 2 * this->builds_.size());
+    }
+
+    std::vector<JitBuildJobHandle> jobs = submit_jobs();
+    this->builds_[key] = jobs;
+    return jobs;
+}
+
+bool JitBuildScheduler::is_in_flight(const std::vector<JitBuildJobHandle>& jobs) const {
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    return std::any_of(jobs.begin(), jobs.end(), [](const JitBuildJobHandle& job) { return job->status_ != JitBuildJob::Status::DONE; });
+}
+
+void JitBuildScheduler::wait(const std::vector<JitBuildJobHandle>& jobs) {
+    std::exception_ptr error;
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    for (const auto& job : jobs) {
+        this->done_cv_.wait(lock, [&job] { return job->status_ == JitBuildJob::Status::DONE; });
+        if (job->error_ and not error) {
+            error = job->error_;
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+uint32_t JitBuildScheduler::get_max_jobs() const {
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    return this->max_jobs_;
+}
+
+void JitBuildScheduler::set_max_jobs(uint32_t max_jobs) {
+    {
+        std::unique_lock<std::mutex> lock(this->mutex_);
+        this->max_jobs_ = max_jobs == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : max_jobs;
+    }
+    // Raising the cap may let queued jobs run
+    this->work_cv_.notify_all();
+}
+
+JitBuildSchedulerStats JitBuildScheduler::get_stats() const {
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    return this->stats_;
+}
+
+void JitBuildScheduler::reset_stats() {
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    this->stats_ = JitBuildSchedulerStats();
+}
+
+// Called with the mutex held
+void JitBuildScheduler::make_ready(const JitBuildJobHandle& job) {
+    job->status_ = JitBuildJob::Status::READY;
+    this->ready_jobs_[static_cast<size_t>(job->stage_)].push_back(job);
+    // Threads are only started when there is work for them, up to the cap
+    if (this->num_idle_workers_ == 0 and this->workers_.size() < this->max_jobs_) {
+        this->workers_.emplace_back(&JitBuildScheduler::worker_loop, this);
+    } else {
+        this->work_cv_.notify_one();
+    }
+}
+
+// Called with the mutex held
+void JitBuildScheduler::finish(const JitBuildJobHandle& job, std::exception_ptr error) {
+    job->end_time_ = std::chrono::steady_clock::now();
+    job->status_ = JitBuildJob::Status::DONE;
+    job->error_ = error;
+    job->work_ = nullptr;
+    if (not job->key_.empty()) {
+        this->in_flight_jobs_.erase(job->key_);
+    }
+
+    std::vector<JitBuildJobHandle> dependents = std::move(job->dependents_);
+    job->dependents_.clear();
+    for (const auto& dependent : dependents) {
+        if (dependent->status_ == JitBuildJob::Status::DONE) {
+            continue;
+        }
+        if (error) {
+            // Fail dependents without running them, their own dependents fail in turn
+            dependent->start_time_ = job->end_time_;
+            this->finish(dependent, error);
+        } else if (--dependent->num_pending_deps_ == 0) {
+            this->make_ready(dependent);
+        }
+    }
+}
+
+void JitBuildScheduler::worker_loop() {
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    while (true) {
+        auto ready_job = std::find_if(this->ready_jobs_.rbegin(), this->ready_jobs_.rend(), [](const auto& jobs) { return not jobs.empty(); });
+        if (this->stop_) {
+            break;
+        }
+        if (ready_job == this->ready_jobs_.rend() or this->num_running_jobs_ >= this->max_jobs_) {
+            this->num_idle_workers_++;
+            this->work_cv_.wait(lock);
+            this->num_idle_workers_--;
+            continue;
+        }
+
+        JitBuildJobHandle job = ready_job->front();
+        ready_job->pop_front();
+        job->status_ = JitBuildJob::Status::RUNNING;
+        job->start_time_ = std::chrono::steady_clock::now();
+        this->num_running_jobs_++;
+        this->stats_.max_running_jobs = std::max(this->stats_.max_running_jobs, this->num_running_jobs_);
+        lock.unlock();
+
+        std::exception_ptr error;
+        try {
+            job->work_();
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        this->num_running_jobs_--;
+        this->finish(job, error);
+        this->stats_.num_jobs_run++;
+        this->stats_.num_jobs_failed += error ? 1 : 0;
+        this->stats_.max_queued_ms = std::max(this->stats_.max_queued_ms, job->get_queued_ms());
+        this->stats_.run_ms_by_stage[static_cast<size_t>(job->stage_)] += job->get_run_ms();
+        log_debug(tt::LogBuildKernels, "    {} queued {:.1f} ms, ran {:.1f} ms", job->name_, job->get_queued_ms(), job->get_run_ms());
+        this->done_cv_.notify_all();
+    }
+}
+
+}  // namespace tt::tt_metal
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace tt::tt_metal {
+
+// Steps of a build, a build's jobs of one stage depend on its jobs of the stage before
+enum class JitBuildStage : uint8_t {
+    COMPILE = 0,
+    LINK = 1,
+    EXTRACT = 2,  // Producing binaries from the linked elf
+    COUNT = 3
+};
+
+// A job submitted to the JitBuildScheduler, shared by every submitter of an identical job
+class JitBuildJob {
+  public:
+    const std::string& get_name() const { return name_; }
+    JitBuildStage get_stage() const { return stage_; }
+    // Timings are only valid once the job has finished
+    double get_queued_ms() const { return std::chrono::duration<double, std::milli>(start_time_ - submit_time_).count(); }
+    double get_run_ms() const { return std::chrono::duration<double, std::milli>(end_time_ - start_time_).count(); }
+
+  private:
+    friend class JitBuildScheduler;
+    enum class Status { WAITING, READY, RUNNING, DONE };
+
+    std::string key_;
+    std::string name_;
+    JitBuildStage stage_;
+    std::function<void()> work_;
+
+    // Guarded by the scheduler's mutex
+    Status status_ = Status::WAITING;
+    uint32_t num_pending_deps_ = 0;
+    std::vector<std::shared_ptr<JitBuildJob>> dependents_;
+    std::exception_ptr error_;
+
+    std::chrono::steady_clock::time_point submit_time_;
+    std::chrono::steady_clock::time_point start_time_;
+    std::chrono::steady_clock::time_point end_time_;
+};
+
+using JitBuildJobHandle = std::shared_ptr<JitBuildJob>;
+
+struct JitBuildSchedulerStats {
+    uint64_t num_jobs_run = 0;
+    uint64_t num_jobs_failed = 0;
+    // Submissions that were handed an identical job already in flight
+    uint64_t num_jobs_deduplicated = 0;
+    // Builds that were handed the jobs of an identical build already in flight
+    uint64_t num_builds_deduplicated = 0;
+    uint32_t max_running_jobs = 0;
+    double max_queued_ms = 0;
+    std::array<double, static_cast<size_t>(JitBuildStage::COUNT)> run_ms_by_stage = {};
+};
+
+// Runs build jobs (compiler invocations, etc) from every program and device in the process on a bounded pool of
+// threads, so that building many kernels at once doesn't start more compilers than the host has cores.
+//  - A job only runs once all the jobs it depends on have finished, and fails without running if any of them failed
+//  - Ready jobs of later stages run first, so builds already underway finish before new ones start compiling
+//  - Jobs with the same non-empty key as a job that is still queued or running aren't run again, the submitter is
+//    handed the job in flight. Jobs are keyed by the file they produce
+//  - Builds, the jobs producing one binary, are deduplicated as a whole with submit_build. A build stays in flight
+//    until all its jobs have finished, so a compile job that already finished isn't run again while the link that
+//    reads its output is still queued or running
+class JitBuildScheduler {
+  public:
+    // 0 max jobs runs as many jobs as the host has threads
+    explicit JitBuildScheduler(uint32_t max_jobs = 0);
+    ~JitBuildScheduler();
+
+    JitBuildScheduler(const JitBuildScheduler&) = delete;
+    JitBuildScheduler& operator=(const JitBuildScheduler&) = delete;
+
+    JitBuildJobHandle submit(
+        const std::string& key,
+        const std::string& name,
+        JitBuildStage stage,
+        std::function<void()> work,
+        const std::vector<JitBuildJobHandle>& deps = {});
+
+    // Returns the jobs of the build with this key if any of them is still queued or running. Otherwise calls
+    // submit_jobs to submit the build and returns the jobs it returned. Builds are submitted one at a time, so
+    // submit_jobs should only submit jobs
+    std::vector<JitBuildJobHandle> submit_build(
+        const std::string& key, const std::function<std::vector<JitBuildJobHandle>()>& submit_jobs);
+
+    // Waits for all the jobs to finish then rethrows the first failure
+    void wait(const std::vector<JitBuildJobHandle>& jobs);
+
+    uint32_t get_max_jobs() const;
+    void set_max_jobs(uint32_t max_jobs);
+
+    JitBuildSchedulerStats get_stats() const;
+    void reset_stats();
+
+  private:
+    bool is_in_flight(const std::vector<JitBuildJobHandle>& jobs) const;
+    void make_ready(const JitBuildJobHandle& job);
+    void finish(const JitBuildJobHandle& job, std::exception_ptr error);
+    void worker_loop();
+
+    mutable std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+
+    uint32_t max_jobs_;
+    uint32_t num_running_jobs_ = 0;
+    uint32_t num_idle_workers_ = 0;
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+    std::array<std::deque<JitBuildJobHandle>, static_cast<size_t>(JitBuildStage::COUNT)> ready_jobs_;
+    std::unordered_map<std::string, JitBuildJobHandle> in_flight_jobs_;
+    JitBuildSchedulerStats stats_;
+
+    // Taken before mutex_ when both are held
+    std::mutex builds_mutex_;
+    // Jobs of the builds submitted with submit_build, finished builds are pruned as the map grows
+    std::unordered_map<std::string, std::vector<JitBuildJobHandle>> builds_;
+    size_t max_builds_before_prune_ = 64;
+};
+
+}  // namespace tt::tt_metal
@@ -5,6 +5,8 @@ JIT_BUILD_CFLAGS = $(CFLAGS) -Werror
 
 JIT_BUILD_SRCS_RELATIVE = \
 	jit_build/build.cpp \
+	jit_build/build_scheduler.cpp \
+	jit_build/binary_cache.cpp \
 	jit_build/genfiles.cpp \
 	jit_build/data_format.cpp \
 	jit_build/settings.cpp
@@ -63,8 +63,14 @@ ll_api::memory get_risc_binary(string path) {
 
     fs::path bin_file(path);
 
-    std::ifstream hex_istream(path);
-    ll_api::memory mem(hex_istream);
+    ll_api::memory mem;
+    if (bin_file.extension() == ".elf") {
+        std::ifstream elf_istream(path, std::ios::binary);
+        mem.fill_from_elf(elf_istream);
+    } else {
+        std::ifstream hex_istream(path);
+        mem.fill_from_discontiguous_hex(hex_istream);
+    }
 
     // add this path to binary cache
     HexNameToMemVectorCache::inst().add(path, mem);
@@ -9,7 +9,8 @@ LLRT_SRCS_RELATIVE = \
 	llrt/watcher.cpp \
 	llrt/rtoptions.cpp \
 	llrt/tt_memory.cpp \
-	llrt/tt_hexfile.cpp
+	llrt/tt_hexfile.cpp \
+	llrt/tt_elffile.cpp
 
 LLRT_SRCS = $(addprefix tt_metal/, $(LLRT_SRCS_RELATIVE))
 
@@ -27,6 +27,23 @@ RunTimeOptions::RunTimeOptions() {
     }
 
     build_map_enabled = (getenv("TT_METAL_KERNEL_MAP") != nullptr);
+    hex_binaries_enabled = (getenv("TT_METAL_HEX_BINARIES") != nullptr);
+    jit_build_jobs = 0;
+    if (const char *jit_build_jobs_str = getenv("TT_METAL_JIT_BUILD_JOBS")) {
+        int jobs = std::stoi(jit_build_jobs_str);
+        TT_FATAL(jobs > 0, "TT_METAL_JIT_BUILD_JOBS must be a positive number of jobs, leave it unset to run as many as the host has threads");
+        jit_build_jobs = jobs;
+    }
+    kernel_pch_enabled = (getenv("TT_METAL_DISABLE_KERNEL_PCH") == nullptr);
+    if (const char *kernel_binary_cache_dir_str = getenv("TT_METAL_KERNEL_BINARY_CACHE_DIR")) {
+        kernel_binary_cache_dir = kernel_binary_cache_dir_str;
+    }
+    kernel_binary_cache_size_mb = 4096;
+    if (const char *kernel_binary_cache_size_str = getenv("TT_METAL_KERNEL_BINARY_CACHE_SIZE_MB")) {
+        kernel_binary_cache_size_mb = std::stoull(kernel_binary_cache_size_str);
+    }
+
+    async_command_queue_enabled = (getenv("TT_METAL_ASYNC_COMMAND_QUEUE") != nullptr);
 
     watcher_enabled = false;
     watcher_interval_ms = 0;
@@ -57,6 +74,24 @@ RunTimeOptions::RunTimeOptions() {
     }
 #endif
     TT_FATAL(!(get_dprint_enabled() && get_profiler_enabled()), "Cannot enable both debug printing and profiling");
+    profiler_binary_log_enabled = (std::getenv("TT_METAL_DEVICE_PROFILER_BINARY_LOG") != nullptr);
+    profiler_ring_interval_us = 0;
+    const char *profiler_ring_str = std::getenv("TT_METAL_DEVICE_PROFILER_RING");
+    if (profiler_enabled && profiler_ring_str != nullptr) {
+        int interval = 0;
+        sscanf(profiler_ring_str, "%d", &interval);
+        if (strstr(profiler_ring_str, "us") == nullptr) {
+            interval *= 1000;
+        }
+        TT_FATAL(interval > 0, "TT_METAL_DEVICE_PROFILER_RING must be a poll interval, in ms or with a us suffix");
+        profiler_ring_interval_us = interval;
+    }
+
+#if defined(PROFILER)
+    if (const char *profiler_trace_str = std::getenv("TT_METAL_PROFILER_TRACE")) {
+        profiler_trace_file = profiler_trace_str;
+    }
+#endif
 
     null_kernels = (std::getenv("TT_METAL_NULL_KERNELS") != nullptr);
 }
@@ -22,6 +22,13 @@ class RunTimeOptions {
     std::string root_dir;
 
     bool build_map_enabled;
+    bool hex_binaries_enabled;
+    uint32_t jit_build_jobs;
+    bool kernel_pch_enabled;
+    std::string kernel_binary_cache_dir;
+    uint64_t kernel_binary_cache_size_mb;
+
+    bool async_command_queue_enabled;
 
     bool watcher_enabled;
     int watcher_interval_ms;
@@ -35,6 +42,9 @@ class RunTimeOptions {
     std::string dprint_file_name;
 
     bool profiler_enabled;
+    bool profiler_binary_log_enabled;
+    uint32_t profiler_ring_interval_us;
+    std::string profiler_trace_file;
 
     bool null_kernels;
 
@@ -44,6 +54,20 @@ public:
     const std::string& get_root_dir();
 
     inline bool get_build_map_enabled() { return build_map_enabled; }
+    // Binaries are loaded from the linked ELF, unless this falls back to the objcopy + hex8tohex32.py hex files
+    inline bool get_hex_binaries_enabled() { return hex_binaries_enabled; }
+    // Most build jobs (compiler invocations) to run at once, 0 for one per host thread
+    inline uint32_t get_jit_build_jobs() { return jit_build_jobs; }
+    // Kernel compiles use a precompiled header of the firmware headers unless TT_METAL_DISABLE_KERNEL_PCH is set
+    inline bool get_kernel_pch_enabled() { return kernel_pch_enabled; }
+    inline void set_kernel_pch_enabled(bool enabled) { kernel_pch_enabled = enabled; }
+    // Kernel binaries are shared through a cache in this directory when it's set
+    inline const std::string& get_kernel_binary_cache_dir() { return kernel_binary_cache_dir; }
+    inline uint64_t get_kernel_binary_cache_size_mb() { return kernel_binary_cache_size_mb; }
+
+    // Command queues hand enqueued commands to a worker thread, command queues fetched after a set use the new mode
+    inline bool get_async_command_queue_enabled() { return async_command_queue_enabled; }
+    inline void set_async_command_queue_enabled(bool enabled) { async_command_queue_enabled = enabled; }
 
     inline bool get_watcher_enabled() { return watcher_enabled; }
     inline int get_watcher_interval() { return watcher_interval_ms; }
@@ -94,6 +118,13 @@ public:
     }
 
     inline bool get_profiler_enabled() { return profiler_enabled; }
+    // Device profiler dumps go to profile_log_device.bin, see tools/profiler/device_log.hpp
+    inline bool get_profiler_binary_log_enabled() { return profiler_binary_log_enabled; }
+    // Device profiler buffers are rings drained by a host thread every profiler_ring_interval_us
+    inline bool get_profiler_ring_enabled() { return profiler_ring_interval_us > 0; }
+    inline uint32_t get_profiler_ring_interval_us() { return profiler_ring_interval_us; }
+    // Chrome trace of the run, "1" for profile_trace.json next to the other profiler logs, empty when disabled
+    inline const std::string& get_profiler_trace_file() { return profiler_trace_file; }
 
     inline void set_kernels_nullified(bool v) { null_kernels = v; }
     inline bool get_kernels_nullified() { return null_kernels; }
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <elf.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include "tt_elffile.h"
+
+using namespace std;
+using namespace ll_api;
+
+namespace {
+
+// A run of bytes from the file and the device address they load to
+struct load_chunk {
+  memory::address_t addr;
+  const uint8_t* bytes;
+  size_t size;
+};
+
+template <class T>
+const T* elf_table(const vector<uint8_t>& image, uint64_t offset, uint64_t count, uint64_t entry_size, const char* name) {
+  if (entry_size != sizeof(T) || offset > image.size() || count * sizeof(T) > image.size() - offset)
+    throw runtime_error(string("ELF ") + name + " table is out of range.");
+  return reinterpret_cast<const T*>(image.data() + offset);
+}
+
+vector<load_chunk> find_load_chunks(const vector<uint8_t>& image) {
+  if (image.size() < sizeof(Elf32_Ehdr)) throw runtime_error("ELF file is truncated.");
+
+  Elf32_Ehdr ehdr;
+  memcpy(&ehdr, image.data(), sizeof(ehdr));
+  if (memcmp(ehdr.e_ident, ELFMAG, SELFMAG) != 0) throw runtime_error("File is not an ELF file.");
+  if (ehdr.e_ident[EI_CLASS] != ELFCLASS32 || ehdr.e_ident[EI_DATA] != ELFDATA2LSB)
+    throw runtime_error("ELF file is not little endian 32 bit.");
+
+  const Elf32_Phdr* phdrs =
+      ehdr.e_phnum == 0 ? nullptr : elf_table<Elf32_Phdr>(image, ehdr.e_phoff, ehdr.e_phnum, ehdr.e_phentsize, "program header");
+  const Elf32_Shdr* shdrs =
+      ehdr.e_shnum == 0 ? nullptr : elf_table<Elf32_Shdr>(image, ehdr.e_shoff, ehdr.e_shnum, ehdr.e_shentsize, "section header");
+
+  vector<load_chunk> chunks;
+  auto add_chunk = [&](memory::address_t addr, uint64_t offset, uint64_t size) {
+    if (offset > image.size() || size > image.size() - offset) throw runtime_error("ELF section contents are out of range.");
+    chunks.push_back({addr, image.data() + offset, size});
+  };
+
+  if (shdrs == nullptr) {
+    // Stripped of section headers, the segments are all there is
+    for (unsigned i = 0; i < ehdr.e_phnum; i++) {
+      if (phdrs[i].p_type == PT_LOAD && phdrs[i].p_filesz != 0) {
+        add_chunk(phdrs[i].p_paddr, phdrs[i].p_offset, phdrs[i].p_filesz);
+      }
+    }
+  } else {
+    // Load each section with contents rather than each segment so the gaps between sections aren't filled, this
+    // matches the spans of the hex files
+    for (unsigned i = 0; i < ehdr.e_shnum; i++) {
+      const Elf32_Shdr& shdr = shdrs[i];
+      if (!(shdr.sh_flags & SHF_ALLOC) || shdr.sh_type == SHT_NOBITS || shdr.sh_size == 0) continue;
+
+      // The load address is the section's offset into the segment holding it, from the segment's physical address
+      memory::address_t addr = shdr.sh_addr;
+      for (unsigned j = 0; j < ehdr.e_phnum; j++) {
+        const Elf32_Phdr& phdr = phdrs[j];
+        if (phdr.p_type == PT_LOAD && shdr.sh_offset >= phdr.p_offset &&
+            shdr.sh_offset < static_cast<uint64_t>(phdr.p_offset) + phdr.p_filesz) {
+          addr = phdr.p_paddr + (shdr.sh_offset - phdr.p_offset);
+          break;
+        }
+      }
+      add_chunk(addr, shdr.sh_offset, shdr.sh_size);
+    }
+  }
+
+  stable_sort(chunks.begin(), chunks.end(), [](const load_chunk& a, const load_chunk& b) { return a.addr < b.addr; });
+  return chunks;
+}
+
+}  // namespace
+
+namespace ll_api {
+
+memory::address_t read_elf_file(
+    std::istream& input, const std::function<void(memory::address_t word_addr, memory::word_t)>& callback) {
+  vector<uint8_t> image((istreambuf_iterator<char>(input)), istreambuf_iterator<char>());
+  if (input.bad() || image.empty()) {
+    throw runtime_error(
+        "Problem reading ELF file stream. It may be reading a file that doesn't exist or ulimit -n too low.");
+  }
+
+  bool have_word = false;
+  memory::address_t word_addr = 0;
+  memory::word_t word = 0;
+  for (const load_chunk& chunk : find_load_chunks(image)) {
+    for (size_t i = 0; i < chunk.size; i++) {
+      memory::address_t byte_addr = chunk.addr + i;
+      memory::address_t addr = byte_addr >> 2;
+      if (have_word && addr != word_addr) {
+        if (addr < word_addr) throw runtime_error("ELF file has overlapping sections.");
+        callback(word_addr, word);
+        word = 0;
+      }
+      have_word = true;
+      word_addr = addr;
+      word |= static_cast<memory::word_t>(chunk.bytes[i]) << ((byte_addr & 3) * 8);
+    }
+  }
+
+  if (!have_word) return 0;
+  callback(word_addr, word);
+  return word_addr + 1;
+}
+
+}  // namespace ll_api
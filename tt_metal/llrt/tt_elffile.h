@@ -0,0 +1,22 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <functional>
+#include <istream>
+
+#include "tt_memory.h"
+
+namespace ll_api {
+
+// Reads the loadable contents of a little endian 32 bit ELF, passing each word to the callback.
+// Sections are placed at their load (physical) address, the same image objcopy -O verilog followed by
+// hex8tohex32.py produces: partial words at the ends of a section are zero filled and words shared by two
+// sections are merged. Data is passed in strictly increasing word address order.
+// The return value is the highest word address passed to the callback + 1, or 0 if the ELF has nothing to load.
+memory::address_t read_elf_file(
+    std::istream& input, const std::function<void(memory::address_t word_addr, memory::word_t)>& callback);
+
+}  // namespace ll_api
@@ -12,6 +12,7 @@
 #include "tensix.h"
 #include "tt_memory.h"
 #include "tt_hexfile.h"
+#include "tt_elffile.h"
 
 using std::numeric_limits;
 using std::runtime_error;
@@ -48,6 +49,17 @@ bool memory::operator==(const memory& other) const {
         link_spans_ == other.link_spans_;
 }
 
+void memory::append_word(bool& first, address_t& last_addr, address_t word_addr, word_t value) {
+    if (first || word_addr != last_addr + 1) {
+        link_spans_.push_back({word_addr << 2, 0});
+        first = false;
+    }
+
+    data_.push_back(value);
+    link_spans_.back().len++;
+    last_addr = word_addr;
+}
+
 void memory::fill_from_discontiguous_hex(std::istream& is) {
     // Intended to start empty
     assert(data_.size() == 0);
@@ -55,14 +67,18 @@ void memory::fill_from_discontiguous_hex(std::istream& is) {
     address_t last_addr = 0;
     // hex files run low address to high address
     read_discontiguous_hex_file(is, [&](memory::address_t word_addr, memory::word_t value) {
-        if (first || word_addr != last_addr + 1) {
-            link_spans_.push_back({word_addr << 2, 0});
-            first = false;
-        }
-
-        data_.push_back(value);
-        link_spans_.back().len++;
-        last_addr = word_addr;
+        append_word(first, last_addr, word_addr, value);
+    });
+}
+
+void memory::fill_from_elf(std::istream& is) {
+    // Intended to start empty
+    assert(data_.size() == 0);
+    bool first = true;
+    address_t last_addr = 0;
+    // ELF contents are passed low address to high address, like hex files
+    read_elf_file(is, [&](memory::address_t word_addr, memory::word_t value) {
+        append_word(first, last_addr, word_addr, value);
     });
 }
 
@@ -36,6 +36,9 @@ class memory {
   std::vector<word_t> data_;
   std::vector<struct span> link_spans_;
 
+  // Appends a word, starting a new span unless it follows the previous word
+  void append_word(bool& first, address_t& last_addr, address_t word_addr, word_t value);
+
  public:
   memory();
   memory(std::istream& is);
@@ -51,6 +54,8 @@ class memory {
 
   // Read from file
   void fill_from_discontiguous_hex(std::istream& is);
+  // Read the loadable sections of an ELF straight from the linker output
+  void fill_from_elf(std::istream& is);
 
   // Process spans in arg mem to fill data in *this (eg, from device)
   void fill_from_mem_template(const memory& mem_template, const std::function<void (std::vector<uint32_t>::iterator, uint64_t addr, uint32_t len)>& callback);
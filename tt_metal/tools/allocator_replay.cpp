@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Replays an allocator trace recorded with TT_METAL_ALLOCATOR_TRACE_DIR or Device::start_allocator_trace against every
+// allocator algorithm on the host, and reports peak usage, fragmentation, allocation latency and out of memory failures
+// for each. Bank configs can be overridden to see whether a trace fits with a different number or size of banks.
+// Does not need a device.
+
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+#include "common/assert.hpp"
+#include "hostdevcommon/common_values.hpp"
+#include "tt_metal/impl/allocator/algorithms/free_list.hpp"
+#include "tt_metal/impl/allocator/algorithms/indexed_free_list.hpp"
+#include "tt_metal/impl/allocator/allocator_trace.hpp"
+
+using namespace tt::tt_metal::allocator;
+
+namespace {
+
+// Same as BankManager
+constexpr uint64_t min_allocation_size_bytes = 32;
+
+struct AlgorithmChoice {
+    std::string name;
+    AlgorithmFactory make_algorithm;
+};
+
+std::vector<AlgorithmChoice> algorithm_choices() {
+    std::vector<AlgorithmChoice> choices;
+    for (auto search_policy : {FreeList::SearchPolicy::FIRST, FreeList::SearchPolicy::BEST}) {
+        std::string policy_name = search_policy == FreeList::SearchPolicy::FIRST ? "first" : "best";
+        choices.push_back({"free_list:" + policy_name, [search_policy](const TraceBankConfig &bank) -> std::unique_ptr<Algorithm> {
+            return std::make_unique<FreeList>(bank.bank_size_bytes, bank.offset_bytes, min_allocation_size_bytes, ADDRESS_ALIGNMENT, search_policy);
+        }});
+        choices.push_back({"indexed_free_list:" + policy_name, [search_policy](const TraceBankConfig &bank) -> std::unique_ptr<Algorithm> {
+            return std::make_unique<IndexedFreeList>(bank.bank_size_bytes, bank.offset_bytes, min_allocation_size_bytes, ADDRESS_ALIGNMENT, search_policy);
+        }});
+    }
+    return choices;
+}
+
+void print_usage() {
+    std::cout << "Usage: allocator_replay <trace file> [options]\n"
+              << "  --algorithm <name>                     Only replay with this algorithm, eg. free_list:first\n"
+              << "  --num-banks <buffer type>=<n>          Replay with n banks of this buffer type, eg. L1=64\n"
+              << "  --bank-size <buffer type>=<bytes>      Replay with banks of this size\n"
+              << "  --address-limit <buffer type>=<addr>   Replay with this interleaved address limit, 0 for none\n"
+              << "  --tags                                 List the tags of allocations that ran out of memory\n";
+}
+
+// Parses <buffer type>=<value> and applies it to the bank config of that buffer type
+void apply_override(
+    std::vector<TraceBankConfig> &bank_configs, const std::string &argument, const std::function<void(TraceBankConfig &, uint64_t)> &apply) {
+    auto separator = argument.find('=');
+    TT_FATAL(separator != std::string::npos, "Expected <buffer type>=<value>, got {}", argument);
+    std::string buffer_type = argument.substr(0, separator);
+    uint64_t value = std::stoull(argument.substr(separator + 1));
+    for (auto &bank : bank_configs) {
+        if (bank.buffer_type == buffer_type) {
+            apply(bank, value);
+            return;
+        }
+    }
+    TT_THROW("Trace has no banks of buffer type {}", buffer_type);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    if (argc < 2 or std::strcmp(argv[1], "--help") == 0) {
+        print_usage();
+        return argc < 2 ? 1 : 0;
+    }
+
+    AllocatorTrace trace = read_trace(argv[1]);
+    std::vector<TraceBankConfig> bank_configs = trace.banks;
+    std::string only_algorithm;
+    bool print_tags = false;
+    for (int i = 2; i < argc; i++) {
+        std::string option = argv[i];
+        bool has_value = i + 1 < argc;
+        if (option == "--algorithm" and has_value) {
+            only_algorithm = argv[++i];
+        } else if (option == "--num-banks" and has_value) {
+            apply_override(bank_configs, argv[++i], [](TraceBankConfig &bank, uint64_t value) { bank.num_banks = value; });
+        } else if (option == "--bank-size" and has_value) {
+            apply_override(bank_configs, argv[++i], [](TraceBankConfig &bank, uint64_t value) { bank.bank_size_bytes = value; });
+        } else if (option == "--address-limit" and has_value) {
+            apply_override(bank_configs, argv[++i], [](TraceBankConfig &bank, uint64_t value) { bank.interleaved_address_limit = value; });
+        } else if (option == "--tags") {
+            print_tags = true;
+        } else {
+            print_usage();
+            return 1;
+        }
+    }
+
+    std::cout << "Replaying " << trace.events.size() << " events from " << argv[1] << "\n";
+    for (const auto &bank : bank_configs) {
+        std::cout << "  " << bank.buffer_type << ": " << bank.num_banks << " banks of " << bank.bank_size_bytes << " B at offset "
+                  << bank.offset_bytes << ", interleaved address limit " << bank.interleaved_address_limit << "\n";
+    }
+    std::cout << "\n"
+              << std::left << std::setw(24) << "algorithm" << std::setw(8) << "type" << std::right << std::setw(10) << "allocs"
+              << std::setw(8) << "oom" << std::setw(12) << "rec. oom" << std::setw(12) << "mismatch" << std::setw(14) << "peak B"
+              << std::setw(16) << "free@peak B" << std::setw(8) << "frag" << std::setw(12) << "alloc ns" << std::setw(12) << "max ns"
+              << std::setw(12) << "free ns" << "\n";
+
+    bool found_algorithm = false;
+    for (const auto &choice : algorithm_choices()) {
+        if (not only_algorithm.empty() and choice.name != only_algorithm) {
+            continue;
+        }
+        found_algorithm = true;
+        for (const auto &stats : replay_trace(trace, choice.make_algorithm, bank_configs)) {
+            std::cout << std::left << std::setw(24) << choice.name << std::setw(8) << stats.buffer_type << std::right
+                      << std::setw(10) << stats.num_allocations << std::setw(8) << stats.num_failed_allocations << std::setw(12)
+                      << stats.num_recorded_failed_allocations << std::setw(12) << stats.num_address_mismatches << std::setw(14)
+                      << stats.peak_allocated_bytes << std::setw(16) << stats.largest_free_block_bytes_at_peak << std::setw(8)
+                      << std::fixed << std::setprecision(3) << stats.max_fragmentation << std::setw(12) << std::setprecision(1)
+                      << stats.mean_allocate_ns << std::setw(12) << stats.max_allocate_ns << std::setw(12) << stats.mean_deallocate_ns
+                      << "\n";
+            if (print_tags) {
+                for (const auto &[tag, num_failed_allocations] : stats.failed_allocations_by_tag) {
+                    std::cout << "    out of memory in " << tag << ": " << num_failed_allocations << "\n";
+                }
+            }
+        }
+    }
+    if (not found_algorithm) {
+        std::cout << "Unknown algorithm " << only_algorithm << "\n";
+        return 1;
+    }
+    return 0;
+}
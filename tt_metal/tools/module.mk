@@ -4,7 +4,9 @@
 include $(TT_METAL_HOME)/tt_metal/tools/profiler/module.mk
 
 TOOLS = \
-	tools/memset
+	tools/memset \
+	tools/allocator_replay \
+	tools/profiler_log_convert
 
 TOOLS_SRCS = $(addprefix tt_metal/, $(addsuffix .cpp, $(TOOLS)))
 
@@ -16,7 +18,7 @@ TOOLS_DEPS = $(addprefix $(OBJDIR)/, $(TOOLS_SRCS:.cpp=.d))
 -include $(TOOLS_DEPS)
 
 # Each module has a top level target as the entrypoint which must match the subdir name
-tools: $(OBJDIR)/tt_metal/tools/memset tools/profiler #tools/tt_gdb
+tools: $(OBJDIR)/tt_metal/tools/memset $(OBJDIR)/tt_metal/tools/allocator_replay $(OBJDIR)/tt_metal/tools/profiler_log_convert tools/profiler #tools/tt_gdb
 
 .PRECIOUS: $(OBJDIR)/tools/%
 $(OBJDIR)/tt_metal/tools/memset: $(OBJDIR)/tt_metal/tools/memset.o $(COMMON_OBJS) $(LLRT_OBJS) $(DEVICE_OBJS)
@@ -26,3 +28,27 @@ $(OBJDIR)/tt_metal/tools/memset: $(OBJDIR)/tt_metal/tools/memset.o $(COMMON_OBJS
 $(OBJDIR)/tt_metal/tools/memset.o: tt_metal/tools/memset.cpp
 	@mkdir -p $(@D)
 	$(CXX) $(CFLAGS) $(CXXFLAGS) $(TOOLS_INCLUDES) -c -o $@ $<
+
+# Host only, links just the allocator algorithms so traces can be replayed on machines without a device
+ALLOCATOR_REPLAY_OBJS = \
+	$(OBJDIR)/tt_metal/impl/allocator/algorithms/free_list.o \
+	$(OBJDIR)/tt_metal/impl/allocator/algorithms/indexed_free_list.o \
+	$(OBJDIR)/tt_metal/impl/allocator/arena.o \
+	$(OBJDIR)/tt_metal/impl/allocator/allocator_trace.o
+
+$(OBJDIR)/tt_metal/tools/allocator_replay: $(OBJDIR)/tt_metal/tools/allocator_replay.o $(ALLOCATOR_REPLAY_OBJS)
+	@mkdir -p $(@D)
+	$(CXX) $(CFLAGS) $(CXXFLAGS) $(TOOLS_INCLUDES) -o $@ $^ $(LDFLAGS)
+
+$(OBJDIR)/tt_metal/tools/allocator_replay.o: tt_metal/tools/allocator_replay.cpp
+	@mkdir -p $(@D)
+	$(CXX) $(CFLAGS) $(CXXFLAGS) $(TOOLS_INCLUDES) -c -o $@ $<
+
+# Host only, the binary device profiler log format is header only
+$(OBJDIR)/tt_metal/tools/profiler_log_convert: $(OBJDIR)/tt_metal/tools/profiler_log_convert.o
+	@mkdir -p $(@D)
+	$(CXX) $(CFLAGS) $(CXXFLAGS) $(TOOLS_INCLUDES) -o $@ $^ $(LDFLAGS)
+
+$(OBJDIR)/tt_metal/tools/profiler_log_convert.o: tt_metal/tools/profiler_log_convert.cpp
+	@mkdir -p $(@D)
+	$(CXX) $(CFLAGS) $(CXXFLAGS) $(TOOLS_INCLUDES) -c -o $@ $<
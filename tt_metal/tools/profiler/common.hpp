@@ -4,6 +4,11 @@
 
 #pragma once
 
+#include <string>
+#include <string_view>
+
+#include "common/core_coord.h"
+
 namespace tt {
 
 namespace tt_metal {
@@ -11,6 +16,21 @@ namespace tt_metal {
 constexpr std::string_view PROFILER_RUNTIME_ROOT_DIR = "generated/profiler/";
 constexpr std::string_view PROFILER_LOGS_DIR_NAME = ".logs/";
 
+// Counters of one RISC profiler buffer in ring mode, TT_METAL_DEVICE_PROFILER_RING
+struct DeviceProfilerRingStats {
+    // Physical core
+    CoreCoord core;
+    std::string risc_name;
+    // Markers the ring holds
+    uint32_t ring_size = 0;
+    // Markers read back by the host
+    uint64_t num_markers = 0;
+    // Markers the device wrapped over before the host read them
+    uint64_t num_overwritten_markers = 0;
+    // Most markers found waiting in the ring by one drain, the host falls behind once this reaches ring_size
+    uint32_t high_watermark = 0;
+};
+
 }  // namespace tt_metal
 
 }  // namespace tt
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace tt {
+
+namespace tt_metal {
+
+// Binary device profiler log, written instead of profile_log_device.csv when TT_METAL_DEVICE_PROFILER_BINARY_LOG is set.
+// The file starts with a DeviceLogFileHeader. Every dump appends one DeviceLogBlockHeader per chip, core and RISC,
+// each followed by its num_records DeviceLogRecords. The profiler_log_convert tool turns it into the CSV.
+constexpr std::string_view DEVICE_SIDE_BINARY_LOG = "profile_log_device.bin";
+constexpr uint64_t DEVICE_LOG_MAGIC = 0x3147'4f4c'5645'4454;  // "TDEVLOG1"
+
+struct DeviceLogFileHeader {
+    uint64_t magic = DEVICE_LOG_MAGIC;
+    char arch[16] = {};
+    uint32_t chip_freq_mhz = 0;
+    uint32_t reserved = 0;
+};
+
+struct DeviceLogBlockHeader {
+    uint32_t chip_id = 0;
+    // Core coordinates as they appear in the CSV
+    int32_t core_x = 0;
+    int32_t core_y = 0;
+    char risc[8] = {};
+    uint32_t num_records = 0;
+    uint32_t num_dropped_markers = 0;
+    uint32_t reserved = 0;
+};
+
+struct DeviceLogRecord {
+    uint64_t timestamp;
+    uint32_t timer_id;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(DeviceLogFileHeader) == 32);
+static_assert(sizeof(DeviceLogBlockHeader) == 32);
+static_assert(sizeof(DeviceLogRecord) == 16);
+
+// Copies a name into a fixed size field, truncated and zero padded
+template <size_t N>
+inline void CopyDeviceLogName(char (&field)[N], const std::string &name) {
+    std::memset(field, 0, N);
+    std::memcpy(field, name.data(), std::min(name.size(), N - 1));
+}
+
+inline void WriteDeviceLogCsvHeader(std::ostream &csv, const std::string &arch, uint32_t chip_freq_mhz) {
+    csv << "ARCH: " << arch << ", CHIP_FREQ[MHz]: " << chip_freq_mhz << "\n";
+    csv << "PCIe slot, core_x, core_y, RISC processor type, timer_id, time[cycles since reset]" << "\n";
+}
+
+inline void WriteDeviceLogCsvRecord(
+    std::ostream &csv, uint32_t chip_id, int32_t core_x, int32_t core_y, const std::string &risc, uint32_t timer_id, uint64_t timestamp) {
+    csv << chip_id << ", " << core_x << ", " << core_y << ", " << risc << ", " << timer_id << ", " << timestamp << "\n";
+}
+
+}  // namespace tt_metal
+
+}  // namespace tt
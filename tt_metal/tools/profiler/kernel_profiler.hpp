@@ -26,7 +26,14 @@ namespace kernel_profiler{
 
     inline __attribute__((always_inline)) void init_profiler()
     {
-#if defined(PROFILE_KERNEL)
+#if defined(PROFILE_KERNEL) && defined(PROFILE_KERNEL_RING)
+        // Only the first launch starts the ring, later ones keep counting so the host can drain across programs
+        volatile tt_l1_ptr uint32_t *buffer = reinterpret_cast<volatile tt_l1_ptr uint32_t*>(get_debug_print_buffer());
+        if (buffer [RING_STATE] != RING_STARTED) {
+            buffer [RING_WRITE_COUNT] = 0;
+            buffer [RING_STATE] = RING_STARTED;
+        }
+#elif defined(PROFILE_KERNEL)
         volatile tt_l1_ptr uint32_t *buffer = reinterpret_cast<volatile tt_l1_ptr uint32_t*>(get_debug_print_buffer());
         wIndex = MARKER_DATA_START;
         buffer [BUFFER_END_INDEX] = wIndex;
@@ -66,8 +73,17 @@ namespace kernel_profiler{
         uint32_t time_H = ckernel::reg_read(RISCV_DEBUG_REG_WALL_CLOCK_H);
 #endif
 
-        // Either buffer has room for more markers or the end of FW marker is place on the last marker spot
         volatile tt_l1_ptr uint32_t *buffer = reinterpret_cast<volatile tt_l1_ptr uint32_t*>(get_debug_print_buffer());
+#if defined(PROFILE_KERNEL_RING)
+        // The marker goes in before the count, the host only reads markers below the count
+        uint32_t count = buffer [RING_WRITE_COUNT];
+        uint32_t index = MARKER_DATA_START + (count % ring_num_markers(PRINT_BUFFER_SIZE)) * TIMER_DATA_UINT32_SIZE;
+        buffer[index+TIMER_ID] = timer_id;
+        buffer[index+TIMER_VAL_L] = time_L;
+        buffer[index+TIMER_VAL_H] = time_H;
+        buffer [RING_WRITE_COUNT] = count + 1;
+#else
+        // Either buffer has room for more markers or the end of FW marker is place on the last marker spot
 	if (((wIndex + (3*TIMER_DATA_UINT32_SIZE)) < (PRINT_BUFFER_SIZE/sizeof(uint32_t))) ||\
             (((timer_id == CC_MAIN_END) || (timer_id == CC_KERNEL_MAIN_END)) &&\
              !((wIndex + TIMER_DATA_UINT32_SIZE) > (PRINT_BUFFER_SIZE/sizeof(uint32_t))))) {
@@ -79,6 +95,7 @@ namespace kernel_profiler{
 	} else {
             buffer [DROPPED_MARKER_COUNTER]++;
 	}
+#endif //PROFILE_KERNEL_RING
 #endif //PROFILE_KERNEL
     }
 
@@ -6,11 +6,17 @@
 #include <fstream>
 #include <iomanip>
 #include <filesystem>
+#include <sstream>
+#include <atomic>
 
 #include "tools/profiler/profiler.hpp"
 #include "tools/profiler/profiler_state.hpp"
+#include "tools/profiler/device_log.hpp"
+#include "tools/profiler/trace_exporter.hpp"
+#include "common/executor.hpp"
 #include "hostdevcommon/profiler_common.h"
 #include "llrt/rtoptions.hpp"
+#include "tensix.h"
 
 #define HOST_SIDE_LOG "profile_log_host.csv"
 #define DEVICE_SIDE_LOG "profile_log_device.csv"
@@ -19,6 +25,26 @@ namespace tt {
 
 namespace tt_metal {
 
+namespace {
+
+// Anchors the chip's clock in the trace by reading the wall clock the RISCs timestamp their markers with, halfway
+// through the host's round trip to read it
+void alignDeviceClock(int device_id, const CoreCoord& core, int device_core_frequency) {
+    if (TraceExporter::inst().device_clock_aligned(device_id)) {
+        return;
+    }
+    uint32_t time_L, time_H;
+    auto before = steady_clock::now();
+    // Reading the low word latches the high word
+    tt::Cluster::instance().read_reg(&time_L, tt_cxy_pair(device_id, core), RISCV_DEBUG_REG_WALL_CLOCK_L);
+    tt::Cluster::instance().read_reg(&time_H, tt_cxy_pair(device_id, core), RISCV_DEBUG_REG_WALL_CLOCK_H);
+    auto after = steady_clock::now();
+    uint64_t host_ns = duration_cast<nanoseconds>((before + (after - before) / 2).time_since_epoch()).count();
+    TraceExporter::inst().align_device_clock(device_id, (uint64_t(time_H) << 32) | time_L, host_ns, device_core_frequency);
+}
+
+}  // namespace
+
 TimerPeriodInt Profiler::timerToTimerInt(TimerPeriod period)
 {
     TimerPeriodInt ret;
@@ -39,10 +65,12 @@ void Profiler::dumpHostResults(const std::string& timer_name, const std::vector<
     TT_FATAL (timer_period_ns.stop != 0 , "Timer stop cannot be zero on : " + timer_name);
 
     std::filesystem::path log_path = output_dir / HOST_SIDE_LOG;
-    std::ofstream log_file;
+    std::ofstream& log_file = host_log_file;
 
-    if (host_new_log|| !std::filesystem::exists(log_path))
+    // Once the log is open timers only go through the stream's buffer, no file system calls besides flushing op timers
+    if (host_new_log || (!log_file.is_open() && !std::filesystem::exists(log_path)))
     {
+        log_file.close();
         log_file.open(log_path);
 
         log_file << "Name" << ", ";
@@ -58,7 +86,7 @@ void Profiler::dumpHostResults(const std::string& timer_name, const std::vector<
         log_file << std::endl;
         host_new_log = false;
     }
-    else
+    else if (!log_file.is_open())
     {
         log_file.open(log_path, std::ios_base::app);
     }
@@ -73,85 +101,153 @@ void Profiler::dumpHostResults(const std::string& timer_name, const std::vector<
         log_file  << ", "<< field.second;
     }
 
-    log_file << std::endl;
+    log_file << "\n";
+    // Op timers come one per op, their rows should be on disk as soon as the op ends even if the run never dumps
+    // device results. Other timers wait for the next device dump
+    if (!additional_fields.empty()) {
+        log_file.flush();
+    }
+
+    if (TraceExporter::enabled()) {
+        // Timers with fields come from the op profiler
+        TraceExporter::inst().add_host_span(
+            timer_name, additional_fields.empty() ? "tt_metal" : "op", timer_period_ns.start, timer_period_ns.stop, additional_fields);
+    }
+}
 
-    log_file.close();
+uint64_t Profiler::readRiscProfilerBuffers(int device_id, vector<RiscProfilerBuffer>& buffers) {
+    constexpr uint32_t BUFFER_UINT32_SIZE = PRINT_BUFFER_SIZE / sizeof(uint32_t);
+    constexpr uint32_t HEADER_BYTES = kernel_profiler::MARKER_DATA_START * sizeof(uint32_t);
+    // Every read is a round trip to the device, give each executor thread a few RISCs at a time
+    constexpr size_t READS_PER_TASK = 8;
+
+    // Phase one, how much of each buffer was written
+    detail::parallel_for(buffers.size(), READS_PER_TASK, [&](size_t begin, size_t end) {
+        for (size_t b = begin; b < end; b++) {
+            RiscProfilerBuffer& buffer = buffers[b];
+            vector<uint32_t> header = tt::llrt::read_hex_vec_from_core(device_id, buffer.core, buffer.buffer_addr, HEADER_BYTES);
+            buffer.end_index = header[kernel_profiler::BUFFER_END_INDEX];
+            buffer.dropped_marker_counter = header[kernel_profiler::DROPPED_MARKER_COUNTER];
+            TT_ASSERT(buffer.end_index < BUFFER_UINT32_SIZE);
+        }
+    });
+
+    // Phase two, only the populated ranges, whole markers
+    std::atomic<uint64_t> num_bytes_read{buffers.size() * HEADER_BYTES};
+    detail::parallel_for(buffers.size(), READS_PER_TASK, [&](size_t begin, size_t end) {
+        for (size_t b = begin; b < end; b++) {
+            RiscProfilerBuffer& buffer = buffers[b];
+            if (buffer.dropped_marker_counter > 0) {
+                log_debug(
+                    tt::LogDevice,
+                    "{} device markers on device {} physical core {},{} risc {} were dropped. End index {}",
+                    buffer.dropped_marker_counter,
+                    device_id,
+                    buffer.core.x,
+                    buffer.core.y,
+                    buffer.risc_name,
+                    buffer.end_index);
+            }
+            if (buffer.end_index <= kernel_profiler::MARKER_DATA_START) {
+                continue;
+            }
+            uint32_t num_markers = (buffer.end_index - kernel_profiler::MARKER_DATA_START + kernel_profiler::TIMER_DATA_UINT32_SIZE - 1) / kernel_profiler::TIMER_DATA_UINT32_SIZE;
+            uint32_t num_words = std::min(num_markers * kernel_profiler::TIMER_DATA_UINT32_SIZE, BUFFER_UINT32_SIZE - kernel_profiler::MARKER_DATA_START);
+            num_words -= num_words % kernel_profiler::TIMER_DATA_UINT32_SIZE;
+            if (num_words == 0) {
+                continue;
+            }
+            buffer.marker_data = tt::llrt::read_hex_vec_from_core(
+                device_id, buffer.core, buffer.buffer_addr + HEADER_BYTES, num_words * sizeof(uint32_t));
+            num_bytes_read += num_words * sizeof(uint32_t);
+        }
+    });
+    return num_bytes_read;
 }
 
-void Profiler::readRiscProfilerResults(
-    int device_id, const CoreCoord &physical_core, std::string risc_name, int risc_print_buffer_addr) {
-    vector<std::uint32_t> profile_buffer;
-    uint32_t end_index;
-    uint32_t dropped_marker_counter;
-
-    profile_buffer =
-        tt::llrt::read_hex_vec_from_core(device_id, physical_core, risc_print_buffer_addr, PRINT_BUFFER_SIZE);
-
-    end_index = profile_buffer[kernel_profiler::BUFFER_END_INDEX];
-    TT_ASSERT (end_index < (PRINT_BUFFER_SIZE/sizeof(uint32_t)));
-    dropped_marker_counter = profile_buffer[kernel_profiler::DROPPED_MARKER_COUNTER];
-
-    if(dropped_marker_counter > 0){
-        log_debug(
-            tt::LogDevice,
-            "{} device markers on device {} physical core {},{} risc {} were dropped. End index {}",
-            dropped_marker_counter,
-            device_id,
-            physical_core.x,
-            physical_core.y,
-            risc_name,
-            end_index);
-    }
-
-    for (int i = kernel_profiler::MARKER_DATA_START; i < end_index; i+=kernel_profiler::TIMER_DATA_UINT32_SIZE) {
-        dumpDeviceResultToFile(
-            device_id,
-            physical_core.x,
-            physical_core.y,
-            risc_name,
-            (uint64_t(profile_buffer[i + kernel_profiler::TIMER_VAL_H]) << 32) |
-                profile_buffer[i + kernel_profiler::TIMER_VAL_L],
-            profile_buffer[i + kernel_profiler::TIMER_ID]);
+void Profiler::appendDeviceResults(std::string& log_data, int chip_id, const RiscProfilerBuffer& buffer) {
+    int core_x = buffer.core.x;
+    int core_y = buffer.core.y;
+    if (buffer.risc_name != "ERISC") {
+        constexpr int DRAM_ROW = 6;
+        if (core_y > DRAM_ROW) {
+            core_y = core_y - 2;
+        } else {
+            core_y--;
+        }
+        core_x--;
+    }
+
+    const vector<uint32_t>& marker_data = buffer.marker_data;
+    uint32_t num_records = marker_data.size() / kernel_profiler::TIMER_DATA_UINT32_SIZE;
+
+    if (TraceExporter::enabled() and num_records > 0) {
+        TraceExporter::inst().add_device_markers(chip_id, core_x, core_y, buffer.risc_name, marker_data);
     }
+
+    if (device_binary_log) {
+        DeviceLogBlockHeader block;
+        block.chip_id = chip_id;
+        block.core_x = core_x;
+        block.core_y = core_y;
+        CopyDeviceLogName(block.risc, buffer.risc_name);
+        block.num_records = num_records;
+        block.num_dropped_markers = buffer.dropped_marker_counter;
+        size_t block_start = log_data.size();
+        log_data.resize(block_start + sizeof(block) + num_records * sizeof(DeviceLogRecord));
+        std::memcpy(log_data.data() + block_start, &block, sizeof(block));
+
+        DeviceLogRecord* records = reinterpret_cast<DeviceLogRecord*>(log_data.data() + block_start + sizeof(block));
+        for (uint32_t r = 0; r < num_records; r++) {
+            uint32_t i = r * kernel_profiler::TIMER_DATA_UINT32_SIZE;
+            DeviceLogRecord record;
+            record.timestamp = (uint64_t(marker_data[i + kernel_profiler::TIMER_VAL_H]) << 32) | marker_data[i + kernel_profiler::TIMER_VAL_L];
+            record.timer_id = marker_data[i + kernel_profiler::TIMER_ID];
+            record.reserved = 0;
+            std::memcpy(records + r, &record, sizeof(record));
+        }
+        return;
+    }
+
+    std::ostringstream csv;
+    for (uint32_t r = 0; r < num_records; r++) {
+        uint32_t i = r * kernel_profiler::TIMER_DATA_UINT32_SIZE;
+        WriteDeviceLogCsvRecord(
+            csv,
+            chip_id,
+            core_x,
+            core_y,
+            buffer.risc_name,
+            marker_data[i + kernel_profiler::TIMER_ID],
+            (uint64_t(marker_data[i + kernel_profiler::TIMER_VAL_H]) << 32) | marker_data[i + kernel_profiler::TIMER_VAL_L]);
+    }
+    log_data += csv.str();
 }
 
-void Profiler::dumpDeviceResultToFile(
-        int chip_id,
-        int core_x,
-        int core_y,
-        std::string hart_name,
-        uint64_t timestamp,
-        uint32_t timer_id){
+void Profiler::dumpDeviceResultsToFile(const std::string& log_data){
 
-    std::filesystem::path log_path = output_dir / DEVICE_SIDE_LOG;
+    std::filesystem::path log_path = output_dir / (device_binary_log ? std::string(DEVICE_SIDE_BINARY_LOG) : std::string(DEVICE_SIDE_LOG));
     std::ofstream log_file;
 
     if (device_new_log || !std::filesystem::exists(log_path))
     {
-        log_file.open(log_path);
-        log_file << "ARCH: " << get_string_lowercase(device_architecture) << ", CHIP_FREQ[MHz]: " << device_core_frequency << std::endl;
-        log_file << "PCIe slot, core_x, core_y, RISC processor type, timer_id, time[cycles since reset]" << std::endl;
+        log_file.open(log_path, std::ios_base::binary);
+        if (device_binary_log) {
+            DeviceLogFileHeader header;
+            CopyDeviceLogName(header.arch, get_string_lowercase(device_architecture));
+            header.chip_freq_mhz = device_core_frequency;
+            log_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        } else {
+            WriteDeviceLogCsvHeader(log_file, get_string_lowercase(device_architecture), device_core_frequency);
+        }
         device_new_log = false;
     }
     else
     {
-        log_file.open(log_path, std::ios_base::app);
-    }
-
-    if (hart_name != "ERISC") {
-        constexpr int DRAM_ROW = 6;
-        if (core_y > DRAM_ROW) {
-            core_y = core_y - 2;
-        } else {
-            core_y--;
-        }
-        core_x--;
+        log_file.open(log_path, std::ios_base::app | std::ios_base::binary);
     }
 
-    log_file << chip_id << ", " << core_x << ", " << core_y << ", " << hart_name << ", ";
-    log_file << timer_id << ", ";
-    log_file << timestamp;
-    log_file << std::endl;
+    log_file.write(log_data.data(), log_data.size());
     log_file.close();
 }
 
@@ -162,9 +258,216 @@ Profiler::Profiler()
     device_new_log = true;
     output_dir = std::filesystem::path(string(PROFILER_RUNTIME_ROOT_DIR) + string(PROFILER_LOGS_DIR_NAME));
     std::filesystem::create_directories(output_dir);
+    device_binary_log = tt::llrt::OptionsG.get_profiler_binary_log_enabled();
+    ring_interval_us = tt::llrt::OptionsG.get_profiler_ring_interval_us();
+#endif
+}
+
+Profiler::Profiler(const Profiler& other)
+{
+    *this = other;
+}
+
+Profiler& Profiler::operator=(const Profiler& other)
+{
+    if (this == &other) {
+        return *this;
+    }
+    name_to_timer_map = other.name_to_timer_map;
+    host_new_log = other.host_new_log;
+    device_new_log = other.device_new_log;
+    device_architecture = other.device_architecture;
+    device_core_frequency = other.device_core_frequency;
+    output_dir = other.output_dir;
+    device_binary_log = other.device_binary_log;
+    ring_interval_us = other.ring_interval_us;
+    // The host log is reopened for appending on the next timer
+    host_log_file.close();
+    return *this;
+}
+
+Profiler::~Profiler()
+{
+#if defined(PROFILER)
+    {
+        std::lock_guard<std::mutex> lock(ring_mutex);
+        ring_thread_stop = true;
+    }
+    ring_cv.notify_all();
+    if (ring_thread.joinable()) {
+        ring_thread.join();
+    }
 #endif
 }
 
+void Profiler::ringLoop()
+{
+    std::unique_lock<std::mutex> lock(ring_mutex);
+    while (not ring_cv.wait_for(lock, std::chrono::microseconds(ring_interval_us), [this] { return ring_thread_stop; })) {
+        try {
+            for (auto &[device_id, device_ring] : device_rings) {
+                drainDeviceRing(device_id, device_ring);
+            }
+        } catch (const std::exception &e) {
+            log_error(tt::LogDevice, "Device profiler ring thread stopped: {}", e.what());
+            return;
+        }
+    }
+}
+
+void Profiler::drainDeviceRing(int device_id, DeviceProfilerRing& device_ring)
+{
+    constexpr uint32_t RING_SIZE = kernel_profiler::ring_num_markers(PRINT_BUFFER_SIZE);
+    constexpr uint32_t HEADER_BYTES = kernel_profiler::MARKER_DATA_START * sizeof(uint32_t);
+    constexpr uint32_t RING_BYTES = RING_SIZE * kernel_profiler::TIMER_DATA_UINT32_SIZE * sizeof(uint32_t);
+
+    std::string log_data;
+    for (auto &ring : device_ring.risc_rings) {
+        RiscProfilerBuffer& buffer = ring.buffer;
+        vector<uint32_t> header = tt::llrt::read_hex_vec_from_core(device_id, buffer.core, buffer.buffer_addr, HEADER_BYTES);
+        if (header[kernel_profiler::RING_STATE] != kernel_profiler::RING_STARTED) {
+            // The RISC hasn't run since the device was opened
+            continue;
+        }
+        uint32_t write_count = header[kernel_profiler::RING_WRITE_COUNT];
+        uint32_t num_waiting = write_count - ring.read_count;
+        if (num_waiting == 0) {
+            continue;
+        }
+        ring.stats.high_watermark = std::max(ring.stats.high_watermark, num_waiting);
+
+        vector<uint32_t> ring_data = tt::llrt::read_hex_vec_from_core(device_id, buffer.core, buffer.buffer_addr + HEADER_BYTES, RING_BYTES);
+        // The slot of marker n is reused by marker n + RING_SIZE, which may already be on its way in once the count
+        // reaches it. Markers that old by the end of the read are lost
+        uint32_t write_count_after = tt::llrt::read_hex_vec_from_core(device_id, buffer.core, buffer.buffer_addr, sizeof(uint32_t))[0];
+        uint32_t first = ring.read_count;
+        if (write_count_after - first > RING_SIZE - 1) {
+            first = write_count_after - (RING_SIZE - 1);
+        }
+        uint32_t num_markers = int32_t(write_count - first) > 0 ? write_count - first : 0;
+        uint32_t num_overwritten = num_waiting - num_markers;
+
+        buffer.marker_data.resize(num_markers * kernel_profiler::TIMER_DATA_UINT32_SIZE);
+        for (uint32_t m = 0; m < num_markers; m++) {
+            uint32_t slot = (first + m) % RING_SIZE;
+            std::copy_n(
+                ring_data.begin() + slot * kernel_profiler::TIMER_DATA_UINT32_SIZE,
+                kernel_profiler::TIMER_DATA_UINT32_SIZE,
+                buffer.marker_data.begin() + m * kernel_profiler::TIMER_DATA_UINT32_SIZE);
+        }
+        appendDeviceResults(log_data, device_id, buffer);
+
+        if (num_overwritten > 0 and ring.stats.num_overwritten_markers == 0) {
+            log_warning(
+                tt::LogDevice,
+                "Device profiler ring of device {} physical core {},{} risc {} was overwritten before the host read it, "
+                "{} markers lost. Drain it more often with a shorter TT_METAL_DEVICE_PROFILER_RING interval",
+                device_id,
+                buffer.core.x,
+                buffer.core.y,
+                buffer.risc_name,
+                num_overwritten);
+        }
+        ring.stats.num_markers += num_markers;
+        ring.stats.num_overwritten_markers += num_overwritten;
+        ring.read_count = write_count;
+    }
+
+    if (not log_data.empty()) {
+        dumpDeviceResultsToFile(log_data);
+        if (TraceExporter::enabled()) {
+            TraceExporter::inst().flush();
+        }
+    }
+}
+
+void Profiler::addDeviceRingCores(
+    int device_id, tt::ARCH device_arch, const vector<CoreCoord> &worker_cores, const vector<CoreCoord> &eth_cores)
+{
+#if defined(PROFILER)
+    constexpr uint32_t RING_SIZE = kernel_profiler::ring_num_markers(PRINT_BUFFER_SIZE);
+    std::lock_guard<std::mutex> lock(ring_mutex);
+    device_architecture = device_arch;
+    device_core_frequency = tt::Cluster::instance().get_device_aiclk(device_id);
+
+    DeviceProfilerRing& device_ring = device_rings[device_id];
+    auto add_ring = [&](const CoreCoord &core, const std::string &risc_name, uint32_t buffer_addr) {
+        RiscProfilerRing ring;
+        ring.buffer = {.core = core, .risc_name = risc_name, .buffer_addr = buffer_addr};
+        ring.stats = {.core = core, .risc_name = risc_name, .ring_size = RING_SIZE};
+        device_ring.risc_rings.push_back(std::move(ring));
+    };
+    for (const auto &worker_core : worker_cores) {
+        if (device_ring.cores.insert(worker_core).second) {
+            add_ring(worker_core, "NCRISC", PRINT_BUFFER_NC);
+            add_ring(worker_core, "BRISC", PRINT_BUFFER_BR);
+            add_ring(worker_core, "TRISC_0", PRINT_BUFFER_T0);
+            add_ring(worker_core, "TRISC_1", PRINT_BUFFER_T1);
+            add_ring(worker_core, "TRISC_2", PRINT_BUFFER_T2);
+        }
+    }
+    for (const auto &eth_core : eth_cores) {
+        if (device_ring.cores.insert(eth_core).second) {
+            add_ring(eth_core, "ERISC", eth_l1_mem::address_map::PRINT_BUFFER_ER);
+        }
+    }
+
+    if (TraceExporter::enabled() and not device_ring.risc_rings.empty()) {
+        alignDeviceClock(device_id, device_ring.risc_rings.front().buffer.core, device_core_frequency);
+    }
+
+    if (not ring_thread.joinable()) {
+        ring_thread = std::thread(&Profiler::ringLoop, this);
+    }
+#endif
+}
+
+void Profiler::detachDeviceRing(int device_id)
+{
+#if defined(PROFILER)
+    // The ring thread keeps running without devices to drain, until the profiler goes away
+    std::lock_guard<std::mutex> lock(ring_mutex);
+    auto device_ring = device_rings.find(device_id);
+    if (device_ring == device_rings.end()) {
+        return;
+    }
+    drainDeviceRing(device_id, device_ring->second);
+
+    uint64_t num_markers = 0;
+    uint64_t num_overwritten_markers = 0;
+    uint32_t high_watermark = 0;
+    for (const auto &ring : device_ring->second.risc_rings) {
+        num_markers += ring.stats.num_markers;
+        num_overwritten_markers += ring.stats.num_overwritten_markers;
+        high_watermark = std::max(high_watermark, ring.stats.high_watermark);
+    }
+    log_info(
+        tt::LogDevice,
+        "Device profiler ring of device {} drained {} markers, {} overwritten, high watermark {} of {}",
+        device_id,
+        num_markers,
+        num_overwritten_markers,
+        high_watermark,
+        kernel_profiler::ring_num_markers(PRINT_BUFFER_SIZE));
+    device_rings.erase(device_ring);
+#endif
+}
+
+vector<DeviceProfilerRingStats> Profiler::getDeviceRingStats(int device_id)
+{
+    vector<DeviceProfilerRingStats> stats;
+#if defined(PROFILER)
+    std::lock_guard<std::mutex> lock(ring_mutex);
+    auto device_ring = device_rings.find(device_id);
+    if (device_ring != device_rings.end()) {
+        for (const auto &ring : device_ring->second.risc_rings) {
+            stats.push_back(ring.stats);
+        }
+    }
+#endif
+    return stats;
+}
+
 void Profiler::markStart(const std::string& timer_name)
 {
 #if defined(PROFILER)
@@ -183,6 +486,8 @@ void Profiler::markStop(const std::string& timer_name, const std::vector<std::pa
 void Profiler::setDeviceNewLogFlag(bool new_log_flag)
 {
 #if defined(PROFILER)
+    // The ring thread writes the device side log
+    std::lock_guard<std::mutex> lock(ring_mutex);
     device_new_log = new_log_flag;
 #endif
 }
@@ -198,48 +503,91 @@ void Profiler::setOutputDir(const std::string& new_output_dir)
 {
 #if defined(PROFILER)
     std::filesystem::create_directories(new_output_dir);
+    std::lock_guard<std::mutex> lock(ring_mutex);
     output_dir = new_output_dir;
+    host_log_file.close();
 #endif
 }
 
 void Profiler::setDeviceArchitecture(tt::ARCH device_arch)
 {
 #if defined(PROFILER)
+    std::lock_guard<std::mutex> lock(ring_mutex);
     device_architecture = device_arch;
 #endif
 }
 
-void Profiler::dumpTensixDeviceResults(int device_id, const vector<CoreCoord> &worker_cores) {
+void Profiler::dumpDeviceResults(int device_id, const vector<CoreCoord> &worker_cores, const vector<CoreCoord> &eth_cores) {
 #if defined(PROFILER)
+    // The dump itself goes into the host side log, so its cost can be told apart from the ops it profiles
+    std::string timer_name = "DumpDeviceProfilerBuffers " + std::to_string(device_id);
+    markStart(timer_name);
+
     device_core_frequency = tt::Cluster::instance().get_device_aiclk(device_id);
+    vector<RiscProfilerBuffer> buffers;
+    buffers.reserve(worker_cores.size() * 5 + eth_cores.size());
     for (const auto &worker_core : worker_cores) {
-        readRiscProfilerResults(
-            device_id,
-            worker_core,
-            "NCRISC",
-            PRINT_BUFFER_NC);
-        readRiscProfilerResults(
-            device_id,
-            worker_core,
-            "BRISC",
-            PRINT_BUFFER_BR);
-        readRiscProfilerResults(
-            device_id,
-            worker_core,
-            "TRISC_0",
-            PRINT_BUFFER_T0);
-        readRiscProfilerResults(device_id, worker_core, "TRISC_1", PRINT_BUFFER_T1);
-        readRiscProfilerResults(device_id, worker_core, "TRISC_2", PRINT_BUFFER_T2);
+        buffers.push_back({.core = worker_core, .risc_name = "NCRISC", .buffer_addr = PRINT_BUFFER_NC});
+        buffers.push_back({.core = worker_core, .risc_name = "BRISC", .buffer_addr = PRINT_BUFFER_BR});
+        buffers.push_back({.core = worker_core, .risc_name = "TRISC_0", .buffer_addr = PRINT_BUFFER_T0});
+        buffers.push_back({.core = worker_core, .risc_name = "TRISC_1", .buffer_addr = PRINT_BUFFER_T1});
+        buffers.push_back({.core = worker_core, .risc_name = "TRISC_2", .buffer_addr = PRINT_BUFFER_T2});
     }
+    for (const auto &eth_core : eth_cores) {
+        buffers.push_back({.core = eth_core, .risc_name = "ERISC", .buffer_addr = eth_l1_mem::address_map::PRINT_BUFFER_ER});
+    }
+    if (TraceExporter::enabled() and not buffers.empty()) {
+        alignDeviceClock(device_id, buffers.front().core, device_core_frequency);
+    }
+    uint64_t num_bytes_read = readRiscProfilerBuffers(device_id, buffers);
+
+    // Format the buffers in parallel, but keep the log in the order of the cores
+    vector<std::string> buffer_log_data(buffers.size());
+    detail::parallel_for(buffers.size(), 32, [&](size_t begin, size_t end) {
+        for (size_t b = begin; b < end; b++) {
+            appendDeviceResults(buffer_log_data[b], device_id, buffers[b]);
+        }
+    });
+    std::string log_data;
+    size_t log_size = 0;
+    for (const auto &data : buffer_log_data) {
+        log_size += data.size();
+    }
+    log_data.reserve(log_size);
+    for (const auto &data : buffer_log_data) {
+        log_data += data;
+    }
+    dumpDeviceResultsToFile(log_data);
+
+    // Host timers written so far are on disk by the time a device dump returns
+    if (host_log_file.is_open()) {
+        host_log_file.flush();
+    }
+    if (TraceExporter::enabled()) {
+        TraceExporter::inst().flush();
+    }
+
+    markStop(timer_name);
+    const TimerPeriod& timer = name_to_timer_map[timer_name];
+    log_debug(
+        tt::LogDevice,
+        "Dumped {} profiler buffers of device {}, {} bytes read back in {} us",
+        buffers.size(),
+        device_id,
+        num_bytes_read,
+        duration_cast<std::chrono::microseconds>(timer.stop - timer.start).count());
+#endif
+}
+
+void Profiler::dumpTensixDeviceResults(int device_id, const vector<CoreCoord> &worker_cores) {
+#if defined(PROFILER)
+    dumpDeviceResults(device_id, worker_cores, {});
 #endif
 }
 
 void Profiler::dumpEthernetDeviceResults(int device_id, const vector<CoreCoord> &eth_cores) {
 #if defined(PROFILER)
-    device_core_frequency = tt::Cluster::instance().get_device_aiclk(device_id);
-    for (const auto &eth_core : eth_cores) {
-        readRiscProfilerResults(device_id, eth_core, "ERISC", eth_l1_mem::address_map::PRINT_BUFFER_ER);
-    }
+    dumpDeviceResults(device_id, {}, eth_cores);
 #endif
 }
 
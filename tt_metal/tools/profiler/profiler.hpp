@@ -8,7 +8,13 @@
 #include <string>
 #include <unordered_map>
 #include <iostream>
+#include <fstream>
 #include <filesystem>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <unordered_set>
 
 #include "llrt/llrt.hpp"
 #include "tools/profiler/profiler_state.hpp"
@@ -36,6 +42,31 @@ struct TimerPeriod {
     steady_clock::time_point stop;
 };
 
+// struct for holding the profiler buffer of one RISC, read back from the device in two phases
+struct RiscProfilerBuffer {
+    CoreCoord core;
+    std::string risc_name;
+    uint32_t buffer_addr;
+    uint32_t end_index = 0;
+    uint32_t dropped_marker_counter = 0;
+    // Only the populated part of the buffer, starting at kernel_profiler::MARKER_DATA_START
+    vector<uint32_t> marker_data;
+};
+
+// struct for holding the ring mode state of one RISC profiler buffer
+struct RiscProfilerRing {
+    RiscProfilerBuffer buffer;
+    // Markers taken off the ring, wraps around like the device's write count
+    uint32_t read_count = 0;
+    DeviceProfilerRingStats stats;
+};
+
+// struct for holding the ring mode state of all profiled cores of one chip
+struct DeviceProfilerRing {
+    std::unordered_set<CoreCoord> cores;
+    vector<RiscProfilerRing> risc_rings;
+};
+
 class Profiler {
     private:
         // Holds name to timers
@@ -56,6 +87,12 @@ class Profiler {
         // Output Dir for Profile Logs
         std::filesystem::path output_dir;
 
+        // Host side log, kept open so timers are written through the stream's buffer
+        std::ofstream host_log_file;
+
+        // Write the device side log in the binary format instead of CSV
+        bool device_binary_log;
+
         // Turn steady clock start and stop into integer start, stop and duration
         TimerPeriodInt timerToTimerInt(TimerPeriod period);
         //
@@ -64,26 +101,44 @@ class Profiler {
                 const std::string& timer_name,
                 const std::vector<std::pair<std::string,std::string>>& additional_fields = {});
 
-        // Dumping profile result to file
-        void dumpDeviceResultToFile(
-                int chip_id,
-                int core_x,
-                int core_y,
-                std::string hart_name,
-                uint64_t timestamp,
-                uint32_t timer_id);
-
-        // Helper function for reading risc profile results
-        void readRiscProfilerResults(
-                int device_id,
-                const CoreCoord &worker_core,
-                std::string risc_name,
-                int risc_print_buffer_addr);
+        // Appending the markers of one RISC to the log data of a dump, in the format of the device side log
+        void appendDeviceResults(std::string& log_data, int chip_id, const RiscProfilerBuffer& buffer);
+
+        // Writing the log data of a dump to the device side log in one go
+        void dumpDeviceResultsToFile(const std::string& log_data);
+
+        // Ring mode, the profiled cores of every chip are drained by ring_thread every ring_interval_us. ring_mutex
+        // also guards the device side log settings the ring thread reads: output_dir, device_new_log and
+        // device_architecture
+        std::map<int, DeviceProfilerRing> device_rings;
+        std::mutex ring_mutex;
+        std::condition_variable ring_cv;
+        std::thread ring_thread;
+        bool ring_thread_stop = false;
+        uint32_t ring_interval_us = 0;
+
+        // Body of ring_thread
+        void ringLoop();
+
+        // Appending the markers written to the rings of one chip since the last drain to the device side log,
+        // called with ring_mutex held
+        void drainDeviceRing(int device_id, DeviceProfilerRing& device_ring);
+
+        // Reading the profiler buffers of one chip, first the end index and dropped marker counter of every buffer
+        // and then only their populated ranges. Returns the number of bytes read
+        uint64_t readRiscProfilerBuffers(int device_id, vector<RiscProfilerBuffer>& buffers);
 
     public:
         //Constructor
         Profiler();
 
+        //Copies the timers and settings, but not the open host log or the ring mode state, those stay with the original
+        Profiler(const Profiler& other);
+        Profiler& operator=(const Profiler& other);
+
+        //Destructor, stops the ring thread
+        ~Profiler();
+
         //Mark the steady_clock for the start of the asked name
         void markStart(const std::string& timer_name);
 
@@ -102,11 +157,23 @@ class Profiler {
         //Change the output dir of the profile logs
         void setOutputDir(const std::string& new_output_dir);
 
+        // Read back all tensix and ethernet cores of the device as one batch and dump the device profile results
+        void dumpDeviceResults(int device_id, const vector<CoreCoord>& worker_cores, const vector<CoreCoord>& eth_cores);
+
         // Traverse all tensix cores on the device and dump the device profile results
         void dumpTensixDeviceResults(int device_id, const vector<CoreCoord>& worker_cores);
 
         // Traverse all ethernet cores on the device and dump the device profile results
         void dumpEthernetDeviceResults(int device_id, const vector<CoreCoord>& eth_cores);
+
+        // Ring mode, have the ring thread drain the tensix and ethernet cores of the device from now on
+        void addDeviceRingCores(int device_id, tt::ARCH device_arch, const vector<CoreCoord>& worker_cores, const vector<CoreCoord>& eth_cores);
+
+        // Ring mode, drain the device one last time and stop draining it
+        void detachDeviceRing(int device_id);
+
+        // Ring mode, counters of every RISC buffer drained on the device
+        vector<DeviceProfilerRingStats> getDeviceRingStats(int device_id);
 };
 
 }  // namespace tt_metal
@@ -0,0 +1,236 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <filesystem>
+
+#include "tools/profiler/trace_exporter.hpp"
+#include "tools/profiler/common.hpp"
+#include "hostdevcommon/profiler_common.h"
+#include "llrt/rtoptions.hpp"
+#include "common/assert.hpp"
+#include "common/logger.hpp"
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace {
+
+constexpr int HOST_PID = 0;
+
+int device_pid(int chip_id) { return chip_id + 1; }
+
+uint64_t steady_clock_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::string json_escape(std::string_view s) {
+    std::string escaped;
+    escaped.reserve(s.size());
+    for (char c : s) {
+        if (c == '"' or c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            escaped += fmt::format("\\u{:04x}", int(c));
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+std::string json_args(const std::vector<std::pair<std::string, std::string>> &args) {
+    std::string json = "{";
+    for (const auto &[key, value] : args) {
+        if (json.size() > 1) {
+            json += ",";
+        }
+        json += fmt::format("\"{}\":\"{}\"", json_escape(key), json_escape(value));
+    }
+    return json + "}";
+}
+
+std::string metadata_event(std::string_view what, int pid, int tid, std::string_view name) {
+    return fmt::format(
+        "{{\"name\":\"{}\",\"ph\":\"M\",\"pid\":{},\"tid\":{},\"args\":{{\"name\":\"{}\"}}}}", what, pid, tid, json_escape(name));
+}
+
+}  // namespace
+
+bool TraceExporter::enabled() {
+#if defined(PROFILER)
+    static const bool trace_enabled = not tt::llrt::OptionsG.get_profiler_trace_file().empty();
+    return trace_enabled;
+#else
+    return false;
+#endif
+}
+
+TraceExporter &TraceExporter::inst() {
+    static TraceExporter trace_exporter;
+    return trace_exporter;
+}
+
+TraceExporter::TraceExporter() {
+    if (not enabled()) {
+        return;
+    }
+    std::filesystem::path trace_path = tt::llrt::OptionsG.get_profiler_trace_file();
+    if (trace_path == "1") {
+        trace_path = std::filesystem::path(std::string(PROFILER_RUNTIME_ROOT_DIR) + std::string(PROFILER_LOGS_DIR_NAME)) / "profile_trace.json";
+    }
+    if (trace_path.has_parent_path()) {
+        std::filesystem::create_directories(trace_path.parent_path());
+    }
+    trace_.open(trace_path);
+    TT_FATAL(trace_.is_open(), "Cannot open the profiler trace {}", trace_path.string());
+    log_info(tt::LogMetal, "Writing the profiler trace to {}", trace_path.string());
+
+    trace_ << "[\n";
+    write_event(metadata_event("process_name", HOST_PID, 0, "Host"));
+}
+
+TraceExporter::~TraceExporter() {
+    if (trace_.is_open()) {
+        trace_ << "\n]\n";
+        trace_.close();
+    }
+}
+
+void TraceExporter::write_event(const std::string &event) {
+    if (not first_event_) {
+        trace_ << ",\n";
+    }
+    trace_ << event;
+    first_event_ = false;
+}
+
+int TraceExporter::host_tid() {
+    auto [tid, added] = host_tids_.try_emplace(std::this_thread::get_id(), host_tids_.size());
+    if (added) {
+        std::string thread_name = tid->second == 0 ? "Main thread" : fmt::format("Thread {}", tid->second);
+        write_event(metadata_event("thread_name", HOST_PID, tid->second, thread_name));
+    }
+    return tid->second;
+}
+
+TraceExporter::DeviceTrack &TraceExporter::device_track(int chip_id, int core_x, int core_y, const std::string &risc_name) {
+    auto [track, added] = device_tracks_.try_emplace(std::make_tuple(chip_id, core_x, core_y, risc_name));
+    if (added) {
+        int &num_tracks = num_device_tracks_[chip_id];
+        if (num_tracks == 0) {
+            write_event(metadata_event("process_name", device_pid(chip_id), 0, fmt::format("Device {}", chip_id)));
+        }
+        track->second.tid = num_tracks++;
+        write_event(metadata_event(
+            "thread_name", device_pid(chip_id), track->second.tid, fmt::format("Core {},{} {}", core_x, core_y, risc_name)));
+    }
+    return track->second;
+}
+
+double TraceExporter::device_ns(const DeviceClock &clock, uint64_t cycles) const {
+    return double(clock.anchor_host_ns) + (double(cycles) - double(clock.anchor_cycles)) * clock.ns_per_cycle;
+}
+
+void TraceExporter::add_host_span(
+    std::string_view name,
+    std::string_view category,
+    uint64_t start_ns,
+    uint64_t stop_ns,
+    const std::vector<std::pair<std::string, std::string>> &args) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    write_event(fmt::format(
+        "{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\",\"pid\":{},\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f},\"args\":{}}}",
+        json_escape(name),
+        category,
+        HOST_PID,
+        host_tid(),
+        trace_us(start_ns),
+        (stop_ns - start_ns) / 1000.0,
+        json_args(args)));
+}
+
+void TraceExporter::align_device_clock(int chip_id, uint64_t device_cycles, uint64_t host_ns, int chip_freq_mhz) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    TT_ASSERT(chip_freq_mhz > 0);
+    device_clocks_.try_emplace(chip_id, DeviceClock{device_cycles, host_ns, 1000.0 / chip_freq_mhz});
+}
+
+bool TraceExporter::device_clock_aligned(int chip_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return device_clocks_.find(chip_id) != device_clocks_.end();
+}
+
+void TraceExporter::add_device_markers(
+    int chip_id, int core_x, int core_y, const std::string &risc_name, const std::vector<uint32_t> &marker_data) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto clock = device_clocks_.find(chip_id);
+    TT_ASSERT(clock != device_clocks_.end(), "Device {} markers added before its clock was aligned", chip_id);
+    DeviceTrack &track = device_track(chip_id, core_x, core_y, risc_name);
+    int pid = device_pid(chip_id);
+
+    auto write_span = [&](std::string_view name, uint64_t start_cycles, uint64_t stop_cycles) {
+        write_event(fmt::format(
+            "{{\"name\":\"{}\",\"cat\":\"device\",\"ph\":\"X\",\"pid\":{},\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f},"
+            "\"args\":{{\"cycles\":{}}}}}",
+            name,
+            pid,
+            track.tid,
+            trace_us(device_ns(clock->second, start_cycles)),
+            (stop_cycles - start_cycles) * clock->second.ns_per_cycle / 1000.0,
+            stop_cycles - start_cycles));
+    };
+    for (size_t i = 0; i + kernel_profiler::TIMER_DATA_UINT32_SIZE <= marker_data.size(); i += kernel_profiler::TIMER_DATA_UINT32_SIZE) {
+        uint32_t timer_id = marker_data[i + kernel_profiler::TIMER_ID];
+        uint64_t cycles = (uint64_t(marker_data[i + kernel_profiler::TIMER_VAL_H]) << 32) | marker_data[i + kernel_profiler::TIMER_VAL_L];
+        if (timer_id == CC_MAIN_START) {
+            track.fw_start_cycles = cycles;
+        } else if (timer_id == CC_KERNEL_MAIN_START) {
+            track.kernel_start_cycles = cycles;
+        } else if (timer_id == CC_KERNEL_MAIN_END and track.kernel_start_cycles != 0 and cycles >= track.kernel_start_cycles) {
+            write_span("Kernel", track.kernel_start_cycles, cycles);
+            track.kernel_start_cycles = 0;
+        } else if (timer_id == CC_MAIN_END and track.fw_start_cycles != 0 and cycles >= track.fw_start_cycles) {
+            write_span("FW", track.fw_start_cycles, cycles);
+            track.fw_start_cycles = 0;
+        } else {
+            // Custom markers, and ends whose start was dropped or overwritten on device
+            write_event(fmt::format(
+                "{{\"name\":\"Marker {}\",\"cat\":\"device\",\"ph\":\"i\",\"s\":\"t\",\"pid\":{},\"tid\":{},\"ts\":{:.3f}}}",
+                timer_id,
+                pid,
+                track.tid,
+                trace_us(device_ns(clock->second, cycles))));
+        }
+    }
+}
+
+void TraceExporter::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    trace_.flush();
+}
+
+TraceScope::TraceScope(std::string_view name, std::string_view category, int device_id) :
+    name_(name), category_(category), device_id_(device_id) {
+    if (TraceExporter::enabled()) {
+        start_ns_ = steady_clock_ns();
+    }
+}
+
+TraceScope::~TraceScope() {
+    if (start_ns_ == 0) {
+        return;
+    }
+    std::vector<std::pair<std::string, std::string>> args;
+    if (device_id_ >= 0) {
+        args.emplace_back("device", std::to_string(device_id_));
+    }
+    TraceExporter::inst().add_host_span(name_, category_, start_ns_, steady_clock_ns(), args);
+}
+
+}  // namespace tt_metal
+
+}  // namespace tt
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tt {
+
+namespace tt_metal {
+
+// Writes one Chrome trace event file per run, opened by chrome://tracing and ui.perfetto.dev, holding host op and
+// tt_metal spans, command queue spans and device RISC markers on one time base. Enabled by TT_METAL_PROFILER_TRACE in
+// profiler builds, see RunTimeOptions::get_profiler_trace_file.
+//
+// Host spans are steady_clock times. Device cycles are turned into time with the chip's clock frequency, from an anchor
+// set once per chip: the host reads the chip's RISC wall clock and pairs it with the steady_clock time halfway through
+// the read. Device spans are only approximately placed against host spans: the anchor is off by up to half the read's
+// round trip, and the error grows over a run as far as the chip's clock differs from its reported frequency.
+class TraceExporter {
+   public:
+    TraceExporter(const TraceExporter &) = delete;
+    TraceExporter &operator=(const TraceExporter &) = delete;
+
+    static TraceExporter &inst();
+    static bool enabled();
+
+    // Span on the track of the calling thread, times in steady_clock ns since its epoch
+    void add_host_span(
+        std::string_view name,
+        std::string_view category,
+        uint64_t start_ns,
+        uint64_t stop_ns,
+        const std::vector<std::pair<std::string, std::string>> &args = {});
+
+    // Anchors the clock of the chip unless it already has an anchor
+    void align_device_clock(int chip_id, uint64_t device_cycles, uint64_t host_ns, int chip_freq_mhz);
+    bool device_clock_aligned(int chip_id);
+
+    // Markers of one RISC in the order they were written, laid out like the profiler buffer from MARKER_DATA_START.
+    // FW and kernel start and end markers become spans, even when they come in separate calls, the rest instants
+    void add_device_markers(
+        int chip_id, int core_x, int core_y, const std::string &risc_name, const std::vector<uint32_t> &marker_data);
+
+    // Makes the events so far readable by a viewer, the closing bracket is only written at exit
+    void flush();
+
+   private:
+    TraceExporter();
+    ~TraceExporter();
+
+    struct DeviceClock {
+        uint64_t anchor_cycles;
+        uint64_t anchor_host_ns;
+        double ns_per_cycle;
+    };
+
+    struct DeviceTrack {
+        int tid;
+        uint64_t fw_start_cycles = 0;
+        uint64_t kernel_start_cycles = 0;
+    };
+
+    // Trace time in us of a steady_clock or device time in ns, the trace keeps steady_clock's epoch
+    static double trace_us(double ns) { return ns / 1000.0; }
+    double device_ns(const DeviceClock &clock, uint64_t cycles) const;
+    int host_tid();
+    DeviceTrack &device_track(int chip_id, int core_x, int core_y, const std::string &risc_name);
+    void write_event(const std::string &event);
+
+    std::mutex mutex_;
+    std::ofstream trace_;
+    bool first_event_ = true;
+    std::unordered_map<std::thread::id, int> host_tids_;
+    std::map<int, DeviceClock> device_clocks_;
+    std::map<std::tuple<int, int, int, std::string>, DeviceTrack> device_tracks_;
+    std::map<int, int> num_device_tracks_;
+};
+
+// Adds a span on the calling thread's track from construction to destruction, when the trace is enabled
+class TraceScope {
+   public:
+    TraceScope(std::string_view name, std::string_view category, int device_id = -1);
+    ~TraceScope();
+
+   private:
+    std::string_view name_;
+    std::string_view category_;
+    int device_id_;
+    uint64_t start_ns_ = 0;
+};
+
+}  // namespace tt_metal
+
+}  // namespace tt
@@ -30,28 +30,48 @@ void DumpDeviceProfileResults(
     if (getDeviceProfilerState())
     {
         ProfileTTMetalScope profile_this = ProfileTTMetalScope("DumpDeviceProfileResults");
-        //TODO: (MO) This global is temporary need to update once the new interface is in
-        if (std::getenv("TT_METAL_SLOW_DISPATCH_MODE") == nullptr) {
-            Finish(GetCommandQueue(device));
-        }
-
         TT_FATAL(DprintServerIsRunning() == false, "Debug print server is running, cannot dump device profiler data");
         auto device_id = device->id();
-        tt_metal_profiler.setDeviceArchitecture(device->arch());
+        std::vector<CoreCoord> worker_cores_used_in_program;
+        std::vector<CoreCoord> ethernet_cores_used_in_program;
         if (logical_cores.find(CoreType::WORKER) != logical_cores.end()) {
-            auto worker_cores_used_in_program =
+            worker_cores_used_in_program =
                 device->worker_cores_from_logical_cores(logical_cores.at(CoreType::WORKER));
-            tt_metal_profiler.dumpTensixDeviceResults(device_id, worker_cores_used_in_program);
         }
         if (logical_cores.find(CoreType::ETH) != logical_cores.end()) {
-            auto ethernet_cores_used_in_program =
+            ethernet_cores_used_in_program =
                 device->ethernet_cores_from_logical_cores(logical_cores.at(CoreType::ETH));
-            tt_metal_profiler.dumpEthernetDeviceResults(device_id, ethernet_cores_used_in_program);
         }
+
+        if (tt::llrt::OptionsG.get_profiler_ring_enabled()) {
+            // The ring thread drains these cores from now on, while programs keep running
+            tt_metal_profiler.addDeviceRingCores(
+                device_id, device->arch(), worker_cores_used_in_program, ethernet_cores_used_in_program);
+            return;
+        }
+
+        //TODO: (MO) This global is temporary need to update once the new interface is in
+        if (std::getenv("TT_METAL_SLOW_DISPATCH_MODE") == nullptr) {
+            Finish(GetCommandQueue(device));
+        }
+
+        tt_metal_profiler.setDeviceArchitecture(device->arch());
+        // All cores of the chip are read back as one batch
+        tt_metal_profiler.dumpDeviceResults(device_id, worker_cores_used_in_program, ethernet_cores_used_in_program);
     }
 #endif
 }
 
+void DetachDeviceProfilerRing(Device *device) {
+#if defined(PROFILER)
+    tt_metal_profiler.detachDeviceRing(device->id());
+#endif
+}
+
+std::vector<DeviceProfilerRingStats> GetDeviceProfilerRingStats(Device *device) {
+    return tt_metal_profiler.getDeviceRingStats(device->id());
+}
+
 void SetProfilerDir(std::string output_dir){
 #if defined(PROFILER)
      tt_metal_profiler.setOutputDir(output_dir);
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Converts a binary device profiler log, written with TT_METAL_DEVICE_PROFILER_BINARY_LOG, into the
+// profile_log_device.csv that process_device_log.py reads. The log is streamed a block of records at a time, so its
+// size isn't bound by host memory. Does not need a device.
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "common/assert.hpp"
+#include "tt_metal/tools/profiler/device_log.hpp"
+
+using namespace tt::tt_metal;
+
+namespace {
+
+constexpr size_t RECORDS_PER_READ = 1 << 16;
+
+void print_usage() {
+    std::cout << "Usage: profiler_log_convert <profile_log_device.bin> [<output csv>]\n"
+              << "  The output defaults to the input with a .csv extension\n";
+}
+
+// Returns the name stored in a fixed size field, which is zero padded but not necessarily terminated
+template <size_t N>
+std::string device_log_name(const char (&field)[N]) {
+    return std::string(field, strnlen(field, N));
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    if (argc < 2 or argc > 3 or std::strcmp(argv[1], "--help") == 0) {
+        print_usage();
+        return argc < 2 or argc > 3 ? 1 : 0;
+    }
+    std::filesystem::path input_path = argv[1];
+    std::filesystem::path output_path = argc == 3 ? std::filesystem::path(argv[2]) : std::filesystem::path(input_path).replace_extension(".csv");
+
+    std::ifstream input(input_path, std::ios_base::binary);
+    TT_FATAL(input.is_open(), "Cannot open {}", input_path.string());
+    DeviceLogFileHeader header;
+    input.read(reinterpret_cast<char *>(&header), sizeof(header));
+    TT_FATAL(input.gcount() == sizeof(header) and header.magic == DEVICE_LOG_MAGIC, "{} is not a binary device profiler log", input_path.string());
+
+    std::ofstream output(output_path);
+    TT_FATAL(output.is_open(), "Cannot open {}", output_path.string());
+    WriteDeviceLogCsvHeader(output, device_log_name(header.arch), header.chip_freq_mhz);
+
+    uint64_t num_blocks = 0;
+    uint64_t num_records = 0;
+    uint64_t num_dropped_markers = 0;
+    std::vector<DeviceLogRecord> records(RECORDS_PER_READ);
+    DeviceLogBlockHeader block;
+    while (input.read(reinterpret_cast<char *>(&block), sizeof(block))) {
+        std::string risc = device_log_name(block.risc);
+        for (uint32_t num_left = block.num_records; num_left > 0;) {
+            size_t num_to_read = std::min<size_t>(num_left, RECORDS_PER_READ);
+            input.read(reinterpret_cast<char *>(records.data()), num_to_read * sizeof(DeviceLogRecord));
+            TT_FATAL(size_t(input.gcount()) == num_to_read * sizeof(DeviceLogRecord), "{} ends in the middle of a block", input_path.string());
+            for (size_t i = 0; i < num_to_read; i++) {
+                WriteDeviceLogCsvRecord(output, block.chip_id, block.core_x, block.core_y, risc, records[i].timer_id, records[i].timestamp);
+            }
+            num_left -= num_to_read;
+        }
+        num_blocks++;
+        num_records += block.num_records;
+        num_dropped_markers += block.num_dropped_markers;
+    }
+    TT_FATAL(input.gcount() == 0, "{} ends in the middle of a block header", input_path.string());
+
+    output.close();
+    std::cout << "Wrote " << num_records << " markers of " << num_blocks << " RISCs to " << output_path.string() << "\n";
+    if (num_dropped_markers > 0) {
+        std::cout << num_dropped_markers << " markers were dropped on device\n";
+    }
+    return 0;
+}
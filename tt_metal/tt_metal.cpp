@@ -77,11 +77,15 @@ inline void SetRuntimeArgs(const Program &program, KernelHandle kernel_id, const
 
 inline void SetRuntimeArgs(const Program &program, KernelHandle kernel_id, const CoreRange &core_range, const std::vector<uint32_t> &runtime_args)
 {
+    std::vector<CoreCoord> cores;
+    cores.reserve(core_range.size());
     for (auto x = core_range.start.x; x <= core_range.end.x; x++) {
         for (auto y = core_range.start.y; y <= core_range.end.y; y++) {
-            SetRuntimeArgs(program, kernel_id, CoreCoord(x,y), runtime_args);
+            cores.push_back(CoreCoord(x,y));
         }
     }
+    // A stride of 0 gives every core the same args
+    detail::GetKernel(program, kernel_id)->set_runtime_args(cores, runtime_args.data(), runtime_args.size(), 0);
 }
 
 }  // namespace
@@ -538,7 +542,7 @@ namespace detail {
             for (const auto &logical_core : kernel->cores_with_runtime_args()) {
                 auto physical_core = device->physical_core_from_logical_core(logical_core, kernel->get_kernel_core_type());
                 const auto & rt_args = kernel->runtime_args(logical_core);
-                tt::llrt::write_hex_vec_to_core(device_id, physical_core, rt_args, get_l1_arg_base_addr(processor));
+                tt::Cluster::instance().write_core(rt_args.data(), rt_args.size() * sizeof(uint32_t), tt_cxy_pair(device_id, physical_core), get_l1_arg_base_addr(processor));
             }
         }
     }
@@ -710,7 +714,13 @@ void SetRuntimeArgs(const Program &program, KernelHandle kernel, const std::vect
         k->set_runtime_args(core_spec[i], runtime_args[i]);
 }
 
-std::vector<uint32_t> & GetRuntimeArgs(const Program &program, KernelHandle kernel_id, const CoreCoord &logical_core) {
+void SetRuntimeArgs(const Program &program, KernelHandle kernel, const std::vector<CoreCoord> &core_spec, const uint32_t *runtime_args, uint32_t num_runtime_args, uint32_t stride)
+{
+    ZoneScoped;
+    detail::GetKernel(program, kernel)->set_runtime_args(core_spec, runtime_args, num_runtime_args, stride);
+}
+
+RuntimeArgsData & GetRuntimeArgs(const Program &program, KernelHandle kernel_id, const CoreCoord &logical_core) {
     return detail::GetKernel(program, kernel_id)->runtime_args(logical_core);
 }
 